@@ -0,0 +1,49 @@
+#ifndef S21_BENCH_H
+#define S21_BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace s21_bench {
+
+// keeps the compiler from optimizing away a computed value
+template <typename T>
+inline void do_not_optimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// runs fn `repeats` times and returns the best wall time in milliseconds
+template <typename F>
+double measure(F &&fn, int repeats = 5) {
+  double best = 0;
+  for (int i = 0; i < repeats; i++) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+    best = (i == 0) ? ms : std::min(best, ms);
+  }
+  return best;
+}
+
+// prints one result line, with the speedup over baseline when it is given
+inline void report(const std::string &name, double ms, double baseline = 0) {
+  if (baseline > 0) {
+    std::printf("  %-48s %10.3f ms  x%.2f\n", name.c_str(), ms, baseline / ms);
+  } else {
+    std::printf("  %-48s %10.3f ms\n", name.c_str(), ms);
+  }
+}
+
+inline void section(const std::string &title) {
+  std::printf("%s\n", title.c_str());
+}
+
+}  // namespace s21_bench
+
+#endif
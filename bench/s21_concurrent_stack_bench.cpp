@@ -0,0 +1,65 @@
+#include <mutex>
+#include <thread>
+
+#include "s21_bench.h"
+
+const int kOperations = 2000000;
+
+// s21::stack behind a mutex, the shared free list used before
+template <typename T>
+class locked_stack {
+ public:
+  void push(const T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+  bool try_pop(T &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    out = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::stack<T> stack_;
+};
+
+// `threads` threads share kOperations push/pop pairs, as a free list does:
+// each pushes one element and pops one back
+template <typename Stack>
+double push_pop_pairs(int threads) {
+  return s21_bench::measure(
+      [&] {
+        Stack stack;
+        for (int i = 0; i < 1024; i++) stack.push(i);
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+          workers.emplace_back([&] {
+            long sum = 0;
+            int value = 0;
+            for (int i = 0; i < kOperations / threads; i++) {
+              stack.push(i);
+              if (stack.try_pop(value)) sum += value;
+            }
+            s21_bench::do_not_optimize(sum);
+          });
+        }
+        for (std::thread &worker : workers) worker.join();
+      },
+      3);
+}
+
+int main() {
+  for (int threads : {1, 2, 4, 8}) {
+    s21_bench::section(std::to_string(threads) + " threads, " +
+                       std::to_string(kOperations) + " push/pop pairs");
+    double baseline = push_pop_pairs<locked_stack<int>>(threads);
+    s21_bench::report("mutex + s21::stack<int>", baseline);
+    s21_bench::report("s21::concurrent_stack<int>",
+                      push_pop_pairs<s21::concurrent_stack<int>>(threads),
+                      baseline);
+  }
+  return 0;
+}
@@ -0,0 +1,84 @@
+#include <deque>
+
+#include "s21_bench.h"
+
+// pushes n elements, half at each end
+template <typename Deque>
+double push_both_ends(size_t n) {
+  return s21_bench::measure(
+      [&] {
+        Deque d;
+        for (size_t i = 0; i < n; i += 2) {
+          d.push_back(static_cast<int>(i));
+          d.push_front(static_cast<int>(i));
+        }
+        s21_bench::do_not_optimize(d.front());
+      },
+      3);
+}
+
+// fills n elements, then reads them at pseudo-random positions n times
+template <typename Deque>
+double random_access(size_t n) {
+  Deque d;
+  for (size_t i = 0; i < n; i++) d.push_back(static_cast<int>(i));
+  return s21_bench::measure(
+      [&] {
+        long sum = 0;
+        size_t pos = 0;
+        for (size_t i = 0; i < n; i++) {
+          pos = (pos * 1103515245 + 12345) % n;
+          sum += d[pos];
+        }
+        s21_bench::do_not_optimize(sum);
+      },
+      3);
+}
+
+// sums n elements through iterators
+template <typename Container>
+double traversal(size_t n) {
+  Container c;
+  for (size_t i = 0; i < n; i++) c.push_back(static_cast<int>(i));
+  return s21_bench::measure(
+      [&] {
+        long sum = 0;
+        for (int value : c) sum += value;
+        s21_bench::do_not_optimize(sum);
+      },
+      5);
+}
+
+int main() {
+  for (size_t n : {size_t{100000}, size_t{10000000}}) {
+    std::string count = std::to_string(n) + " ints";
+    s21_bench::section("push_back + push_front, " + count);
+    double baseline = push_both_ends<std::deque<int>>(n);
+    s21_bench::report("std::deque<int>", baseline);
+    s21_bench::report("s21::ring_buffer<int>",
+                      push_both_ends<s21::ring_buffer<int>>(n), baseline);
+    s21_bench::report("s21::list<int>", push_both_ends<s21::list<int>>(n),
+                      baseline);
+    s21_bench::report("s21::deque<int>", push_both_ends<s21::deque<int>>(n),
+                      baseline);
+
+    s21_bench::section("operator[] at random positions, " + count);
+    baseline = random_access<std::deque<int>>(n);
+    s21_bench::report("std::deque<int>", baseline);
+    s21_bench::report("s21::ring_buffer<int>",
+                      random_access<s21::ring_buffer<int>>(n), baseline);
+    s21_bench::report("s21::deque<int>", random_access<s21::deque<int>>(n),
+                      baseline);
+
+    s21_bench::section("iterator traversal, " + count);
+    baseline = traversal<std::deque<int>>(n);
+    s21_bench::report("std::deque<int>", baseline);
+    s21_bench::report("s21::ring_buffer<int>",
+                      traversal<s21::ring_buffer<int>>(n), baseline);
+    s21_bench::report("s21::list<int>", traversal<s21::list<int>>(n),
+                      baseline);
+    s21_bench::report("s21::deque<int>", traversal<s21::deque<int>>(n),
+                      baseline);
+  }
+  return 0;
+}
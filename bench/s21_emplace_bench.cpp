@@ -0,0 +1,63 @@
+#include <string>
+
+#include "s21_bench.h"
+
+const size_t kCount = 1000000;
+
+// a message too long for the small string buffer, so a copy allocates
+const std::string kMessage(100, 'm');
+
+// fills the container through push(const&), push(&&) or emplace with one
+// heap-allocated message per element
+template <typename Container, typename Push>
+double fill(Push &&push) {
+  return s21_bench::measure(
+      [&] {
+        Container c;
+        for (size_t i = 0; i < kCount; i++) push(c);
+        s21_bench::do_not_optimize(c.size());
+      },
+      3);
+}
+
+template <typename Queue>
+void adapter_section(const std::string &name) {
+  s21_bench::section(name + ", 1000000 strings of 100 chars");
+  double baseline = fill<Queue>([](Queue &q) {
+    std::string message = kMessage;
+    q.push(message);
+  });
+  s21_bench::report("push(const &)", baseline);
+  s21_bench::report("push(&&)",
+                    fill<Queue>([](Queue &q) {
+                      std::string message = kMessage;
+                      q.push(std::move(message));
+                    }),
+                    baseline);
+  s21_bench::report("emplace(count, char)",
+                    fill<Queue>([](Queue &q) { q.emplace(100, 'm'); }),
+                    baseline);
+}
+
+int main() {
+  adapter_section<s21::queue<std::string>>("s21::queue");
+  adapter_section<s21::stack<std::string>>("s21::stack");
+
+  using list = s21::list<std::string>;
+  s21_bench::section("s21::list, 1000000 strings of 100 chars");
+  double baseline = fill<list>([](list &l) {
+    std::string message = kMessage;
+    l.push_back(message);
+  });
+  s21_bench::report("push_back(const &)", baseline);
+  s21_bench::report("push_back(&&)",
+                    fill<list>([](list &l) {
+                      std::string message = kMessage;
+                      l.push_back(std::move(message));
+                    }),
+                    baseline);
+  s21_bench::report("emplace_back(count, char)",
+                    fill<list>([](list &l) { l.emplace_back(100, 'm'); }),
+                    baseline);
+  return 0;
+}
@@ -0,0 +1,135 @@
+#include <string_view>
+
+#include "s21_bench.h"
+
+const size_t kKeys = 512;
+const size_t kLookups = 10000000;
+
+// sparse opcodes: kKeys odd numbers spread over 24 bits
+constexpr long opcode(size_t i) {
+  return static_cast<long>((i * 2654435761u) & 0xffffff) | 1;
+}
+
+template <typename Layout>
+constexpr s21::frozen_map<long, long, kKeys, Layout> make_table() {
+  s21::array<s21::frozen_entry<long, long>, kKeys> items{};
+  for (size_t i = 0; i < kKeys; i++) items[i] = {opcode(i), long(i)};
+  return s21::frozen_map<long, long, kKeys, Layout>(items);
+}
+
+constexpr auto kHashed = make_table<s21::frozen_perfect_hash>();
+constexpr auto kEytzinger = make_table<s21::frozen_eytzinger>();
+
+constexpr std::string_view kHeaders[] = {
+    "accept",          "accept-encoding", "accept-language", "age",
+    "authorization",   "cache-control",   "connection",      "content-length",
+    "content-type",    "cookie",          "date",            "etag",
+    "expires",         "host",            "if-match",        "if-none-match",
+    "last-modified",   "location",        "origin",          "pragma",
+    "range",           "referer",         "server",          "set-cookie",
+    "te",              "trailer",         "upgrade",         "user-agent",
+    "vary",            "via",             "warning",         "x-request-id"};
+constexpr size_t kHeaderCount = sizeof(kHeaders) / sizeof(kHeaders[0]);
+
+constexpr auto make_headers() {
+  s21::array<s21::frozen_entry<std::string_view, int>, kHeaderCount> items{};
+  for (size_t i = 0; i < kHeaderCount; i++) {
+    items[i] = {kHeaders[i], static_cast<int>(i)};
+  }
+  return s21::frozen_map<std::string_view, int, kHeaderCount>(items);
+}
+
+constexpr auto kHeaderTable = make_headers();
+
+// queries: every key in a scrambled order, one in eight missing
+s21::vector<long> make_queries() {
+  s21::vector<long> queries;
+  queries.reserve(kLookups);
+  unsigned x = 1;
+  for (size_t i = 0; i < kLookups; i++) {
+    x = x * 1103515245 + 12345;
+    size_t index = (x >> 8) % kKeys;
+    queries.push_back((x >> 4) % 8 == 0 ? opcode(index) + 1 : opcode(index));
+  }
+  return queries;
+}
+
+template <typename Find>
+double lookups(const s21::vector<long> &queries, Find &&find) {
+  return s21_bench::measure(
+      [&] {
+        long sum = 0;
+        for (long query : queries) sum += find(query);
+        s21_bench::do_not_optimize(sum);
+      },
+      3);
+}
+
+int main() {
+  const s21::vector<long> queries = make_queries();
+  s21::map<long, long> map;
+  std::unordered_map<long, long> hash_map;
+  for (size_t i = 0; i < kKeys; i++) {
+    map.insert(opcode(i), long(i));
+    hash_map.emplace(opcode(i), long(i));
+  }
+
+  s21_bench::section("10000000 lookups in 512 sparse integer keys");
+  double baseline = lookups(queries, [&](long key) {
+    return map.contains(key) ? map.at(key) : -1;
+  });
+  s21_bench::report("s21::map", baseline);
+  s21_bench::report("std::unordered_map",
+                    lookups(queries,
+                            [&](long key) {
+                              auto it = hash_map.find(key);
+                              return it == hash_map.end() ? -1 : it->second;
+                            }),
+                    baseline);
+  s21_bench::report("frozen_map, perfect hash",
+                    lookups(queries,
+                            [&](long key) {
+                              auto it = kHashed.find(key);
+                              return it == kHashed.end() ? -1 : it->second;
+                            }),
+                    baseline);
+  s21_bench::report("frozen_map, Eytzinger",
+                    lookups(queries,
+                            [&](long key) {
+                              auto it = kEytzinger.find(key);
+                              return it == kEytzinger.end() ? -1 : it->second;
+                            }),
+                    baseline);
+
+  s21::vector<std::string> names;
+  s21::map<std::string, int> header_map;
+  for (size_t i = 0; i < kHeaderCount; i++) {
+    header_map.insert(std::string(kHeaders[i]), static_cast<int>(i));
+  }
+  unsigned x = 7;
+  for (size_t i = 0; i < kLookups / 10; i++) {
+    x = x * 1103515245 + 12345;
+    names.push_back(std::string(kHeaders[(x >> 10) % kHeaderCount]));
+  }
+  s21_bench::section("1000000 lookups of 32 HTTP header names, random order");
+  baseline = s21_bench::measure(
+      [&] {
+        long sum = 0;
+        for (const std::string &name : names) sum += header_map.at(name);
+        s21_bench::do_not_optimize(sum);
+      },
+      3);
+  s21_bench::report("s21::map<std::string, int>", baseline);
+  s21_bench::report("frozen_map<std::string_view, int>",
+                    s21_bench::measure(
+                        [&] {
+                          long sum = 0;
+                          for (const std::string &name : names) {
+                            sum += kHeaderTable.at(name);
+                          }
+                          s21_bench::do_not_optimize(sum);
+                        },
+                        3),
+                    baseline);
+  return 0;
+}
@@ -0,0 +1,69 @@
+#include <list>
+
+#include "s21_bench.h"
+
+// a connection record that already lives in an arena
+struct Connection {
+  int id = 0;
+  char payload[56] = {};
+  s21::intrusive_list_hook hook;
+};
+
+using ConnectionList = s21::intrusive_list<Connection, &Connection::hook>;
+
+// links every connection of the arena, then moves every second one to the
+// back of the list, as an LRU touch would; the s21::list of copies is the
+// baseline
+void suite(size_t n) {
+  s21_bench::section(std::to_string(n) + " connections");
+  std::vector<Connection> arena(n);
+  for (size_t i = 0; i < n; i++) arena[i].id = static_cast<int>(i);
+
+  double baseline = s21_bench::measure(
+      [&] {
+        s21::list<Connection> list;
+        for (const Connection &c : arena) list.push_back(c);
+        auto it = list.begin();
+        for (size_t i = 0; i < n; i += 2) {
+          auto touched = it;
+          ++it;
+          ++it;
+          list.push_back(*touched);
+          list.erase(touched);
+        }
+      },
+      1);
+  s21_bench::report("s21::list<Connection> (copies)", baseline);
+  s21_bench::report("std::list<Connection *>",
+                    s21_bench::measure(
+                        [&] {
+                          std::list<Connection *> list;
+                          std::vector<std::list<Connection *>::iterator> where;
+                          where.reserve(n);
+                          for (Connection &c : arena) {
+                            where.push_back(list.insert(list.end(), &c));
+                          }
+                          for (size_t i = 0; i < n; i += 2) {
+                            list.splice(list.end(), list, where[i]);
+                          }
+                        },
+                        1),
+                    baseline);
+  s21_bench::report("s21::intrusive_list<Connection>",
+                    s21_bench::measure(
+                        [&] {
+                          ConnectionList list;
+                          for (Connection &c : arena) list.push_back(c);
+                          for (size_t i = 0; i < n; i += 2) {
+                            list.erase(list.iterator_to(arena[i]));
+                            list.push_back(arena[i]);
+                          }
+                        },
+                        1),
+                    baseline);
+}
+
+int main() {
+  for (size_t n : {size_t{10000}, size_t{1000000}}) suite(n);
+  return 0;
+}
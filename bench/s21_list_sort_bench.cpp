@@ -0,0 +1,68 @@
+#include <list>
+
+#include "s21_bench.h"
+
+// pseudo-random ints, or the same values already sorted or reversed
+s21::vector<int> make_values(size_t n, const std::string &order) {
+  s21::vector<int> values;
+  values.reserve(n);
+  unsigned x = 1;
+  for (size_t i = 0; i < n; i++) {
+    x = x * 1103515245 + 12345;
+    values.push_back(static_cast<int>(x >> 1));
+  }
+  if (order != "random") std::sort(values.begin(), values.end());
+  if (order == "reversed") std::reverse(values.begin(), values.end());
+  return values;
+}
+
+void suite(size_t n, const std::string &order) {
+  const s21::vector<int> values = make_values(n, order);
+  int repeats = n >= 1000000 ? 1 : 5;
+  // the lists are rebuilt outside the timed region
+  std::list<int> std_list;
+  s21::list<int> list;
+  double baseline = 0, ms = 0;
+  for (int i = 0; i < repeats; i++) {
+    std_list.assign(values.begin(), values.end());
+    double t = s21_bench::measure([&] { std_list.sort(); }, 1);
+    baseline = i == 0 ? t : std::min(baseline, t);
+    list.clear();
+    for (int value : values) list.push_back(value);
+    t = s21_bench::measure([&] { list.sort(); }, 1);
+    ms = i == 0 ? t : std::min(ms, t);
+  }
+  s21_bench::report("std::list::sort, " + std::to_string(n) + " " + order,
+                    baseline);
+  s21_bench::report("s21::list::sort, " + std::to_string(n) + " " + order, ms,
+                    baseline);
+}
+
+// merges two sorted lists of n / 2 elements each
+void merge_suite(size_t n) {
+  s21::vector<int> values = make_values(n, "sorted");
+  s21::vector<int> left, right;
+  for (size_t i = 0; i < n; i++) (i % 2 ? left : right).push_back(values[i]);
+  std::list<int> std_list(left.begin(), left.end());
+  std::list<int> std_other(right.begin(), right.end());
+  s21::list<int> list, other;
+  for (int value : left) list.push_back(value);
+  for (int value : right) other.push_back(value);
+  double baseline = s21_bench::measure([&] { std_list.merge(std_other); }, 1);
+  s21_bench::report("std::list::merge, " + std::to_string(n), baseline);
+  s21_bench::report("s21::list::merge, " + std::to_string(n),
+                    s21_bench::measure([&] { list.merge(other); }, 1),
+                    baseline);
+}
+
+int main() {
+  s21_bench::section("list<int>::sort");
+  for (size_t n : {size_t{1000}, size_t{100000}, size_t{10000000}}) {
+    for (const char *order : {"random", "sorted", "reversed"}) suite(n, order);
+  }
+  s21_bench::section("list<int>::merge");
+  for (size_t n : {size_t{1000}, size_t{100000}, size_t{10000000}}) {
+    merge_suite(n);
+  }
+  return 0;
+}
@@ -0,0 +1,90 @@
+#include <mutex>
+#include <thread>
+
+#include "s21_bench.h"
+
+const int kMessages = 2000000;
+
+// s21::queue behind a mutex, the shared queue the worker pools used before
+template <typename T>
+class locked_queue {
+ public:
+  explicit locked_queue(size_t capacity) : capacity_(capacity) {}
+
+  bool try_push(const T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.size() == capacity_) return false;
+    queue_.push(value);
+    return true;
+  }
+  size_t pop_bulk(T *out, size_t max) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t n = 0;
+    for (; n < max && !queue_.empty(); n++) {
+      out[n] = queue_.front();
+      queue_.pop();
+    }
+    return n;
+  }
+
+ private:
+  size_t capacity_;
+  std::mutex mutex_;
+  s21::queue<T> queue_;
+};
+
+// moves kMessages ints from `producers` threads to `consumers` threads;
+// consumers take up to `batch` elements per call, and a side that finds
+// the queue full or empty yields
+template <typename Queue>
+double transfer(int producers, int consumers, size_t batch) {
+  return s21_bench::measure(
+      [&] {
+        Queue queue(1024);
+        std::atomic<int> received{0};
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++) {
+          threads.emplace_back([&, p] {
+            for (int i = p; i < kMessages; i += producers) {
+              while (!queue.try_push(i)) std::this_thread::yield();
+            }
+          });
+        }
+        for (int c = 0; c < consumers; c++) {
+          threads.emplace_back([&] {
+            std::vector<int> out(batch);
+            long sum = 0;
+            while (received.load(std::memory_order_relaxed) < kMessages) {
+              size_t n = queue.pop_bulk(out.data(), batch);
+              if (n == 0) {
+                std::this_thread::yield();
+                continue;
+              }
+              for (size_t i = 0; i < n; i++) sum += out[i];
+              received.fetch_add(static_cast<int>(n));
+            }
+            s21_bench::do_not_optimize(sum);
+          });
+        }
+        for (std::thread &thread : threads) thread.join();
+      },
+      3);
+}
+
+int main() {
+  const std::pair<int, int> shapes[] = {{1, 1}, {2, 2}, {4, 4}, {1, 4}, {4, 1}};
+  for (auto [producers, consumers] : shapes) {
+    s21_bench::section(std::to_string(producers) + " producers, " +
+                       std::to_string(consumers) + " consumers, " +
+                       std::to_string(kMessages) + " ints");
+    double baseline = transfer<locked_queue<int>>(producers, consumers, 1);
+    s21_bench::report("mutex + s21::queue<int>", baseline);
+    s21_bench::report("s21::mpmc_queue<int>",
+                      transfer<s21::mpmc_queue<int>>(producers, consumers, 1),
+                      baseline);
+    s21_bench::report("s21::mpmc_queue<int> pop_bulk 32",
+                      transfer<s21::mpmc_queue<int>>(producers, consumers, 32),
+                      baseline);
+  }
+  return 0;
+}
@@ -0,0 +1,115 @@
+#include <cmath>
+#include <numeric>
+#include <thread>
+
+#include "s21_bench.h"
+
+const size_t kSize = size_t{1} << 22;
+
+// thread counts 1, 2, 4, ... up to the hardware threads
+s21::vector<size_t> thread_counts() {
+  size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+  s21::vector<size_t> counts;
+  for (size_t n = 1; n < hardware; n *= 2) counts.push_back(n);
+  counts.push_back(hardware);
+  return counts;
+}
+
+s21::vector<int> make_data(size_t n) {
+  s21::vector<int> data;
+  data.reserve(n);
+  unsigned x = 1;
+  for (size_t i = 0; i < n; i++) {
+    x = x * 1103515245 + 12345;
+    data.push_back(static_cast<int>(x >> 1));
+  }
+  return data;
+}
+
+// times fn(policy) for every thread count; the single-threaded std::
+// version is the baseline
+template <typename StdFn, typename ParallelFn>
+void scaling(const std::string &name, size_t grain, StdFn &&std_fn,
+             ParallelFn &&parallel_fn) {
+  s21_bench::section(name);
+  double baseline = s21_bench::measure(std_fn, 3);
+  s21_bench::report("std::", baseline);
+  for (size_t threads : thread_counts()) {
+    s21::thread_pool pool(threads);
+    s21::parallel::policy policy{&pool, grain};
+    double ms = s21_bench::measure([&] { parallel_fn(policy); }, 3);
+    s21_bench::report("s21::parallel, " + std::to_string(threads) +
+                          " threads, grain " +
+                          (grain ? std::to_string(grain) : "auto"),
+                      ms, baseline);
+  }
+}
+
+int main() {
+  const s21::vector<int> source = make_data(kSize);
+  s21::vector<int> data;
+  s21::vector<long> out(kSize);
+  std::printf("%zu ints, %u hardware threads\n", kSize,
+              std::thread::hardware_concurrency());
+
+  for (size_t grain : {size_t{0}, size_t{1} << 16}) {
+    scaling(
+        "sort", grain,
+        [&] {
+          data = s21::vector<int>(source);
+          std::sort(data.begin(), data.end());
+        },
+        [&](const s21::parallel::policy &p) {
+          data = s21::vector<int>(source);
+          s21::parallel::sort(p, data);
+        });
+    scaling(
+        "stable_sort", grain,
+        [&] {
+          data = s21::vector<int>(source);
+          std::stable_sort(data.begin(), data.end());
+        },
+        [&](const s21::parallel::policy &p) {
+          data = s21::vector<int>(source);
+          s21::parallel::stable_sort(p, data);
+        });
+    scaling(
+        "transform x -> sqrt(x)", grain,
+        [&] {
+          std::transform(source.begin(), source.end(), out.begin(), [](int x) {
+            return static_cast<long>(std::sqrt(static_cast<double>(x)));
+          });
+        },
+        [&](const s21::parallel::policy &p) {
+          s21::parallel::transform(p, source, out, [](int x) {
+            return static_cast<long>(std::sqrt(static_cast<double>(x)));
+          });
+        });
+    scaling(
+        "reduce", grain,
+        [&] {
+          s21_bench::do_not_optimize(
+              std::accumulate(source.begin(), source.end(), 0L));
+        },
+        [&](const s21::parallel::policy &p) {
+          s21_bench::do_not_optimize(s21::parallel::reduce(p, source, 0L));
+        });
+    scaling(
+        "inclusive_scan", grain,
+        [&] { std::partial_sum(source.begin(), source.end(), out.begin()); },
+        [&](const s21::parallel::policy &p) {
+          s21::parallel::inclusive_scan(p, source, out);
+        });
+    scaling(
+        "for_each x -> x / 3", grain,
+        [&] {
+          data = s21::vector<int>(source);
+          std::for_each(data.begin(), data.end(), [](int &x) { x /= 3; });
+        },
+        [&](const s21::parallel::policy &p) {
+          data = s21::vector<int>(source);
+          s21::parallel::for_each(p, data, [](int &x) { x /= 3; });
+        });
+  }
+  return 0;
+}
@@ -0,0 +1,206 @@
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "s21_bench.h"
+
+// every queue here is a min-queue, so that s21::multiset can stand in for a
+// heap through begin() and erase(begin())
+
+template <size_t Arity>
+using s21_heap = s21::priority_queue<unsigned, s21::vector<unsigned>,
+                                     std::greater<unsigned>, Arity>;
+using std_heap = std::priority_queue<unsigned, std::vector<unsigned>,
+                                     std::greater<unsigned>>;
+
+// the same calls for the heaps and the multiset
+template <typename Queue>
+struct queue_ops {
+  static void push(Queue &q, unsigned value) { q.push(value); }
+  static unsigned top(Queue &q) { return q.top(); }
+  static void pop(Queue &q) { q.pop(); }
+};
+
+template <>
+struct queue_ops<s21::multiset<unsigned>> {
+  using set = s21::multiset<unsigned>;
+  static void push(set &q, unsigned value) { q.insert(value); }
+  static unsigned top(set &q) { return *q.begin(); }
+  static void pop(set &q) { q.erase(q.begin()); }
+};
+
+inline unsigned next_random(unsigned &seed) {
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+// pushes n pseudo-random keys, then pops them all
+template <typename Queue>
+double push_then_pop(size_t n) {
+  using ops = queue_ops<Queue>;
+  return s21_bench::measure(
+      [&] {
+        Queue q;
+        unsigned seed = 1;
+        for (size_t i = 0; i < n; i++) ops::push(q, next_random(seed));
+        unsigned sum = 0;
+        for (size_t i = 0; i < n; i++) {
+          sum += ops::top(q);
+          ops::pop(q);
+        }
+        s21_bench::do_not_optimize(sum);
+      },
+      3);
+}
+
+// the hold model of event simulation: a queue of n keys, where each step
+// pops the smallest key and pushes it back a random distance later
+template <typename Queue>
+double hold(size_t n, size_t steps) {
+  using ops = queue_ops<Queue>;
+  Queue q;
+  unsigned seed = 7;
+  for (size_t i = 0; i < n; i++) ops::push(q, next_random(seed) % 1000000);
+  return s21_bench::measure(
+      [&] {
+        for (size_t i = 0; i < steps; i++) {
+          unsigned now = ops::top(q);
+          ops::pop(q);
+          ops::push(q, now + next_random(seed) % 1000000);
+        }
+        s21_bench::do_not_optimize(ops::top(q));
+      },
+      3);
+}
+
+// a random sparse graph as adjacency lists
+struct graph {
+  struct edge {
+    unsigned to;
+    unsigned weight;
+  };
+  std::vector<std::vector<edge>> adjacent;
+};
+
+graph random_graph(unsigned vertices, unsigned degree) {
+  graph g;
+  g.adjacent.resize(vertices);
+  unsigned seed = 3;
+  for (unsigned v = 0; v < vertices; v++) {
+    for (unsigned e = 0; e < degree; e++) {
+      g.adjacent[v].push_back(
+          {next_random(seed) % vertices, next_random(seed) % 1000 + 1});
+    }
+  }
+  return g;
+}
+
+const unsigned kInfinity = static_cast<unsigned>(-1);
+
+// Dijkstra with decrease_key on the indexed queue: one entry per vertex
+template <size_t Arity>
+unsigned long dijkstra_indexed(const graph &g) {
+  using entry = std::pair<unsigned, unsigned>;  // distance, vertex
+  s21::indexed_priority_queue<entry, std::greater<entry>, Arity> q;
+  const size_t n = g.adjacent.size();
+  std::vector<unsigned> dist(n, kInfinity);
+  std::vector<size_t> handle(n, kInfinity);
+  dist[0] = 0;
+  handle[0] = q.push({0, 0});
+  while (!q.empty()) {
+    unsigned u = q.top().second;
+    q.pop();
+    for (const graph::edge &e : g.adjacent[u]) {
+      unsigned d = dist[u] + e.weight;
+      if (d >= dist[e.to]) continue;
+      if (dist[e.to] == kInfinity) {
+        handle[e.to] = q.push({d, e.to});
+      } else {
+        q.decrease_key(handle[e.to], {d, e.to});
+      }
+      dist[e.to] = d;
+    }
+  }
+  unsigned long sum = 0;
+  for (unsigned d : dist) sum += d == kInfinity ? 0 : d;
+  return sum;
+}
+
+// Dijkstra with lazy deletion: a shorter path pushes a duplicate entry and
+// stale entries are skipped when they come out
+template <typename Heap>
+unsigned long dijkstra_lazy(const graph &g) {
+  using entry = std::pair<unsigned, unsigned>;
+  Heap q;
+  const size_t n = g.adjacent.size();
+  std::vector<unsigned> dist(n, kInfinity);
+  dist[0] = 0;
+  q.push(entry{0, 0});
+  while (!q.empty()) {
+    entry top = q.top();
+    q.pop();
+    if (top.first != dist[top.second]) continue;
+    for (const graph::edge &e : g.adjacent[top.second]) {
+      unsigned d = top.first + e.weight;
+      if (d >= dist[e.to]) continue;
+      dist[e.to] = d;
+      q.push(entry{d, e.to});
+    }
+  }
+  unsigned long sum = 0;
+  for (unsigned d : dist) sum += d == kInfinity ? 0 : d;
+  return sum;
+}
+
+template <typename F>
+double time_dijkstra(const graph &g, F &&run) {
+  return s21_bench::measure([&] { s21_bench::do_not_optimize(run(g)); }, 3);
+}
+
+int main() {
+  for (size_t n : {size_t{10000}, size_t{1000000}}) {
+    std::string count = std::to_string(n) + " unsigned";
+    s21_bench::section("push all, then pop all, " + count);
+    double baseline = push_then_pop<std_heap>(n);
+    s21_bench::report("std::priority_queue", baseline);
+    s21_bench::report("s21::priority_queue, binary",
+                      push_then_pop<s21_heap<2>>(n), baseline);
+    s21_bench::report("s21::priority_queue, 4-ary",
+                      push_then_pop<s21_heap<4>>(n), baseline);
+    s21_bench::report("s21::priority_queue, 8-ary",
+                      push_then_pop<s21_heap<8>>(n), baseline);
+    s21_bench::report("s21::multiset as heap",
+                      push_then_pop<s21::multiset<unsigned>>(n), baseline);
+
+    s21_bench::section("hold model, " + count + ", 1000000 pop + push");
+    const size_t steps = 1000000;
+    baseline = hold<std_heap>(n, steps);
+    s21_bench::report("std::priority_queue", baseline);
+    s21_bench::report("s21::priority_queue, binary",
+                      hold<s21_heap<2>>(n, steps), baseline);
+    s21_bench::report("s21::priority_queue, 4-ary",
+                      hold<s21_heap<4>>(n, steps), baseline);
+    s21_bench::report("s21::priority_queue, 8-ary",
+                      hold<s21_heap<8>>(n, steps), baseline);
+    s21_bench::report("s21::multiset as heap",
+                      hold<s21::multiset<unsigned>>(n, steps), baseline);
+  }
+
+  using entry = std::pair<unsigned, unsigned>;
+  using std_lazy = std::priority_queue<entry, std::vector<entry>,
+                                       std::greater<entry>>;
+  using s21_lazy =
+      s21::priority_queue<entry, s21::vector<entry>, std::greater<entry>>;
+  graph g = random_graph(1000000, 8);
+  s21_bench::section("Dijkstra, 1000000 vertices, 8000000 edges");
+  double baseline = time_dijkstra(g, dijkstra_lazy<std_lazy>);
+  s21_bench::report("std::priority_queue, lazy deletion", baseline);
+  s21_bench::report("s21::priority_queue 4-ary, lazy deletion",
+                    time_dijkstra(g, dijkstra_lazy<s21_lazy>), baseline);
+  s21_bench::report("s21::indexed_priority_queue binary, decrease_key",
+                    time_dijkstra(g, dijkstra_indexed<2>), baseline);
+  s21_bench::report("s21::indexed_priority_queue 4-ary, decrease_key",
+                    time_dijkstra(g, dijkstra_indexed<4>), baseline);
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include <list>
+
+#include "s21_bench.h"
+
+template <typename T>
+s21::vector<T> make_keys(size_t n) {
+  s21::vector<T> keys;
+  keys.reserve(n);
+  uint64_t x = 88172645463325252ull;
+  for (size_t i = 0; i < n; i++) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    keys.push_back(static_cast<T>(x));
+  }
+  return keys;
+}
+
+// sorts fresh copies of the keys; the copy is timed on both sides
+template <typename T>
+void vector_suite(const std::string &type, size_t n) {
+  s21_bench::section("vector<" + type + ">, " + std::to_string(n) + " keys");
+  const s21::vector<T> keys = make_keys<T>(n);
+  int repeats = n >= 50000000 ? 1 : 3;
+  double baseline = s21_bench::measure(
+      [&] {
+        s21::vector<T> v(keys);
+        std::sort(v.begin(), v.end());
+        s21_bench::do_not_optimize(v.data());
+      },
+      repeats);
+  s21_bench::report("std::sort", baseline);
+  s21_bench::report("s21::radix_sort",
+                    s21_bench::measure(
+                        [&] {
+                          s21::vector<T> v(keys);
+                          s21::radix_sort(v);
+                          s21_bench::do_not_optimize(v.data());
+                        },
+                        repeats),
+                    baseline);
+}
+
+struct Record {
+  uint64_t id;
+  uint32_t payload[2];
+};
+
+void record_suite(size_t n) {
+  s21_bench::section("vector<Record> by uint64_t id, " + std::to_string(n) +
+                     " records");
+  s21::vector<Record> records;
+  for (uint64_t id : make_keys<uint64_t>(n)) records.push_back({id, {1, 2}});
+  double baseline = s21_bench::measure([&] {
+    s21::vector<Record> v(records);
+    std::sort(v.begin(), v.end(),
+              [](const Record &a, const Record &b) { return a.id < b.id; });
+    s21_bench::do_not_optimize(v.data());
+  });
+  s21_bench::report("std::sort", baseline);
+  s21_bench::report("s21::radix_sort",
+                    s21_bench::measure([&] {
+                      s21::vector<Record> v(records);
+                      s21::radix_sort(v, [](const Record &r) { return r.id; });
+                      s21_bench::do_not_optimize(v.data());
+                    }),
+                    baseline);
+}
+
+template <typename T>
+void list_suite(const std::string &type, size_t n) {
+  s21_bench::section("list<" + type + ">, " + std::to_string(n) + " keys");
+  const s21::vector<T> keys = make_keys<T>(n);
+  std::list<T> std_list(keys.begin(), keys.end());
+  s21::list<T> list;
+  for (T key : keys) list.push_back(key);
+  double baseline = s21_bench::measure([&] { std_list.sort(); }, 1);
+  s21_bench::report("std::list::sort", baseline);
+  s21_bench::report("s21::list::radix_sort",
+                    s21_bench::measure([&] { list.radix_sort(); }, 1),
+                    baseline);
+}
+
+int main() {
+  for (size_t n : {size_t{1000000}, size_t{10000000}, size_t{100000000}}) {
+    vector_suite<uint64_t>("uint64_t", n);
+  }
+  vector_suite<int64_t>("int64_t", 10000000);
+  vector_suite<uint32_t>("uint32_t", 10000000);
+  vector_suite<double>("double", 10000000);
+  record_suite(10000000);
+  list_suite<uint64_t>("uint64_t", 1000000);
+  list_suite<uint32_t>("uint32_t", 1000000);
+  return 0;
+}
@@ -0,0 +1,92 @@
+#include "s21_bench.h"
+
+// same layout as T, but with user-provided copy and move operations, so the
+// containers fall back to element-by-element loops
+template <typename T>
+struct Opaque {
+  T value{};
+  Opaque() = default;
+  Opaque(const Opaque &other) : value(other.value) {}
+  Opaque(Opaque &&other) noexcept : value(other.value) {}
+  Opaque &operator=(const Opaque &other) {
+    value = other.value;
+    return *this;
+  }
+  Opaque &operator=(Opaque &&other) noexcept {
+    value = other.value;
+    return *this;
+  }
+  ~Opaque() {}
+};
+
+template <typename T>
+double vector_growth(int n) {
+  return s21_bench::measure([n] {
+    for (int round = 0; round < 2000; round++) {
+      s21::vector<T> v;
+      for (int i = 0; i < n; i++) v.push_back(T());
+      s21_bench::do_not_optimize(v.data());
+    }
+  });
+}
+
+template <typename T>
+double vector_middle_insert_erase(int n) {
+  s21::vector<T> v(n);
+  return s21_bench::measure([&v] {
+    for (int i = 0; i < 200; i++) v.insert(v.begin() + v.size() / 2, T());
+    for (int i = 0; i < 200; i++) v.erase(v.begin() + v.size() / 2);
+    s21_bench::do_not_optimize(v.data());
+  });
+}
+
+template <typename T>
+double vector_copy(int n) {
+  s21::vector<T> v(n);
+  return s21_bench::measure([&v] {
+    for (int i = 0; i < 20; i++) {
+      s21::vector<T> copy(v);
+      s21_bench::do_not_optimize(copy.data());
+    }
+  });
+}
+
+template <typename T>
+void vector_suite(const std::string &name) {
+  const int n = 1 << 20;
+  s21_bench::section("vector<" + name + ">, " + std::to_string(n) + " items");
+  double slow = vector_growth<Opaque<T>>(4096);
+  s21_bench::report("2000 x 4096 push_back growth, element-wise", slow);
+  s21_bench::report("2000 x 4096 push_back growth, bulk",
+                    vector_growth<T>(4096), slow);
+  slow = vector_middle_insert_erase<Opaque<T>>(n);
+  s21_bench::report("200 middle insert + erase, element-wise", slow);
+  s21_bench::report("200 middle insert + erase, bulk",
+                    vector_middle_insert_erase<T>(n), slow);
+  slow = vector_copy<Opaque<T>>(n);
+  s21_bench::report("20 copies, element-wise", slow);
+  s21_bench::report("20 copies, bulk", vector_copy<T>(n), slow);
+}
+
+template <typename T>
+double array_copy_move() {
+  s21::array<T, 4096> source;
+  source.fill(T());
+  return s21_bench::measure([&source] {
+    for (int i = 0; i < 1000; i++) {
+      s21::array<T, 4096> copy(source);
+      s21::array<T, 4096> moved(std::move(copy));
+      s21_bench::do_not_optimize(moved.data());
+    }
+  });
+}
+
+int main() {
+  vector_suite<int>("int");
+  vector_suite<std::pair<int, int>>("std::pair<int, int>");
+  s21_bench::section("array<double, 4096>, 1000 copies + moves");
+  double slow = array_copy_move<Opaque<double>>();
+  s21_bench::report("element-wise", slow);
+  s21_bench::report("bulk", array_copy_move<double>(), slow);
+  return 0;
+}
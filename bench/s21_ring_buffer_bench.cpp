@@ -0,0 +1,77 @@
+#include <deque>
+#include <queue>
+#include <stack>
+
+#include "s21_bench.h"
+
+const size_t kOps = 10000000;
+
+// keeps `depth` items queued while pushing and popping kOps more, as a task
+// queue in a steady state does
+template <typename Queue>
+double queue_throughput(size_t depth) {
+  return s21_bench::measure(
+      [&] {
+        Queue queue;
+        for (size_t i = 0; i < depth; i++) queue.push(static_cast<int>(i));
+        long sum = 0;
+        for (size_t i = 0; i < kOps; i++) {
+          queue.push(static_cast<int>(i));
+          sum += queue.front();
+          queue.pop();
+        }
+        s21_bench::do_not_optimize(sum);
+      },
+      3);
+}
+
+// pushes `depth` items and pops them all, kOps items in total
+template <typename Stack>
+double stack_throughput(size_t depth) {
+  return s21_bench::measure(
+      [&] {
+        Stack stack;
+        long sum = 0;
+        for (size_t round = 0; round < kOps / depth; round++) {
+          for (size_t i = 0; i < depth; i++) stack.push(static_cast<int>(i));
+          while (!stack.empty()) {
+            sum += stack.top();
+            stack.pop();
+          }
+        }
+        s21_bench::do_not_optimize(sum);
+      },
+      3);
+}
+
+void report_mops(const std::string &name, double ms, double baseline) {
+  s21_bench::report(name + ", " +
+                        std::to_string(static_cast<long>(kOps / ms / 1000)) +
+                        " Mops/s",
+                    ms, baseline);
+}
+
+int main() {
+  for (size_t depth : {size_t{16}, size_t{100000}}) {
+    s21_bench::section("queue<int> push+pop, " + std::to_string(depth) +
+                       " queued");
+    double baseline = queue_throughput<s21::queue<int>>(depth);
+    report_mops("s21::queue<int> (linked_list)", baseline, 0);
+    report_mops("std::queue<int> (deque)",
+                queue_throughput<std::queue<int>>(depth), baseline);
+    report_mops("s21::queue<int, ring_buffer>",
+                queue_throughput<s21::queue<int, s21::ring_buffer<int>>>(depth),
+                baseline);
+
+    s21_bench::section("stack<int> push then pop, depth " +
+                       std::to_string(depth));
+    baseline = stack_throughput<s21::stack<int>>(depth);
+    report_mops("s21::stack<int> (linked_list)", baseline, 0);
+    report_mops("std::stack<int> (deque)",
+                stack_throughput<std::stack<int>>(depth), baseline);
+    report_mops("s21::stack<int, ring_buffer>",
+                stack_throughput<s21::stack<int, s21::ring_buffer<int>>>(depth),
+                baseline);
+  }
+  return 0;
+}
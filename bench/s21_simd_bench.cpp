@@ -0,0 +1,73 @@
+#include <numeric>
+
+#include "s21_bench.h"
+
+// 256 KiB of int32_t or float, so the data stays in L2 and the loops are
+// compute bound
+const size_t kSize = 1 << 16;
+const int kRounds = 200;
+
+// runs fn over the data kRounds times and returns the best time
+template <typename F>
+double run(F &&fn) {
+  return s21_bench::measure([&fn] {
+    for (int round = 0; round < kRounds; round++) {
+      s21_bench::do_not_optimize(fn());
+    }
+  });
+}
+
+// times the std:: algorithm and then the simd kernel for every instruction
+// set the CPU supports
+template <typename StdFn, typename SimdFn>
+void compare(const std::string &name, StdFn &&std_fn, SimdFn &&simd_fn) {
+  double baseline = run(std_fn);
+  s21_bench::report(name + ", std::", baseline);
+  const std::pair<s21::simd::isa, const char *> isas[] = {
+      {s21::simd::isa::sse2, "sse2"}, {s21::simd::isa::avx2, "avx2"}};
+  for (const auto &isa : isas) {
+    if (s21::simd::supported_isa() < isa.first) continue;
+    s21::simd::limit_isa(isa.first);
+    s21_bench::report(name + ", simd " + isa.second, run(simd_fn), baseline);
+  }
+  s21::simd::limit_isa(s21::simd::isa::avx2);
+}
+
+template <typename T>
+void suite(const std::string &type) {
+  s21_bench::section("vector<" + type + ">, " + std::to_string(kSize) +
+                     " items x " + std::to_string(kRounds));
+  s21::vector<T> v;
+  for (size_t i = 0; i < kSize; i++) v.push_back(static_cast<T>(i % 1000));
+  const T *first = v.begin(), *last = v.end();
+  // the searched value is missing, so every element is visited
+  const T missing = static_cast<T>(-1);
+
+  compare(
+      "find", [&] { return std::find(first, last, missing); },
+      [&] { return s21::simd::find(v, missing); });
+  compare(
+      "count", [&] { return std::count(first, last, T(7)); },
+      [&] { return s21::simd::count(v, T(7)); });
+  compare(
+      "min", [&] { return *std::min_element(first, last); },
+      [&] { return s21::simd::min(v); });
+  compare(
+      "max", [&] { return *std::max_element(first, last); },
+      [&] { return s21::simd::max(v); });
+  compare(
+      "sum",
+      [&] { return std::accumulate(first, last, s21::simd::sum_type<T>(0)); },
+      [&] { return s21::simd::sum(v); });
+  compare(
+      "any_of(x > t)",
+      [&] { return std::any_of(first, last, [](T x) { return x > T(5000); }); },
+      [&] { return s21::simd::any_greater(v, T(5000)); });
+}
+
+int main() {
+  suite<int32_t>("int32_t");
+  suite<float>("float");
+  suite<double>("double");
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include <cstdlib>
+#include <new>
+
+#include "s21_bench.h"
+
+static size_t allocations = 0;
+
+void *operator new(size_t size) {
+  allocations++;
+  void *ptr = std::malloc(size ? size : 1);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+// builds `rounds` short-lived vectors of up to `length` elements each
+template <typename Vector>
+void short_lived(int rounds, int length) {
+  for (int round = 0; round < rounds; round++) {
+    Vector v;
+    for (int i = 0; i < (round % length) + 1; i++) v.push_back(round + i);
+    s21_bench::do_not_optimize(v.size());
+  }
+}
+
+template <typename Vector>
+double run(const std::string &name, int length, double baseline) {
+  const int rounds = 1000000;
+  allocations = 0;
+  short_lived<Vector>(rounds, length);
+  size_t count = allocations;
+  double ms =
+      s21_bench::measure([length] { short_lived<Vector>(rounds, length); });
+  s21_bench::report(name + ", " + std::to_string(count) + " allocations", ms,
+                    baseline);
+  return ms;
+}
+
+int main() {
+  for (int length : {4, 8, 16}) {
+    s21_bench::section("1000000 vectors of 1.." + std::to_string(length) +
+                       " ints");
+    double slow = run<s21::vector<int>>("vector<int>", length, 0);
+    run<s21::small_vector<int, 8>>("small_vector<int, 8>", length, slow);
+  }
+  return 0;
+}
@@ -0,0 +1,134 @@
+#include <mutex>
+#include <thread>
+
+#include "s21_bench.h"
+
+const int kMessages = 10000000;
+const int kRoundTrips = 200000;
+
+// s21::queue behind a mutex, the handoff the pipeline used before
+template <typename T>
+class locked_queue {
+ public:
+  bool try_push(const T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+    return true;
+  }
+  bool try_pop(T &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<T> queue_;
+};
+
+// one thread pushes kMessages ints, the other pops them; a side that finds
+// the queue full or empty yields, so both make progress on a single core
+template <typename Queue>
+double throughput() {
+  return s21_bench::measure(
+      [] {
+        Queue queue;
+        std::thread producer([&] {
+          for (int i = 0; i < kMessages; i++) {
+            while (!queue.try_push(i)) std::this_thread::yield();
+          }
+        });
+        long sum = 0;
+        for (int i = 0, value; i < kMessages; i++) {
+          while (!queue.try_pop(value)) std::this_thread::yield();
+          sum += value;
+        }
+        producer.join();
+        s21_bench::do_not_optimize(sum);
+      },
+      3);
+}
+
+// the same transfer in batches of 64
+double bulk_throughput() {
+  return s21_bench::measure(
+      [] {
+        s21::spsc_queue<int, 4096> queue;
+        std::thread producer([&] {
+          int batch[64];
+          for (int i = 0; i < kMessages;) {
+            int n = std::min(64, kMessages - i);
+            for (int j = 0; j < n; j++) batch[j] = i + j;
+            int pushed = static_cast<int>(queue.push_bulk(batch, n));
+            if (pushed == 0) std::this_thread::yield();
+            i += pushed;
+          }
+        });
+        long sum = 0;
+        int batch[64];
+        for (int i = 0; i < kMessages;) {
+          int n = static_cast<int>(queue.pop_bulk(batch, 64));
+          if (n == 0) std::this_thread::yield();
+          for (int j = 0; j < n; j++) sum += batch[j];
+          i += n;
+        }
+        producer.join();
+        s21_bench::do_not_optimize(sum);
+      },
+      3);
+}
+
+// bounces one message between two threads over a pair of queues; every
+// round trip is two handoffs
+template <typename Queue>
+double round_trips() {
+  return s21_bench::measure(
+      [] {
+        Queue ping, pong;
+        std::thread echo([&] {
+          for (int i = 0, value; i < kRoundTrips; i++) {
+            while (!ping.try_pop(value)) std::this_thread::yield();
+            while (!pong.try_push(value)) std::this_thread::yield();
+          }
+        });
+        for (int i = 0, value; i < kRoundTrips; i++) {
+          while (!ping.try_push(i)) std::this_thread::yield();
+          while (!pong.try_pop(value)) std::this_thread::yield();
+        }
+        echo.join();
+      },
+      3);
+}
+
+void report_mops(const std::string &name, double ms, double baseline) {
+  long mops = static_cast<long>(kMessages / ms / 1000);
+  s21_bench::report(name + ", " + std::to_string(mops) + " M msgs/s", ms,
+                    baseline);
+}
+
+void report_latency(const std::string &name, double ms, double baseline) {
+  long ns = static_cast<long>(ms * 1e6 / kRoundTrips);
+  s21_bench::report(name + ", " + std::to_string(ns) + " ns per trip", ms,
+                    baseline);
+}
+
+int main() {
+  s21_bench::section("two-thread handoff of " + std::to_string(kMessages) +
+                     " ints");
+  double baseline = throughput<locked_queue<int>>();
+  report_mops("mutex + s21::queue<int>", baseline, 0);
+  report_mops("s21::spsc_queue<int, 4096>",
+              throughput<s21::spsc_queue<int, 4096>>(), baseline);
+  report_mops("s21::spsc_queue<int, 4096> bulk 64", bulk_throughput(),
+              baseline);
+
+  s21_bench::section("round trip latency, " + std::to_string(kRoundTrips) +
+                     " ping-pongs");
+  baseline = round_trips<locked_queue<int>>();
+  report_latency("mutex + s21::queue<int>", baseline, 0);
+  report_latency("s21::spsc_queue<int, 64>",
+                 round_trips<s21::spsc_queue<int, 64>>(), baseline);
+  return 0;
+}
@@ -0,0 +1,79 @@
+#include <cstdint>
+
+#include "s21_bench.h"
+
+const int kRounds = 1000000;
+
+// builds kRounds short-lived vectors of 1..length elements each
+template <typename Vector>
+double short_lived(int length) {
+  return s21_bench::measure([length] {
+    for (int round = 0; round < kRounds; round++) {
+      Vector v;
+      for (int i = 0; i < (round % length) + 1; i++) v.push_back(round + i);
+      s21_bench::do_not_optimize(v.size());
+    }
+  });
+}
+
+// copies a 40-byte header kRounds times, changing one byte per copy
+template <typename Vector>
+double copy_headers() {
+  Vector header;
+  for (uint8_t i = 0; i < 40; i++) header.push_back(i);
+  return s21_bench::measure([&header] {
+    for (int round = 0; round < kRounds; round++) {
+      Vector copy(header);
+      copy[round % 40] ^= 1;
+      s21_bench::do_not_optimize(copy[0]);
+    }
+  });
+}
+
+// fills kRounds scratch buffers of 9000 bytes with a short packet each, the
+// way a per-core buffer is used; only the written bytes should cost anything
+template <typename Vector>
+double scratch_buffers() {
+  return s21_bench::measure([] {
+    for (int round = 0; round < kRounds; round++) {
+      Vector scratch;
+      for (int i = 0; i < 16; i++) scratch.push_back(uint8_t(round + i));
+      s21_bench::do_not_optimize(scratch[round % 16]);
+    }
+  });
+}
+
+int main() {
+  for (int length : {4, 16}) {
+    s21_bench::section(std::to_string(kRounds) + " vectors of 1.." +
+                       std::to_string(length) + " ints");
+    double slow = short_lived<s21::vector<int>>(length);
+    s21_bench::report("vector<int>", slow);
+    s21_bench::report("small_vector<int, 16>",
+                      short_lived<s21::small_vector<int, 16>>(length), slow);
+    s21_bench::report("static_vector<int, 16>",
+                      short_lived<s21::static_vector<int, 16>>(length), slow);
+    s21_bench::report(
+        "static_vector<int, 16, overflow_assert>",
+        short_lived<s21::static_vector<int, 16, s21::overflow_assert>>(
+            length),
+        slow);
+  }
+
+  s21_bench::section(std::to_string(kRounds) + " copies of a 40-byte header");
+  double slow = copy_headers<s21::vector<uint8_t>>();
+  s21_bench::report("vector<uint8_t>", slow);
+  s21_bench::report("small_vector<uint8_t, 64>",
+                    copy_headers<s21::small_vector<uint8_t, 64>>(), slow);
+  s21_bench::report("static_vector<uint8_t, 64>",
+                    copy_headers<s21::static_vector<uint8_t, 64>>(), slow);
+
+  s21_bench::section(std::to_string(kRounds) +
+                     " scratch buffers of 9000 bytes, 16 written");
+  slow = scratch_buffers<s21::vector<uint8_t>>();
+  s21_bench::report("vector<uint8_t>", slow);
+  s21_bench::report("static_vector<uint8_t, 9000>",
+                    scratch_buffers<s21::static_vector<uint8_t, 9000>>(),
+                    slow);
+  return 0;
+}
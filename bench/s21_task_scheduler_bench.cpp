@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <thread>
+
+#include "s21_bench.h"
+
+const size_t kSize = size_t{1} << 22;
+
+// thread counts 1, 2, 4, ... up to the hardware threads
+s21::vector<size_t> thread_counts() {
+  size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+  s21::vector<size_t> counts;
+  for (size_t n = 1; n < hardware; n *= 2) counts.push_back(n);
+  counts.push_back(hardware);
+  return counts;
+}
+
+s21::vector<int> make_data(size_t n) {
+  s21::vector<int> data;
+  data.reserve(n);
+  unsigned x = 1;
+  for (size_t i = 0; i < n; i++) {
+    x = x * 1103515245 + 12345;
+    data.push_back(static_cast<int>(x >> 1));
+  }
+  return data;
+}
+
+// fork-join quicksort: the lower part of every partition is spawned and the
+// upper part sorted in place, down to cutoff elements
+void quick_sort(s21::task_scheduler &scheduler, int *first, int *last,
+                ptrdiff_t cutoff) {
+  if (last - first <= cutoff) {
+    std::sort(first, last);
+    return;
+  }
+  int a = first[0], b = first[(last - first) / 2], c = last[-1];
+  int pivot = std::max(std::min(a, b), std::min(std::max(a, b), c));
+  int *middle = std::partition(first, last, [pivot](int x) {
+    return x < pivot;
+  });
+  int *upper = std::partition(middle, last, [pivot](int x) {
+    return !(pivot < x);
+  });
+  s21::task_group group(scheduler);
+  group.spawn([&scheduler, first, middle, cutoff] {
+    quick_sort(scheduler, first, middle, cutoff);
+  });
+  quick_sort(scheduler, upper, last, cutoff);
+  group.wait();
+}
+
+long fib(s21::task_scheduler &scheduler, int n) {
+  if (n < 2) return n;
+  long a = 0;
+  s21::task_group group(scheduler);
+  group.spawn([&] { a = fib(scheduler, n - 1); });
+  long b = fib(scheduler, n - 2);
+  group.wait();
+  return a + b;
+}
+
+long fib_serial(int n) {
+  return n < 2 ? n : fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+int main() {
+  const s21::vector<int> source = make_data(kSize);
+  s21::vector<int> data;
+
+  s21_bench::section("quicksort of 4M ints on s21::vector");
+  double baseline = s21_bench::measure(
+      [&] {
+        data = s21::vector<int>(source);
+        std::sort(data.begin(), data.end());
+      },
+      3);
+  s21_bench::report("std::sort", baseline);
+  for (size_t threads : thread_counts()) {
+    s21::thread_pool pool(threads);
+    s21::parallel::policy policy{&pool, 0};
+    double ms = s21_bench::measure(
+        [&] {
+          data = s21::vector<int>(source);
+          s21::parallel::sort(policy, data);
+        },
+        3);
+    s21_bench::report("s21::parallel::sort on thread_pool, " +
+                          std::to_string(threads) + " threads",
+                      ms, baseline);
+    s21::task_scheduler scheduler(threads);
+    for (ptrdiff_t cutoff : {ptrdiff_t{512}, ptrdiff_t{16384}}) {
+      ms = s21_bench::measure(
+          [&] {
+            data = s21::vector<int>(source);
+            quick_sort(scheduler, data.begin(), data.end(), cutoff);
+          },
+          3);
+      s21_bench::report("task_scheduler quicksort, " +
+                            std::to_string(threads) + " threads, cutoff " +
+                            std::to_string(cutoff),
+                        ms, baseline);
+    }
+  }
+
+  // nothing but spawn and wait: one task per call of a naive fib(25)
+  s21_bench::section("fork-join overhead, fib(25) with a task per call");
+  baseline = s21_bench::measure(
+      [] { s21_bench::do_not_optimize(fib_serial(25)); }, 3);
+  s21_bench::report("serial recursion", baseline);
+  for (size_t threads : thread_counts()) {
+    s21::task_scheduler scheduler(threads);
+    double ms = s21_bench::measure(
+        [&] { s21_bench::do_not_optimize(fib(scheduler, 25)); }, 3);
+    s21_bench::report("task_scheduler, " + std::to_string(threads) +
+                          " threads",
+                      ms, baseline);
+  }
+
+  // fine-grained loop: 65536 iterations of a few hundred ns each
+  s21_bench::section("parallel_for vs thread_pool::run, 65536 small tasks");
+  const size_t tasks = size_t{1} << 16;
+  auto body = [&](size_t i) {
+    long sum = 0;
+    for (size_t j = 0; j < 64; j++) sum += source[(i * 64 + j) % kSize];
+    s21_bench::do_not_optimize(sum);
+  };
+  baseline = s21_bench::measure(
+      [&] {
+        for (size_t i = 0; i < tasks; i++) body(i);
+      },
+      3);
+  s21_bench::report("serial loop", baseline);
+  for (size_t threads : thread_counts()) {
+    s21::thread_pool pool(threads);
+    double ms = s21_bench::measure([&] { pool.run(tasks, body); }, 3);
+    s21_bench::report("thread_pool::run, " + std::to_string(threads) +
+                          " threads",
+                      ms, baseline);
+    s21::task_scheduler scheduler(threads);
+    ms = s21_bench::measure([&] { scheduler.parallel_for(0, tasks, body); },
+                            3);
+    s21_bench::report("task_scheduler::parallel_for, " +
+                          std::to_string(threads) + " threads, grain auto",
+                      ms, baseline);
+  }
+  return 0;
+}
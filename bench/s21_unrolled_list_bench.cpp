@@ -0,0 +1,48 @@
+#include <list>
+#include <numeric>
+
+#include "s21_bench.h"
+
+// refills the list with n elements, sums them by iteration and inserts an
+// element before every fourth one; the s21::list run is the baseline
+template <typename List>
+void suite(const std::string &name, size_t n, double *baselines) {
+  List list;
+  double ms[3];
+  ms[0] = s21_bench::measure(
+      [&] {
+        list.clear();
+        for (size_t i = 0; i < n; i++) list.push_back(static_cast<int>(i));
+      },
+      3);
+  ms[1] = s21_bench::measure([&] {
+    long sum = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) sum += *it;
+    s21_bench::do_not_optimize(sum);
+  });
+  ms[2] = s21_bench::measure(
+      [&] {
+        size_t i = 0;
+        for (auto it = list.begin(); it != list.end(); ++it) {
+          if (++i % 4 == 0) it = list.insert(it, -1);
+        }
+      },
+      1);
+  const char *ops[] = {"push_back", "traverse", "insert every 4th"};
+  for (int op = 0; op < 3; op++) {
+    if (!baselines[op]) baselines[op] = ms[op];
+    s21_bench::report(name + " " + ops[op] + ", " + std::to_string(n), ms[op],
+                      baselines[op]);
+  }
+}
+
+int main() {
+  for (size_t n : {size_t{10000}, size_t{1000000}, size_t{10000000}}) {
+    s21_bench::section("list<int>, " + std::to_string(n) + " elements");
+    double baselines[3] = {0, 0, 0};
+    suite<s21::list<int>>("s21::list", n, baselines);
+    suite<std::list<int>>("std::list", n, baselines);
+    suite<s21::unrolled_list<int>>("s21::unrolled_list", n, baselines);
+  }
+  return 0;
+}
@@ -0,0 +1,39 @@
+#include "s21_bench.h"
+
+// appends `count` ints one by one and reports time, reallocations and bytes
+// copied for the growth policy
+template <typename Growth>
+double grow(const std::string &name, size_t count, double baseline) {
+  using vector = s21::vector<int, s21::growth_with_stats<Growth>>;
+  s21::vector_stats stats;
+  size_t capacity = 0;
+  double ms = s21_bench::measure(
+      [&] {
+        vector v;
+        for (size_t i = 0; i < count; i++) v.push_back(static_cast<int>(i));
+        s21_bench::do_not_optimize(v.data());
+        stats = v.stats();
+        capacity = v.capacity();
+      },
+      3);
+  s21_bench::report(name, ms, baseline);
+  std::printf(
+      "      reallocations %zu, remaps %zu, copied %zu MB, slack %zu MB\n",
+      stats.reallocations, stats.remaps, stats.bytes_copied >> 20,
+      (capacity - count) * sizeof(int) >> 20);
+  return ms;
+}
+
+int main() {
+  const size_t count = (size_t{1} << 25) + (size_t{1} << 18);
+  s21_bench::section("push_back of " + std::to_string(count) + " ints (" +
+                     std::to_string(count * sizeof(int) >> 20) + " MB)");
+  double slow = grow<s21::growth_double>("growth_double", count, 0);
+  grow<s21::growth_one_and_half>("growth_one_and_half", count, slow);
+  grow<s21::growth_fixed<(size_t{1} << 22)>>("growth_fixed<4M>", count, slow);
+  grow<s21::growth_large_buffers<>>("growth_large_buffers<growth_double>",
+                                    count, slow);
+  grow<s21::growth_large_buffers<s21::growth_fixed<(size_t{1} << 22)>>>(
+      "growth_large_buffers<growth_fixed<4M>>", count, slow);
+  return 0;
+}
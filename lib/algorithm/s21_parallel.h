@@ -0,0 +1,125 @@
+#ifndef S21_PARALLEL_H
+#define S21_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_memory.h"
+#include "../thread_pool/s21_task_scheduler.h"
+#include "../thread_pool/s21_thread_pool.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Parallel versions of standard algorithms over contiguous ranges.
+//
+// Every algorithm takes a pointer range or a contiguous container (vector,
+// array, small_vector), optionally preceded by a policy. The range is cut
+// into tasks of at least policy::grain elements that run on a thread_pool,
+// or on a task_scheduler when the policy names one.
+//
+// reduce() and inclusive_scan() combine the elements in an unspecified
+// grouping, so op must be associative. sort() and stable_sort() sort the
+// tasks' pieces and then merge neighbouring runs in parallel; stable_sort()
+// keeps equal elements in their original order.
+namespace parallel {
+
+// policy says where a parallel algorithm runs and how finely it splits work
+struct policy {
+  thread_pool *pool = nullptr;  // default_thread_pool() when null
+  size_t grain = 0;  // fewest elements per task, picked from the range size
+                     // and the pool size when 0
+  task_scheduler *scheduler = nullptr;  // runs the tasks by work stealing
+                                        // instead of on pool when set
+};
+
+template <typename C>
+using if_contiguous =
+    std::enable_if_t<is_contiguous_container<std::remove_const_t<C>>::value>;
+
+template <typename T, typename F>
+void for_each(const policy &p, T *first, T *last,
+              F fn);  // calls fn on every element
+template <typename T, typename F>
+void for_each(T *first, T *last, F fn);
+template <typename C, typename F, typename = if_contiguous<C>>
+void for_each(const policy &p, C &c, F fn);
+template <typename C, typename F, typename = if_contiguous<C>>
+void for_each(C &c, F fn);
+
+template <typename T, typename U, typename F>
+U *transform(const policy &p, const T *first, const T *last, U *d_first,
+             F op);  // writes op(x) for every x to d_first and returns the
+                     // end of the output
+template <typename T, typename U, typename F>
+U *transform(const T *first, const T *last, U *d_first, F op);
+template <typename In, typename Out, typename F, typename = if_contiguous<In>,
+          typename = if_contiguous<Out>>
+void transform(const policy &p, const In &in, Out &out,
+               F op);  // out needs at least in.size() elements
+template <typename In, typename Out, typename F, typename = if_contiguous<In>,
+          typename = if_contiguous<Out>>
+void transform(const In &in, Out &out, F op);
+
+template <typename T, typename U, typename Op = std::plus<>>
+U reduce(const policy &p, const T *first, const T *last, U init,
+         Op op = Op());  // combines init and the elements with op
+template <typename T, typename U, typename Op = std::plus<>>
+U reduce(const T *first, const T *last, U init, Op op = Op());
+template <typename C, typename U, typename Op = std::plus<>,
+          typename = if_contiguous<C>>
+U reduce(const policy &p, const C &c, U init, Op op = Op());
+template <typename C, typename U, typename Op = std::plus<>,
+          typename = if_contiguous<C>>
+U reduce(const C &c, U init, Op op = Op());
+
+template <typename T, typename U, typename Op = std::plus<>>
+U *inclusive_scan(const policy &p, const T *first, const T *last, U *d_first,
+                  Op op = Op());  // writes the running op-sums of the
+                                  // elements to d_first, which may be first
+template <typename T, typename U, typename Op = std::plus<>>
+U *inclusive_scan(const T *first, const T *last, U *d_first, Op op = Op());
+template <typename In, typename Out, typename Op = std::plus<>,
+          typename = if_contiguous<In>, typename = if_contiguous<Out>>
+void inclusive_scan(const policy &p, const In &in, Out &out,
+                    Op op = Op());  // out needs at least in.size() elements
+template <typename In, typename Out, typename Op = std::plus<>,
+          typename = if_contiguous<In>, typename = if_contiguous<Out>>
+void inclusive_scan(const In &in, Out &out, Op op = Op());
+
+template <typename T, typename Compare = std::less<>>
+void sort(const policy &p, T *first, T *last,
+          Compare comp = Compare());  // sorts the range by comp
+template <typename T, typename Compare = std::less<>>
+void sort(T *first, T *last, Compare comp = Compare());
+template <typename C, typename Compare = std::less<>,
+          typename = if_contiguous<C>>
+void sort(const policy &p, C &c, Compare comp = Compare());
+template <typename C, typename Compare = std::less<>,
+          typename = if_contiguous<C>>
+void sort(C &c, Compare comp = Compare());
+
+template <typename T, typename Compare = std::less<>>
+void stable_sort(const policy &p, T *first, T *last,
+                 Compare comp = Compare());  // sorts the range by comp,
+                                             // keeping the order of equals
+template <typename T, typename Compare = std::less<>>
+void stable_sort(T *first, T *last, Compare comp = Compare());
+template <typename C, typename Compare = std::less<>,
+          typename = if_contiguous<C>>
+void stable_sort(const policy &p, C &c, Compare comp = Compare());
+template <typename C, typename Compare = std::less<>,
+          typename = if_contiguous<C>>
+void stable_sort(C &c, Compare comp = Compare());
+
+}  // namespace parallel
+}  // namespace s21
+
+#include "s21_parallel.tpp"
+
+#endif
@@ -0,0 +1,331 @@
+namespace s21 {
+namespace parallel {
+namespace detail {
+
+// smallest automatic grain; shorter tasks cost more to hand out than to run
+constexpr size_t kMinGrain = size_t{1} << 12;
+
+// where a policy runs its tasks: the scheduler when it is set, the pool
+// otherwise; both share run() and size()
+class executor {
+ public:
+  explicit executor(const policy &p) : pool_(p.pool), scheduler_(p.scheduler) {
+    if (!pool_ && !scheduler_) pool_ = &default_thread_pool();
+  }
+
+  size_t size() const noexcept {
+    return scheduler_ ? scheduler_->size() : pool_->size();
+  }
+
+  template <typename F>
+  void run(size_t tasks, F &&fn) {
+    if (scheduler_) {
+      scheduler_->run(tasks, std::forward<F>(fn));
+    } else {
+      pool_->run(tasks, std::forward<F>(fn));
+    }
+  }
+
+ private:
+  thread_pool *pool_;
+  task_scheduler *scheduler_;
+};
+
+inline executor pool_of(const policy &p) { return executor(p); }
+
+// number of tasks for n elements: about four per thread, so that uneven
+// tasks still keep every thread busy, and one on a single-threaded pool
+inline size_t task_count(const policy &p, const executor &pool, size_t n) {
+  if (n == 0) return 0;
+  if (pool.size() == 1) return 1;
+  size_t grain = p.grain;
+  if (grain == 0) {
+    size_t per_thread = (n + pool.size() * 4 - 1) / (pool.size() * 4);
+    grain = std::max(kMinGrain, per_thread);
+  }
+  return (n + grain - 1) / grain;
+}
+
+// start of task i when n elements are split into tasks near-equal parts
+inline size_t task_begin(size_t n, size_t tasks, size_t i) {
+  return static_cast<size_t>(static_cast<unsigned long long>(n) * i / tasks);
+}
+
+template <typename Out>
+void check_output(size_t in_size, const Out &out) {
+  if (out.size() < in_size) {
+    throw std::out_of_range("Error! Output range is shorter than the input");
+  }
+}
+
+// Finds how many of the first `out` merged elements come from a, so that a
+// merge can start in the middle. Ties go to a first, as in std::merge.
+template <typename T, typename Compare>
+size_t merge_split(const T *a, size_t a_size, const T *b, size_t b_size,
+                   size_t out, Compare &comp) {
+  size_t lo = out > b_size ? out - b_size : 0;
+  size_t hi = std::min(out, a_size);
+  while (lo < hi) {
+    size_t i = lo + (hi - lo) / 2;
+    size_t j = out - i;
+    if (j > 0 && i < a_size && !comp(b[j - 1], a[i])) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+// sorts runs of the range in parallel, then merges neighbouring runs
+// through a buffer, each merge split into parallel pieces
+template <bool Stable, typename T, typename Compare>
+void merge_sort(const policy &p, T *first, T *last, Compare comp) {
+  executor pool = pool_of(p);
+  size_t n = static_cast<size_t>(last - first);
+  size_t runs = std::min(task_count(p, pool, n), pool.size());
+  auto sort_run = [&comp](T *run_first, T *run_last) {
+    if constexpr (Stable) {
+      std::stable_sort(run_first, run_last, comp);
+    } else {
+      std::sort(run_first, run_last, comp);
+    }
+  };
+  if (runs <= 1) {
+    sort_run(first, last);
+    return;
+  }
+
+  vector<size_t> bounds;
+  for (size_t i = 0; i <= runs; i++) bounds.push_back(task_begin(n, runs, i));
+  pool.run(runs, [&](size_t i) {
+    sort_run(first + bounds[i], first + bounds[i + 1]);
+  });
+
+  // the sorted runs move to the buffer, and merges alternate between the
+  // buffer and the range
+  vector<T> buffer;
+  buffer.assign(std::make_move_iterator(first), std::make_move_iterator(last));
+  T *src = buffer.data();
+  T *dst = first;
+  while (runs > 1) {
+    size_t pairs = (runs + 1) / 2;
+    size_t pieces = std::max<size_t>(1, pool.size() / pairs);
+    pool.run(pairs * pieces, [&](size_t task) {
+      size_t pair = task / pieces, piece = task % pieces;
+      size_t a_begin = bounds[2 * pair];
+      size_t b_begin = bounds[std::min(2 * pair + 1, runs)];
+      size_t b_end = bounds[std::min(2 * pair + 2, runs)];
+      const T *a = src + a_begin, *b = src + b_begin;
+      size_t a_size = b_begin - a_begin, b_size = b_end - b_begin;
+      size_t out_begin = task_begin(a_size + b_size, pieces, piece);
+      size_t out_end = task_begin(a_size + b_size, pieces, piece + 1);
+      size_t i = merge_split(a, a_size, b, b_size, out_begin, comp);
+      size_t i_end = merge_split(a, a_size, b, b_size, out_end, comp);
+      std::merge(std::make_move_iterator(src + a_begin + i),
+                 std::make_move_iterator(src + a_begin + i_end),
+                 std::make_move_iterator(src + b_begin + (out_begin - i)),
+                 std::make_move_iterator(src + b_begin + (out_end - i_end)),
+                 dst + a_begin + out_begin, comp);
+    });
+    for (size_t i = 0; i <= pairs; i++) {
+      bounds[i] = bounds[std::min(2 * i, runs)];
+    }
+    runs = pairs;
+    std::swap(src, dst);
+  }
+  if (src != first) {
+    parallel::for_each(p, first, last, [first, src](T &x) {
+      x = std::move(src[&x - first]);
+    });
+  }
+}
+
+}  // namespace detail
+
+template <typename T, typename F>
+void for_each(const policy &p, T *first, T *last, F fn) {
+  detail::executor pool = detail::pool_of(p);
+  size_t n = static_cast<size_t>(last - first);
+  size_t tasks = detail::task_count(p, pool, n);
+  pool.run(tasks, [&](size_t i) {
+    T *end = first + detail::task_begin(n, tasks, i + 1);
+    for (T *it = first + detail::task_begin(n, tasks, i); it != end; ++it) {
+      fn(*it);
+    }
+  });
+}
+
+template <typename T, typename F>
+void for_each(T *first, T *last, F fn) {
+  for_each(policy(), first, last, std::move(fn));
+}
+
+template <typename C, typename F, typename>
+void for_each(const policy &p, C &c, F fn) {
+  for_each(p, c.begin(), c.end(), std::move(fn));
+}
+
+template <typename C, typename F, typename>
+void for_each(C &c, F fn) {
+  for_each(policy(), c.begin(), c.end(), std::move(fn));
+}
+
+template <typename T, typename U, typename F>
+U *transform(const policy &p, const T *first, const T *last, U *d_first,
+             F op) {
+  detail::executor pool = detail::pool_of(p);
+  size_t n = static_cast<size_t>(last - first);
+  size_t tasks = detail::task_count(p, pool, n);
+  pool.run(tasks, [&](size_t i) {
+    size_t end = detail::task_begin(n, tasks, i + 1);
+    for (size_t k = detail::task_begin(n, tasks, i); k != end; k++) {
+      d_first[k] = op(first[k]);
+    }
+  });
+  return d_first + n;
+}
+
+template <typename T, typename U, typename F>
+U *transform(const T *first, const T *last, U *d_first, F op) {
+  return transform(policy(), first, last, d_first, std::move(op));
+}
+
+template <typename In, typename Out, typename F, typename, typename>
+void transform(const policy &p, const In &in, Out &out, F op) {
+  detail::check_output(in.size(), out);
+  transform(p, in.begin(), in.end(), out.begin(), std::move(op));
+}
+
+template <typename In, typename Out, typename F, typename, typename>
+void transform(const In &in, Out &out, F op) {
+  transform(policy(), in, out, std::move(op));
+}
+
+template <typename T, typename U, typename Op>
+U reduce(const policy &p, const T *first, const T *last, U init, Op op) {
+  detail::executor pool = detail::pool_of(p);
+  size_t n = static_cast<size_t>(last - first);
+  size_t tasks = detail::task_count(p, pool, n);
+  vector<U> partials;
+  partials.resize(tasks, init);
+  pool.run(tasks, [&](size_t i) {
+    size_t k = detail::task_begin(n, tasks, i);
+    size_t end = detail::task_begin(n, tasks, i + 1);
+    U acc = first[k];
+    for (k++; k != end; k++) acc = op(std::move(acc), first[k]);
+    partials[i] = std::move(acc);
+  });
+  for (size_t i = 0; i < tasks; i++) init = op(std::move(init), partials[i]);
+  return init;
+}
+
+template <typename T, typename U, typename Op>
+U reduce(const T *first, const T *last, U init, Op op) {
+  return reduce(policy(), first, last, std::move(init), std::move(op));
+}
+
+template <typename C, typename U, typename Op, typename>
+U reduce(const policy &p, const C &c, U init, Op op) {
+  return reduce(p, c.begin(), c.end(), std::move(init), std::move(op));
+}
+
+template <typename C, typename U, typename Op, typename>
+U reduce(const C &c, U init, Op op) {
+  return reduce(policy(), c.begin(), c.end(), std::move(init), std::move(op));
+}
+
+// The first pass sums every task's piece, the running totals of those sums
+// give each piece its starting value, and the second pass scans the pieces
+// from there. A single task scans in one pass.
+template <typename T, typename U, typename Op>
+U *inclusive_scan(const policy &p, const T *first, const T *last, U *d_first,
+                  Op op) {
+  detail::executor pool = detail::pool_of(p);
+  size_t n = static_cast<size_t>(last - first);
+  size_t tasks = detail::task_count(p, pool, n);
+  if (tasks == 0) return d_first;
+
+  vector<U> carry;
+  if (tasks > 1) {
+    carry.resize(tasks, U(first[0]));
+    pool.run(tasks - 1, [&](size_t i) {
+      size_t k = detail::task_begin(n, tasks, i);
+      size_t end = detail::task_begin(n, tasks, i + 1);
+      U acc = first[k];
+      for (k++; k != end; k++) acc = op(std::move(acc), first[k]);
+      carry[i + 1] = std::move(acc);
+    });
+    for (size_t i = 2; i < tasks; i++) carry[i] = op(carry[i - 1], carry[i]);
+  }
+  pool.run(tasks, [&](size_t i) {
+    size_t k = detail::task_begin(n, tasks, i);
+    size_t end = detail::task_begin(n, tasks, i + 1);
+    U acc = i == 0 ? U(first[k]) : op(carry[i], first[k]);
+    d_first[k] = acc;
+    for (k++; k != end; k++) {
+      acc = op(std::move(acc), first[k]);
+      d_first[k] = acc;
+    }
+  });
+  return d_first + n;
+}
+
+template <typename T, typename U, typename Op>
+U *inclusive_scan(const T *first, const T *last, U *d_first, Op op) {
+  return inclusive_scan(policy(), first, last, d_first, std::move(op));
+}
+
+template <typename In, typename Out, typename Op, typename, typename>
+void inclusive_scan(const policy &p, const In &in, Out &out, Op op) {
+  detail::check_output(in.size(), out);
+  inclusive_scan(p, in.begin(), in.end(), out.begin(), std::move(op));
+}
+
+template <typename In, typename Out, typename Op, typename, typename>
+void inclusive_scan(const In &in, Out &out, Op op) {
+  inclusive_scan(policy(), in, out, std::move(op));
+}
+
+template <typename T, typename Compare>
+void sort(const policy &p, T *first, T *last, Compare comp) {
+  detail::merge_sort<false>(p, first, last, std::move(comp));
+}
+
+template <typename T, typename Compare>
+void sort(T *first, T *last, Compare comp) {
+  sort(policy(), first, last, std::move(comp));
+}
+
+template <typename C, typename Compare, typename>
+void sort(const policy &p, C &c, Compare comp) {
+  sort(p, c.begin(), c.end(), std::move(comp));
+}
+
+template <typename C, typename Compare, typename>
+void sort(C &c, Compare comp) {
+  sort(policy(), c.begin(), c.end(), std::move(comp));
+}
+
+template <typename T, typename Compare>
+void stable_sort(const policy &p, T *first, T *last, Compare comp) {
+  detail::merge_sort<true>(p, first, last, std::move(comp));
+}
+
+template <typename T, typename Compare>
+void stable_sort(T *first, T *last, Compare comp) {
+  stable_sort(policy(), first, last, std::move(comp));
+}
+
+template <typename C, typename Compare, typename>
+void stable_sort(const policy &p, C &c, Compare comp) {
+  stable_sort(p, c.begin(), c.end(), std::move(comp));
+}
+
+template <typename C, typename Compare, typename>
+void stable_sort(C &c, Compare comp) {
+  stable_sort(policy(), c.begin(), c.end(), std::move(comp));
+}
+
+}  // namespace parallel
+}  // namespace s21
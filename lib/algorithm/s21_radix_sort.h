@@ -0,0 +1,77 @@
+#ifndef S21_RADIX_SORT_H
+#define S21_RADIX_SORT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_memory.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// LSD radix sort on 8-bit digits for integer and IEEE floating point keys.
+//
+// Keys are mapped to unsigned integers of the same width whose order is the
+// key order (radix_key), so one sort covers unsigned, signed and floating
+// keys. A single pass over the keys builds the histograms of every digit;
+// digits that are the same for all keys are skipped. Each remaining digit
+// costs one stable scatter pass, so sorting n w-byte keys takes O(n * w).
+//
+// Elements can be arithmetic values or any type sorted by a key extractor
+// that returns an arithmetic key, e.g. [](const Item &x) { return x.id; }.
+// The sort is stable. Floating keys order -0.0 before +0.0 and put NaNs
+// with the sign bit clear after +infinity.
+
+// radix_key<K> maps a key of type K to its unsigned radix image
+template <typename K, typename = void>
+struct radix_key;
+
+template <typename K>
+struct radix_key<K, std::enable_if_t<std::is_integral<K>::value &&
+                                     !std::is_same<K, bool>::value>> {
+  using type = std::make_unsigned_t<K>;
+  static constexpr type encode(K key) noexcept {
+    if constexpr (std::is_signed<K>::value) {
+      return static_cast<type>(key) ^ (type{1} << (sizeof(K) * 8 - 1));
+    } else {
+      return key;
+    }
+  }
+};
+
+template <typename K>
+struct radix_key<K, std::enable_if_t<std::is_floating_point<K>::value &&
+                                     (sizeof(K) == 4 || sizeof(K) == 8)>> {
+  using type = std::conditional_t<sizeof(K) == 4, uint32_t, uint64_t>;
+  static type encode(K key) noexcept {
+    type bits;
+    std::memcpy(&bits, &key, sizeof(K));
+    const type sign = type{1} << (sizeof(K) * 8 - 1);
+    return (bits & sign) ? ~bits : bits | sign;
+  }
+};
+
+// the key extractor radix_sort uses for arithmetic elements
+struct radix_identity {
+  template <typename T>
+  constexpr const T &operator()(const T &value) const noexcept {
+    return value;
+  }
+};
+
+template <typename T, typename KeyFn = radix_identity>
+void radix_sort(T *first, T *last,
+                KeyFn key = KeyFn());  // sorts [first, last) by key
+template <typename C, typename KeyFn = radix_identity,
+          typename = std::enable_if_t<is_contiguous_container<C>::value>>
+void radix_sort(C &c, KeyFn key = KeyFn());  // sorts a contiguous container
+
+}  // namespace s21
+
+#include "s21_radix_sort.tpp"
+
+#endif
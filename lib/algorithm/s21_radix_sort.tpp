@@ -0,0 +1,94 @@
+namespace s21 {
+namespace radix_detail {
+
+template <typename T, typename KeyFn>
+using key_of = std::decay_t<std::invoke_result_t<KeyFn &, const T &>>;
+
+template <typename T, typename KeyFn>
+using image_of = typename radix_key<key_of<T, KeyFn>>::type;
+
+// one histogram of 2^Bits buckets per Bits-wide digit of the key image
+template <typename U, unsigned Bits = 8>
+struct histograms {
+  static constexpr size_t kDigits = (sizeof(U) * 8 + Bits - 1) / Bits;
+  static constexpr size_t kRadix = size_t{1} << Bits;
+
+  histograms() { count.resize(kDigits * kRadix, 0); }
+
+  static size_t digit(U image, size_t d) noexcept {
+    return static_cast<size_t>(image >> (Bits * d)) & (kRadix - 1);
+  }
+
+  void add(U image) noexcept {
+    for (size_t d = 0; d < kDigits; d++) count[d * kRadix + digit(image, d)]++;
+  }
+
+  // a digit can be skipped when every key has the same value in it
+  bool same_everywhere(size_t d, size_t n) const noexcept {
+    const size_t *bucket = count.begin() + d * kRadix;
+    while (*bucket == 0) bucket++;
+    return *bucket == n;
+  }
+
+  // turns the counts of digit d into the start offsets of its buckets
+  size_t *offsets(size_t d) noexcept {
+    size_t *bucket = count.begin() + d * kRadix;
+    size_t total = 0;
+    for (size_t v = 0; v < kRadix; v++) {
+      size_t n = bucket[v];
+      bucket[v] = total;
+      total += n;
+    }
+    return bucket;
+  }
+
+  vector<size_t> count;
+};
+
+}  // namespace radix_detail
+
+template <typename T, typename KeyFn>
+void radix_sort(T *first, T *last, KeyFn key) {
+  using U = radix_detail::image_of<T, KeyFn>;
+  using Key = radix_detail::key_of<T, KeyFn>;
+  const size_t n = static_cast<size_t>(last - first);
+  if (n < 2) return;
+
+  radix_detail::histograms<U> hist;
+  for (T *it = first; it != last; ++it) {
+    hist.add(radix_key<Key>::encode(key(*it)));
+  }
+
+  vector<T> buffer;
+  bool buffered = false;
+  T *src = first;
+  T *dst = nullptr;
+  for (size_t d = 0; d < hist.kDigits; d++) {
+    if (hist.same_everywhere(d, n)) continue;
+    if (!buffered) {
+      // the buffer starts as a copy of the range so that every scatter
+      // writes to live objects
+      buffer.assign(std::make_move_iterator(first),
+                    std::make_move_iterator(last));
+      src = buffer.data();
+      dst = first;
+      buffered = true;
+    }
+    size_t *offset = hist.offsets(d);
+    for (size_t i = 0; i < n; i++) {
+      U image = radix_key<Key>::encode(key(src[i]));
+      dst[offset[hist.digit(image, d)]++] = std::move(src[i]);
+    }
+    std::swap(src, dst);
+  }
+  if (buffered && src != first) {
+    std::move(src, src + n, first);
+  }
+}
+
+template <typename C, typename KeyFn, typename>
+void radix_sort(C &c, KeyFn key) {
+  radix_sort(c.begin(), c.end(), std::move(key));
+}
+
+}  // namespace s21
@@ -0,0 +1,100 @@
+#ifndef S21_SIMD_H
+#define S21_SIMD_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../s21_memory.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define S21_SIMD_X86 1
+#else
+#define S21_SIMD_X86 0
+#endif
+
+namespace s21 {
+
+// Vectorized search and reduction kernels for contiguous ranges.
+//
+// int32_t, float and double ranges run SSE2 or AVX2 kernels, picked at run
+// time from what the CPU supports. Every other arithmetic type, and every
+// type on non-x86 targets, runs a scalar loop with the same results.
+//
+// Each function takes either a pointer range or a contiguous container
+// (s21::vector, s21::array, s21::small_vector).
+//
+// Floating point sums add the elements in a different order than a plain
+// loop, so the last bits of the result can differ from std::accumulate.
+// min() and max() of a range that holds NaN are unspecified.
+namespace simd {
+
+// instruction sets the kernels can use, weakest first
+enum class isa { scalar, sse2, avx2 };
+
+isa supported_isa() noexcept;  // best instruction set of this CPU
+isa active_isa() noexcept;     // instruction set the kernels use now
+void limit_isa(isa max) noexcept;  // keeps the kernels at or below max, for
+                                   // tests and benchmarks
+
+// sum_type<T> is the result type of sum(): 64-bit integers for integral T,
+// T itself for floating point T
+template <typename T>
+using sum_type = std::conditional_t<
+    std::is_integral<T>::value,
+    std::conditional_t<std::is_signed<T>::value, int64_t, uint64_t>, T>;
+
+// keeps a parameter out of template argument deduction
+template <typename T>
+struct identity {
+  using type = T;
+};
+template <typename T>
+using identity_t = typename identity<T>::type;
+
+template <typename T>
+const T *find(const T *first, const T *last,
+              const identity_t<T> &value);  // first element equal to value,
+                                            // or last
+template <typename T>
+size_t count(const T *first, const T *last,
+             const identity_t<T> &value);  // number of elements equal to value
+template <typename T>
+T min(const T *first, const T *last);  // smallest element, throws
+                                       // std::out_of_range on an empty range
+template <typename T>
+T max(const T *first, const T *last);  // largest element, throws
+                                       // std::out_of_range on an empty range
+template <typename T>
+sum_type<T> sum(const T *first, const T *last);  // sum of the elements
+template <typename T>
+bool any_greater(const T *first, const T *last,
+                 const identity_t<T> &threshold);  // checks whether some
+                                                   // element is > threshold
+
+template <typename Container>
+typename Container::const_iterator find(
+    const Container &c, const typename Container::value_type &value);
+template <typename Container>
+size_t count(const Container &c, const typename Container::value_type &value);
+template <typename Container>
+typename Container::value_type min(const Container &c);
+template <typename Container>
+typename Container::value_type max(const Container &c);
+template <typename Container>
+sum_type<typename Container::value_type> sum(const Container &c);
+template <typename Container>
+bool any_greater(const Container &c,
+                 const typename Container::value_type &threshold);
+
+}  // namespace simd
+}  // namespace s21
+
+#include "s21_simd.tpp"
+
+#endif
@@ -0,0 +1,212 @@
+#include "s21_simd_ops.tpp"
+
+namespace s21 {
+namespace simd {
+namespace detail {
+
+// upper bound set by limit_isa()
+inline std::atomic<isa> isa_limit{isa::avx2};
+
+// true for the element types that have SSE2 and AVX2 kernels
+template <typename T>
+struct has_kernels
+    : std::integral_constant<bool, S21_SIMD_X86 &&
+                                       (std::is_same<T, int32_t>::value ||
+                                        std::is_same<T, float>::value ||
+                                        std::is_same<T, double>::value)> {};
+
+}  // namespace detail
+
+inline isa supported_isa() noexcept {
+#if S21_SIMD_X86
+  static const isa best = [] {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? isa::avx2 : isa::sse2;
+  }();
+  return best;
+#else
+  return isa::scalar;
+#endif
+}
+
+inline isa active_isa() noexcept {
+  return std::min(supported_isa(),
+                  detail::isa_limit.load(std::memory_order_relaxed));
+}
+
+inline void limit_isa(isa max) noexcept {
+  detail::isa_limit.store(max, std::memory_order_relaxed);
+}
+
+// Each function below runs the kernel of the active instruction set when T
+// has kernels and falls through to the scalar loop otherwise.
+
+template <typename T>
+const T *find(const T *first, const T *last, const identity_t<T> &value) {
+#if S21_SIMD_X86
+  if constexpr (detail::has_kernels<T>::value) {
+    switch (active_isa()) {
+      case isa::avx2:
+        return detail::avx2::find(first, last, value);
+      case isa::sse2:
+        return detail::sse2::find(first, last, value);
+      default:
+        break;
+    }
+  }
+#endif
+  for (; first != last; ++first) {
+    if (*first == value) return first;
+  }
+  return last;
+}
+
+template <typename T>
+size_t count(const T *first, const T *last, const identity_t<T> &value) {
+#if S21_SIMD_X86
+  if constexpr (detail::has_kernels<T>::value) {
+    switch (active_isa()) {
+      case isa::avx2:
+        return detail::avx2::count(first, last, value);
+      case isa::sse2:
+        return detail::sse2::count(first, last, value);
+      default:
+        break;
+    }
+  }
+#endif
+  size_t total = 0;
+  for (; first != last; ++first) total += (*first == value);
+  return total;
+}
+
+template <typename T>
+T min(const T *first, const T *last) {
+  if (first == last) throw std::out_of_range("simd::min - Range is empty");
+#if S21_SIMD_X86
+  if constexpr (detail::has_kernels<T>::value) {
+    switch (active_isa()) {
+      case isa::avx2:
+        return detail::avx2::extreme<false>(first, last);
+      case isa::sse2:
+        return detail::sse2::extreme<false>(first, last);
+      default:
+        break;
+    }
+  }
+#endif
+  T result = *first;
+  for (++first; first != last; ++first) {
+    if (*first < result) result = *first;
+  }
+  return result;
+}
+
+template <typename T>
+T max(const T *first, const T *last) {
+  if (first == last) throw std::out_of_range("simd::max - Range is empty");
+#if S21_SIMD_X86
+  if constexpr (detail::has_kernels<T>::value) {
+    switch (active_isa()) {
+      case isa::avx2:
+        return detail::avx2::extreme<true>(first, last);
+      case isa::sse2:
+        return detail::sse2::extreme<true>(first, last);
+      default:
+        break;
+    }
+  }
+#endif
+  T result = *first;
+  for (++first; first != last; ++first) {
+    if (result < *first) result = *first;
+  }
+  return result;
+}
+
+template <typename T>
+sum_type<T> sum(const T *first, const T *last) {
+#if S21_SIMD_X86
+  if constexpr (detail::has_kernels<T>::value) {
+    switch (active_isa()) {
+      case isa::avx2:
+        return detail::avx2::sum(first, last);
+      case isa::sse2:
+        return detail::sse2::sum(first, last);
+      default:
+        break;
+    }
+  }
+#endif
+  sum_type<T> total = 0;
+  for (; first != last; ++first) total += *first;
+  return total;
+}
+
+template <typename T>
+bool any_greater(const T *first, const T *last,
+                 const identity_t<T> &threshold) {
+#if S21_SIMD_X86
+  if constexpr (detail::has_kernels<T>::value) {
+    switch (active_isa()) {
+      case isa::avx2:
+        return detail::avx2::any_greater(first, last, threshold);
+      case isa::sse2:
+        return detail::sse2::any_greater(first, last, threshold);
+      default:
+        break;
+    }
+  }
+#endif
+  for (; first != last; ++first) {
+    if (*first > threshold) return true;
+  }
+  return false;
+}
+
+template <typename Container>
+typename Container::const_iterator find(
+    const Container &c, const typename Container::value_type &value) {
+  static_assert(is_contiguous_container<Container>::value,
+                "simd::find needs a contiguous container");
+  return find(c.begin(), c.end(), value);
+}
+
+template <typename Container>
+size_t count(const Container &c, const typename Container::value_type &value) {
+  static_assert(is_contiguous_container<Container>::value,
+                "simd::count needs a contiguous container");
+  return count(c.begin(), c.end(), value);
+}
+
+template <typename Container>
+typename Container::value_type min(const Container &c) {
+  static_assert(is_contiguous_container<Container>::value,
+                "simd::min needs a contiguous container");
+  return min(c.begin(), c.end());
+}
+
+template <typename Container>
+typename Container::value_type max(const Container &c) {
+  static_assert(is_contiguous_container<Container>::value,
+                "simd::max needs a contiguous container");
+  return max(c.begin(), c.end());
+}
+
+template <typename Container>
+sum_type<typename Container::value_type> sum(const Container &c) {
+  static_assert(is_contiguous_container<Container>::value,
+                "simd::sum needs a contiguous container");
+  return sum(c.begin(), c.end());
+}
+
+template <typename Container>
+bool any_greater(const Container &c,
+                 const typename Container::value_type &threshold) {
+  static_assert(is_contiguous_container<Container>::value,
+                "simd::any_greater needs a contiguous container");
+  return any_greater(c.begin(), c.end(), threshold);
+}
+
+}  // namespace simd
+}  // namespace s21
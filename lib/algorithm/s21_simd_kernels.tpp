@@ -0,0 +1,149 @@
+// Generic kernels for one instruction set. This file has no include guard:
+// s21_simd_ops.tpp includes it once per instruction set, inside a namespace
+// that defines ops<T> for that set and under the matching target pragma.
+//
+// ops<T> provides:
+//   lanes                    elements per register
+//   load, set1               register from memory or from one value
+//   cmpeq, cmpgt, mask_or    lane masks
+//   movemask                 one bit per lane of a mask
+//   count_zero, count_add,   per-lane match counters
+//   count_total
+//   min, max, reduce_min,    lane-wise and horizontal extremes
+//   reduce_max
+//   sum_zero, sum_add,       wide per-lane accumulators
+//   sum_merge, reduce_sum
+//
+// The loops run four independent registers so that consecutive iterations
+// do not wait on each other.
+
+// lane counters are added up before they could overflow
+constexpr ptrdiff_t kCountBlock = ptrdiff_t{1} << 24;
+
+template <typename T>
+const T *find(const T *first, const T *last, T value) {
+  using O = ops<T>;
+  constexpr ptrdiff_t W = O::lanes;
+  const auto needle = O::set1(value);
+  for (; last - first >= 4 * W; first += 4 * W) {
+    auto m0 = O::cmpeq(O::load(first), needle);
+    auto m1 = O::cmpeq(O::load(first + W), needle);
+    auto m2 = O::cmpeq(O::load(first + 2 * W), needle);
+    auto m3 = O::cmpeq(O::load(first + 3 * W), needle);
+    if (O::movemask(O::mask_or(O::mask_or(m0, m1), O::mask_or(m2, m3)))) break;
+  }
+  for (; last - first >= W; first += W) {
+    int bits = O::movemask(O::cmpeq(O::load(first), needle));
+    if (bits) return first + __builtin_ctz(static_cast<unsigned>(bits));
+  }
+  for (; first != last; ++first) {
+    if (*first == value) return first;
+  }
+  return last;
+}
+
+template <typename T>
+bool any_greater(const T *first, const T *last, T threshold) {
+  using O = ops<T>;
+  constexpr ptrdiff_t W = O::lanes;
+  const auto limit = O::set1(threshold);
+  for (; last - first >= 4 * W; first += 4 * W) {
+    auto m0 = O::cmpgt(O::load(first), limit);
+    auto m1 = O::cmpgt(O::load(first + W), limit);
+    auto m2 = O::cmpgt(O::load(first + 2 * W), limit);
+    auto m3 = O::cmpgt(O::load(first + 3 * W), limit);
+    if (O::movemask(O::mask_or(O::mask_or(m0, m1), O::mask_or(m2, m3)))) {
+      return true;
+    }
+  }
+  for (; last - first >= W; first += W) {
+    if (O::movemask(O::cmpgt(O::load(first), limit))) return true;
+  }
+  for (; first != last; ++first) {
+    if (*first > threshold) return true;
+  }
+  return false;
+}
+
+template <typename T>
+size_t count(const T *first, const T *last, T value) {
+  using O = ops<T>;
+  constexpr ptrdiff_t W = O::lanes;
+  const auto needle = O::set1(value);
+  size_t total = 0;
+  while (last - first >= W) {
+    const T *block_end =
+        first + std::min((last - first) / W, kCountBlock / 4) * W;
+    auto c0 = O::count_zero(), c1 = O::count_zero();
+    auto c2 = O::count_zero(), c3 = O::count_zero();
+    for (; block_end - first >= 4 * W; first += 4 * W) {
+      c0 = O::count_add(c0, O::cmpeq(O::load(first), needle));
+      c1 = O::count_add(c1, O::cmpeq(O::load(first + W), needle));
+      c2 = O::count_add(c2, O::cmpeq(O::load(first + 2 * W), needle));
+      c3 = O::count_add(c3, O::cmpeq(O::load(first + 3 * W), needle));
+    }
+    for (; first != block_end; first += W) {
+      c0 = O::count_add(c0, O::cmpeq(O::load(first), needle));
+    }
+    total += O::count_total(c0) + O::count_total(c1) + O::count_total(c2) +
+             O::count_total(c3);
+  }
+  for (; first != last; ++first) total += (*first == value);
+  return total;
+}
+
+// min() when Largest is false, max() otherwise; the range is not empty
+template <bool Largest, typename T>
+T extreme(const T *first, const T *last) {
+  using O = ops<T>;
+  constexpr ptrdiff_t W = O::lanes;
+  auto pick = [](auto a, auto b) {
+    if constexpr (Largest) {
+      return O::max(a, b);
+    } else {
+      return O::min(a, b);
+    }
+  };
+  T result = *first;
+  if (last - first >= W) {
+    auto r0 = O::load(first);
+    auto r1 = r0, r2 = r0, r3 = r0;
+    first += W;
+    for (; last - first >= 4 * W; first += 4 * W) {
+      r0 = pick(r0, O::load(first));
+      r1 = pick(r1, O::load(first + W));
+      r2 = pick(r2, O::load(first + 2 * W));
+      r3 = pick(r3, O::load(first + 3 * W));
+    }
+    for (; last - first >= W; first += W) r0 = pick(r0, O::load(first));
+    auto r = pick(pick(r0, r1), pick(r2, r3));
+    if constexpr (Largest) {
+      result = O::reduce_max(r);
+    } else {
+      result = O::reduce_min(r);
+    }
+  }
+  for (; first != last; ++first) {
+    if (Largest ? result < *first : *first < result) result = *first;
+  }
+  return result;
+}
+
+template <typename T>
+sum_type<T> sum(const T *first, const T *last) {
+  using O = ops<T>;
+  constexpr ptrdiff_t W = O::lanes;
+  auto a0 = O::sum_zero(), a1 = O::sum_zero();
+  auto a2 = O::sum_zero(), a3 = O::sum_zero();
+  for (; last - first >= 4 * W; first += 4 * W) {
+    a0 = O::sum_add(a0, O::load(first));
+    a1 = O::sum_add(a1, O::load(first + W));
+    a2 = O::sum_add(a2, O::load(first + 2 * W));
+    a3 = O::sum_add(a3, O::load(first + 3 * W));
+  }
+  for (; last - first >= W; first += W) a0 = O::sum_add(a0, O::load(first));
+  sum_type<T> total =
+      O::reduce_sum(O::sum_merge(O::sum_merge(a0, a1), O::sum_merge(a2, a3)));
+  for (; first != last; ++first) total += *first;
+  return total;
+}
@@ -0,0 +1,362 @@
+#ifndef S21_SIMD_OPS_TPP
+#define S21_SIMD_OPS_TPP
+
+#if S21_SIMD_X86
+
+namespace s21 {
+namespace simd {
+namespace detail {
+
+// ops<T> for 128-bit SSE2 registers, the x86-64 baseline
+namespace sse2 {
+
+template <typename T>
+struct ops;
+
+template <>
+struct ops<int32_t> {
+  static constexpr ptrdiff_t lanes = 4;
+
+  static __m128i load(const int32_t *p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  }
+  static __m128i set1(int32_t v) { return _mm_set1_epi32(v); }
+  static __m128i cmpeq(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+  static __m128i cmpgt(__m128i a, __m128i b) { return _mm_cmpgt_epi32(a, b); }
+  static __m128i mask_or(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+  static int movemask(__m128i m) {
+    return _mm_movemask_ps(_mm_castsi128_ps(m));
+  }
+
+  // a matching lane is -1, so subtracting the mask counts it
+  static __m128i count_zero() { return _mm_setzero_si128(); }
+  static __m128i count_add(__m128i c, __m128i m) {
+    return _mm_sub_epi32(c, m);
+  }
+  static size_t count_total(__m128i c) {
+    alignas(16) uint32_t lane[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lane), c);
+    return size_t{lane[0]} + lane[1] + lane[2] + lane[3];
+  }
+
+  // SSE2 has no pminsd/pmaxsd, so lanes are blended through a mask
+  static __m128i min(__m128i a, __m128i b) {
+    __m128i a_greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(a_greater, b),
+                        _mm_andnot_si128(a_greater, a));
+  }
+  static __m128i max(__m128i a, __m128i b) {
+    __m128i a_greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(a_greater, a),
+                        _mm_andnot_si128(a_greater, b));
+  }
+  static int32_t reduce_min(__m128i r) {
+    alignas(16) int32_t lane[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lane), r);
+    return *std::min_element(lane, lane + 4);
+  }
+  static int32_t reduce_max(__m128i r) {
+    alignas(16) int32_t lane[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lane), r);
+    return *std::max_element(lane, lane + 4);
+  }
+
+  // lanes are sign-extended to two 64-bit halves so the sum cannot overflow
+  static __m128i sum_zero() { return _mm_setzero_si128(); }
+  static __m128i sum_add(__m128i acc, __m128i r) {
+    __m128i sign = _mm_srai_epi32(r, 31);
+    acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(r, sign));
+    return _mm_add_epi64(acc, _mm_unpackhi_epi32(r, sign));
+  }
+  static __m128i sum_merge(__m128i a, __m128i b) { return _mm_add_epi64(a, b); }
+  static int64_t reduce_sum(__m128i acc) {
+    alignas(16) int64_t lane[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lane), acc);
+    return lane[0] + lane[1];
+  }
+};
+
+template <>
+struct ops<float> {
+  static constexpr ptrdiff_t lanes = 4;
+
+  static __m128 load(const float *p) { return _mm_loadu_ps(p); }
+  static __m128 set1(float v) { return _mm_set1_ps(v); }
+  static __m128 cmpeq(__m128 a, __m128 b) { return _mm_cmpeq_ps(a, b); }
+  static __m128 cmpgt(__m128 a, __m128 b) { return _mm_cmpgt_ps(a, b); }
+  static __m128 mask_or(__m128 a, __m128 b) { return _mm_or_ps(a, b); }
+  static int movemask(__m128 m) { return _mm_movemask_ps(m); }
+
+  static __m128i count_zero() { return _mm_setzero_si128(); }
+  static __m128i count_add(__m128i c, __m128 m) {
+    return _mm_sub_epi32(c, _mm_castps_si128(m));
+  }
+  static size_t count_total(__m128i c) {
+    return ops<int32_t>::count_total(c);
+  }
+
+  static __m128 min(__m128 a, __m128 b) { return _mm_min_ps(a, b); }
+  static __m128 max(__m128 a, __m128 b) { return _mm_max_ps(a, b); }
+  static float reduce_min(__m128 r) {
+    alignas(16) float lane[4];
+    _mm_store_ps(lane, r);
+    return *std::min_element(lane, lane + 4);
+  }
+  static float reduce_max(__m128 r) {
+    alignas(16) float lane[4];
+    _mm_store_ps(lane, r);
+    return *std::max_element(lane, lane + 4);
+  }
+
+  static __m128 sum_zero() { return _mm_setzero_ps(); }
+  static __m128 sum_add(__m128 acc, __m128 r) { return _mm_add_ps(acc, r); }
+  static __m128 sum_merge(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+  static float reduce_sum(__m128 acc) {
+    alignas(16) float lane[4];
+    _mm_store_ps(lane, acc);
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+  }
+};
+
+template <>
+struct ops<double> {
+  static constexpr ptrdiff_t lanes = 2;
+
+  static __m128d load(const double *p) { return _mm_loadu_pd(p); }
+  static __m128d set1(double v) { return _mm_set1_pd(v); }
+  static __m128d cmpeq(__m128d a, __m128d b) { return _mm_cmpeq_pd(a, b); }
+  static __m128d cmpgt(__m128d a, __m128d b) { return _mm_cmpgt_pd(a, b); }
+  static __m128d mask_or(__m128d a, __m128d b) { return _mm_or_pd(a, b); }
+  static int movemask(__m128d m) { return _mm_movemask_pd(m); }
+
+  static __m128i count_zero() { return _mm_setzero_si128(); }
+  static __m128i count_add(__m128i c, __m128d m) {
+    return _mm_sub_epi64(c, _mm_castpd_si128(m));
+  }
+  static size_t count_total(__m128i c) {
+    alignas(16) uint64_t lane[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lane), c);
+    return static_cast<size_t>(lane[0] + lane[1]);
+  }
+
+  static __m128d min(__m128d a, __m128d b) { return _mm_min_pd(a, b); }
+  static __m128d max(__m128d a, __m128d b) { return _mm_max_pd(a, b); }
+  static double reduce_min(__m128d r) {
+    alignas(16) double lane[2];
+    _mm_store_pd(lane, r);
+    return std::min(lane[0], lane[1]);
+  }
+  static double reduce_max(__m128d r) {
+    alignas(16) double lane[2];
+    _mm_store_pd(lane, r);
+    return std::max(lane[0], lane[1]);
+  }
+
+  static __m128d sum_zero() { return _mm_setzero_pd(); }
+  static __m128d sum_add(__m128d acc, __m128d r) { return _mm_add_pd(acc, r); }
+  static __m128d sum_merge(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+  static double reduce_sum(__m128d acc) {
+    alignas(16) double lane[2];
+    _mm_store_pd(lane, acc);
+    return lane[0] + lane[1];
+  }
+};
+
+#include "s21_simd_kernels.tpp"
+
+}  // namespace sse2
+
+// Everything in this namespace is compiled for AVX2 whatever the compiler
+// flags are; it only runs after supported_isa() has seen AVX2 on the CPU.
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), \
+                             apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+// ops<T> for 256-bit AVX2 registers
+namespace avx2 {
+
+template <typename T>
+struct ops;
+
+template <>
+struct ops<int32_t> {
+  static constexpr ptrdiff_t lanes = 8;
+
+  static __m256i load(const int32_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+  static __m256i set1(int32_t v) { return _mm256_set1_epi32(v); }
+  static __m256i cmpeq(__m256i a, __m256i b) {
+    return _mm256_cmpeq_epi32(a, b);
+  }
+  static __m256i cmpgt(__m256i a, __m256i b) {
+    return _mm256_cmpgt_epi32(a, b);
+  }
+  static __m256i mask_or(__m256i a, __m256i b) {
+    return _mm256_or_si256(a, b);
+  }
+  static int movemask(__m256i m) {
+    return _mm256_movemask_ps(_mm256_castsi256_ps(m));
+  }
+
+  static __m256i count_zero() { return _mm256_setzero_si256(); }
+  static __m256i count_add(__m256i c, __m256i m) {
+    return _mm256_sub_epi32(c, m);
+  }
+  static size_t count_total(__m256i c) {
+    alignas(32) uint32_t lane[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lane), c);
+    size_t total = 0;
+    for (uint32_t n : lane) total += n;
+    return total;
+  }
+
+  static __m256i min(__m256i a, __m256i b) { return _mm256_min_epi32(a, b); }
+  static __m256i max(__m256i a, __m256i b) { return _mm256_max_epi32(a, b); }
+  static int32_t reduce_min(__m256i r) {
+    alignas(32) int32_t lane[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lane), r);
+    return *std::min_element(lane, lane + 8);
+  }
+  static int32_t reduce_max(__m256i r) {
+    alignas(32) int32_t lane[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lane), r);
+    return *std::max_element(lane, lane + 8);
+  }
+
+  static __m256i sum_zero() { return _mm256_setzero_si256(); }
+  static __m256i sum_add(__m256i acc, __m256i r) {
+    acc = _mm256_add_epi64(acc,
+                           _mm256_cvtepi32_epi64(_mm256_castsi256_si128(r)));
+    return _mm256_add_epi64(
+        acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(r, 1)));
+  }
+  static __m256i sum_merge(__m256i a, __m256i b) {
+    return _mm256_add_epi64(a, b);
+  }
+  static int64_t reduce_sum(__m256i acc) {
+    alignas(32) int64_t lane[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lane), acc);
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+  }
+};
+
+template <>
+struct ops<float> {
+  static constexpr ptrdiff_t lanes = 8;
+
+  static __m256 load(const float *p) { return _mm256_loadu_ps(p); }
+  static __m256 set1(float v) { return _mm256_set1_ps(v); }
+  static __m256 cmpeq(__m256 a, __m256 b) {
+    return _mm256_cmp_ps(a, b, _CMP_EQ_OQ);
+  }
+  static __m256 cmpgt(__m256 a, __m256 b) {
+    return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+  }
+  static __m256 mask_or(__m256 a, __m256 b) { return _mm256_or_ps(a, b); }
+  static int movemask(__m256 m) { return _mm256_movemask_ps(m); }
+
+  static __m256i count_zero() { return _mm256_setzero_si256(); }
+  static __m256i count_add(__m256i c, __m256 m) {
+    return _mm256_sub_epi32(c, _mm256_castps_si256(m));
+  }
+  static size_t count_total(__m256i c) {
+    return ops<int32_t>::count_total(c);
+  }
+
+  static __m256 min(__m256 a, __m256 b) { return _mm256_min_ps(a, b); }
+  static __m256 max(__m256 a, __m256 b) { return _mm256_max_ps(a, b); }
+  static float reduce_min(__m256 r) {
+    alignas(32) float lane[8];
+    _mm256_store_ps(lane, r);
+    return *std::min_element(lane, lane + 8);
+  }
+  static float reduce_max(__m256 r) {
+    alignas(32) float lane[8];
+    _mm256_store_ps(lane, r);
+    return *std::max_element(lane, lane + 8);
+  }
+
+  static __m256 sum_zero() { return _mm256_setzero_ps(); }
+  static __m256 sum_add(__m256 acc, __m256 r) { return _mm256_add_ps(acc, r); }
+  static __m256 sum_merge(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+  static float reduce_sum(__m256 acc) {
+    __m128 half = _mm_add_ps(_mm256_castps256_ps128(acc),
+                             _mm256_extractf128_ps(acc, 1));
+    return sse2::ops<float>::reduce_sum(half);
+  }
+};
+
+template <>
+struct ops<double> {
+  static constexpr ptrdiff_t lanes = 4;
+
+  static __m256d load(const double *p) { return _mm256_loadu_pd(p); }
+  static __m256d set1(double v) { return _mm256_set1_pd(v); }
+  static __m256d cmpeq(__m256d a, __m256d b) {
+    return _mm256_cmp_pd(a, b, _CMP_EQ_OQ);
+  }
+  static __m256d cmpgt(__m256d a, __m256d b) {
+    return _mm256_cmp_pd(a, b, _CMP_GT_OQ);
+  }
+  static __m256d mask_or(__m256d a, __m256d b) { return _mm256_or_pd(a, b); }
+  static int movemask(__m256d m) { return _mm256_movemask_pd(m); }
+
+  static __m256i count_zero() { return _mm256_setzero_si256(); }
+  static __m256i count_add(__m256i c, __m256d m) {
+    return _mm256_sub_epi64(c, _mm256_castpd_si256(m));
+  }
+  static size_t count_total(__m256i c) {
+    alignas(32) uint64_t lane[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lane), c);
+    return static_cast<size_t>(lane[0] + lane[1] + lane[2] + lane[3]);
+  }
+
+  static __m256d min(__m256d a, __m256d b) { return _mm256_min_pd(a, b); }
+  static __m256d max(__m256d a, __m256d b) { return _mm256_max_pd(a, b); }
+  static double reduce_min(__m256d r) {
+    alignas(32) double lane[4];
+    _mm256_store_pd(lane, r);
+    return *std::min_element(lane, lane + 4);
+  }
+  static double reduce_max(__m256d r) {
+    alignas(32) double lane[4];
+    _mm256_store_pd(lane, r);
+    return *std::max_element(lane, lane + 4);
+  }
+
+  static __m256d sum_zero() { return _mm256_setzero_pd(); }
+  static __m256d sum_add(__m256d acc, __m256d r) {
+    return _mm256_add_pd(acc, r);
+  }
+  static __m256d sum_merge(__m256d a, __m256d b) {
+    return _mm256_add_pd(a, b);
+  }
+  static double reduce_sum(__m256d acc) {
+    alignas(32) double lane[4];
+    _mm256_store_pd(lane, acc);
+    return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+  }
+};
+
+#include "s21_simd_kernels.tpp"
+
+}  // namespace avx2
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+}  // namespace detail
+}  // namespace simd
+}  // namespace s21
+
+#endif  // S21_SIMD_X86
+
+#endif
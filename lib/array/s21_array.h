@@ -2,10 +2,43 @@
 #define S21_ARRAY_H
 
 #include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
+
+// storage of an array: a plain T[N], and an empty struct when N is 0 since
+// C++ has no zero-length arrays
+template <typename T, size_t N>
+struct array_traits {
+  using type = T[N];
+  static constexpr T *ptr(type &elems) noexcept { return elems; }
+  static constexpr const T *ptr(const type &elems) noexcept { return elems; }
+};
+
+template <typename T>
+struct array_traits<T, 0> {
+  struct type {};
+  static constexpr T *ptr(type &) noexcept { return nullptr; }
+  static constexpr const T *ptr(const type &) noexcept { return nullptr; }
+};
+
+// array<T, N> is an aggregate around T[N] and nothing else: it takes no more
+// room than the bare array, is initialized with braces like one, copies and
+// moves trivially when T does, and works in constant expressions:
+//
+//   constexpr s21::array<int, 3> primes{2, 3, 5};
+//   static_assert(primes[1] == 3);
 template <typename T, size_t N>
 class array {
+  static_assert(N <= static_cast<size_t>(
+                         std::numeric_limits<std::ptrdiff_t>::max()) /
+                         sizeof(T),
+                "Error! Number of elements bigger than maximum available "
+                "number of elements");
+
  public:
   using value_type = T;
   using reference = T &;
@@ -14,43 +47,41 @@ class array {
   using iterator = T *;
   using const_iterator = const T *;
 
-  array();  // default constructor, creates empty array
-  array(std::initializer_list<value_type> const
-            &items);      // initializer list constructor, creates array
-                          // initizialized using std::initializer_list
-  array(const array &a);  // copy constructor
-  array(array &&a);       // move constructor
-  ~array();               // destructor
-
-  array<T, N> &operator=(
-      array &&a) noexcept;  // assignment operator overload for moving object
-
-  iterator begin() noexcept;  // returns an iterator to the beginning
-  const_iterator begin() const noexcept;
-  iterator end() noexcept;  // returns an iterator to the end
-  const_iterator end() const noexcept;
-  iterator data() noexcept;  // direct access to the underlying array
-  constexpr bool empty()
-      const noexcept;  // checks whether the container is empty
-  constexpr size_type size() const noexcept;  // returns the number of elements
-  size_type max_size()
-      const noexcept;  // returns the maximum possible number of elements
+  constexpr iterator begin() noexcept;  // returns an iterator to the beginning
+  constexpr const_iterator begin() const noexcept;
+  constexpr iterator end() noexcept;  // returns an iterator to the end
+  constexpr const_iterator end() const noexcept;
+  constexpr iterator data() noexcept;  // direct access to the underlying array
+  constexpr const_iterator data() const noexcept;
+  // the size is part of the type, so these are static: they never touch the
+  // elements and work on an array that is not initialized yet
+  static constexpr bool empty() noexcept;  // checks whether the container is
+                                           // empty
+  static constexpr size_type size() noexcept;  // returns the number of
+                                               // elements
+  static constexpr size_type max_size()
+      noexcept;  // returns the maximum possible number of elements
   constexpr reference operator[](size_type pos);  // access specified element
-  void swap(array &other) noexcept;               // swaps the contents
+  constexpr const_reference operator[](size_type pos) const;
+  void swap(array &other) noexcept(
+      std::is_nothrow_swappable<T>::value);  // swaps the contents
   constexpr reference at(
       size_type pos);  // access specified element with bounds checking
-  constexpr const_reference front() const;  // access the first element
-  constexpr const_reference back() const;   // access the last element
-  void fill(const_reference value);  // assigns the given value value to all
-                                     // elements in the container
-
- private:
-  value_type array_[N];
-  size_type size_;
+  constexpr const_reference at(size_type pos) const;
+  constexpr reference front();  // access the first element
+  constexpr const_reference front() const;
+  constexpr reference back();  // access the last element
+  constexpr const_reference back() const;
+  constexpr void fill(const_reference value);  // assigns the given value
+                                               // value to all elements in
+                                               // the container
+
+  // public only so that array stays an aggregate; not part of the interface
+  typename array_traits<T, N>::type array_;
 };
 
 }  // namespace s21
 
 #include "s21_array.tpp"
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,97 @@
+#ifndef S21_CONCURRENT_STACK_H
+#define S21_CONCURRENT_STACK_H
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_memory.h"
+#include "s21_hazard_pointer.h"
+
+namespace s21 {
+
+// concurrent_stack<T> is a LIFO that any number of threads push to and pop
+// from without a lock (a Treiber stack): the top is one atomic word, and
+// both operations are a CAS on it.
+//
+// - ABA: the top word carries a counter next to the node pointer that every
+//   successful CAS bumps, so a CAS that read the top before other threads
+//   popped and pushed the same address fails.
+// - Reclamation: a pop announces the node it reads through a hazard_pointer,
+//   and popped nodes are retired rather than deleted, so no thread reads a
+//   freed node.
+// - Elimination: a push or pop that loses the CAS race tries to meet an
+//   operation of the opposite kind in a small exchanger array. A push and a
+//   pop that meet there cancel out without touching the top.
+//
+// The counter lives in the bits a 64-bit address leaves unused (16 bits
+// above a 48-bit address) or next to a 32-bit address.
+template <typename T>
+class concurrent_stack {
+  static_assert(std::is_nothrow_move_assignable<T>::value,
+                "concurrent_stack elements must be nothrow move assignable");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  concurrent_stack() noexcept = default;
+  concurrent_stack(const concurrent_stack &) = delete;
+  concurrent_stack &operator=(const concurrent_stack &) = delete;
+  ~concurrent_stack();  // deletes the elements; no other thread may use it
+
+  bool empty() const noexcept;  // checks whether the stack is empty; only a
+                                // snapshot while other threads run
+
+  void push(const T &value);  // adds an element to the top
+  void push(T &&value);       // moves an element to the top
+  template <typename... Args>
+  void emplace(Args &&...args);  // constructs an element on the top
+  bool try_pop(T &out);  // moves the top element to out; false when empty
+
+ private:
+  struct Node_ {
+    template <typename... Args>
+    explicit Node_(Args &&...args) : value(std::forward<Args>(args)...) {}
+
+    T value;
+    Node_ *next = nullptr;
+  };
+
+  using word = std::uint64_t;  // node pointer and counter
+  // one exchanger of the elimination array, on its own cache line
+  struct alignas(cache_line_size) Exchanger_ {
+    std::atomic<word> offer{0};
+  };
+
+  static constexpr unsigned kTagShift = sizeof(void *) == 8 ? 48 : 32;
+  static constexpr word kPointerMask = (word{1} << kTagShift) - 1;
+  static constexpr size_type kExchangers = 8;
+  static constexpr int kOfferSpins = 64;  // checks before an offer is taken
+                                          // back
+
+  static Node_ *pointer(word w) noexcept;  // the node of a word
+  static word successor(word w,
+                        Node_ *node) noexcept;  // node with the counter of w
+                                                // plus one
+  static void reclaim(void *node);       // deletes a retired node
+  static Exchanger_ &random_exchanger(
+      Exchanger_ *exchangers) noexcept;  // picks an exchanger per call
+
+  void push_node(Node_ *node) noexcept;
+  Node_ *pop_node() noexcept;        // unlinks the top node, or nullptr
+  bool offer(Node_ *node) noexcept;  // hands node to a concurrent pop
+  Node_ *take() noexcept;            // takes a node from a concurrent push
+
+  alignas(cache_line_size) std::atomic<word> top_{0};
+  Exchanger_ exchangers_[kExchangers];
+};
+
+}  // namespace s21
+
+#include "s21_concurrent_stack.tpp"
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef S21_CONCURRENT_STACK_TPP
+#define S21_CONCURRENT_STACK_TPP
+
+#include "s21_concurrent_stack.h"
+
+namespace s21 {
+
+// deletes the elements; no other thread may use it
+template <typename T>
+concurrent_stack<T>::~concurrent_stack() {
+  Node_ *node = pointer(top_.load(std::memory_order_acquire));
+  while (node) {
+    Node_ *next = node->next;
+    delete node;
+    node = next;
+  }
+}
+
+// checks whether the stack is empty
+template <typename T>
+bool concurrent_stack<T>::empty() const noexcept {
+  return pointer(top_.load(std::memory_order_acquire)) == nullptr;
+}
+
+// adds an element to the top
+template <typename T>
+void concurrent_stack<T>::push(const T &value) {
+  emplace(value);
+}
+
+// moves an element to the top
+template <typename T>
+void concurrent_stack<T>::push(T &&value) {
+  emplace(std::move(value));
+}
+
+// constructs an element on the top; only the allocation may throw, before
+// the node is shared
+template <typename T>
+template <typename... Args>
+void concurrent_stack<T>::emplace(Args &&...args) {
+  push_node(new Node_(std::forward<Args>(args)...));
+}
+
+// moves the top element to out; the node is retired, since other pops may
+// still be reading its next pointer
+template <typename T>
+bool concurrent_stack<T>::try_pop(T &out) {
+  Node_ *node = pop_node();
+  if (!node) return false;
+  out = std::move(node->value);
+  hazard_pointer::retire(node, &reclaim);
+  return true;
+}
+
+// private
+
+// the node of a word
+template <typename T>
+typename concurrent_stack<T>::Node_ *concurrent_stack<T>::pointer(
+    word w) noexcept {
+  auto address = static_cast<std::uintptr_t>(w & kPointerMask);
+  return reinterpret_cast<Node_ *>(address);
+}
+
+// node with the counter of w plus one
+template <typename T>
+typename concurrent_stack<T>::word concurrent_stack<T>::successor(
+    word w, Node_ *node) noexcept {
+  word address = static_cast<word>(reinterpret_cast<std::uintptr_t>(node));
+  assert((address & ~kPointerMask) == 0 && "address does not fit the tag");
+  return (((w >> kTagShift) + 1) << kTagShift) | address;
+}
+
+// deletes a retired node
+template <typename T>
+void concurrent_stack<T>::reclaim(void *node) {
+  delete static_cast<Node_ *>(node);
+}
+
+// picks an exchanger with a per-thread xorshift generator
+template <typename T>
+typename concurrent_stack<T>::Exchanger_ &
+concurrent_stack<T>::random_exchanger(Exchanger_ *exchangers) noexcept {
+  static thread_local std::uint32_t state =
+      static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&state)) | 1;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return exchangers[state % kExchangers];
+}
+
+template <typename T>
+void concurrent_stack<T>::push_node(Node_ *node) noexcept {
+  word top = top_.load(std::memory_order_relaxed);
+  for (;;) {
+    node->next = pointer(top);
+    if (top_.compare_exchange_weak(top, successor(top, node),
+                                   std::memory_order_seq_cst,
+                                   std::memory_order_relaxed)) {
+      return;
+    }
+    if (offer(node)) return;
+    top = top_.load(std::memory_order_relaxed);
+  }
+}
+
+// unlinks the top node, or returns nullptr when the stack is empty. The
+// node is announced and the top re-read before its next pointer is read,
+// so a node that is still the top cannot have been reclaimed.
+template <typename T>
+typename concurrent_stack<T>::Node_ *concurrent_stack<T>::pop_node() noexcept {
+  hazard_pointer hazard;
+  word top = top_.load(std::memory_order_seq_cst);
+  for (;;) {
+    Node_ *node = pointer(top);
+    if (!node) return nullptr;
+    hazard.protect(node);
+    word current = top_.load(std::memory_order_seq_cst);
+    if (current != top) {
+      top = current;
+      continue;
+    }
+    if (top_.compare_exchange_strong(top, successor(top, node->next),
+                                     std::memory_order_seq_cst)) {
+      return node;
+    }
+    if (Node_ *taken = take()) return taken;
+    top = top_.load(std::memory_order_seq_cst);
+  }
+}
+
+// offers node in a free exchanger and waits a little for a pop to take it;
+// false when the node was taken back. The counter in the exchanger word
+// tells a taken node from a new offer of the same address.
+template <typename T>
+bool concurrent_stack<T>::offer(Node_ *node) noexcept {
+  Exchanger_ &exchanger = random_exchanger(exchangers_);
+  word empty = exchanger.offer.load(std::memory_order_relaxed);
+  if (pointer(empty)) return false;
+  word mine = successor(empty, node);
+  if (!exchanger.offer.compare_exchange_strong(
+          empty, mine, std::memory_order_release, std::memory_order_relaxed)) {
+    return false;
+  }
+  for (int i = 0; i < kOfferSpins; i++) {
+    if (exchanger.offer.load(std::memory_order_acquire) != mine) return true;
+  }
+  return !exchanger.offer.compare_exchange_strong(
+      mine, successor(mine, nullptr), std::memory_order_acquire,
+      std::memory_order_acquire);
+}
+
+// takes a node that a concurrent push offers, or returns nullptr
+template <typename T>
+typename concurrent_stack<T>::Node_ *concurrent_stack<T>::take() noexcept {
+  Exchanger_ &exchanger = random_exchanger(exchangers_);
+  word offered = exchanger.offer.load(std::memory_order_acquire);
+  Node_ *node = pointer(offered);
+  if (node && exchanger.offer.compare_exchange_strong(
+                  offered, successor(offered, nullptr),
+                  std::memory_order_acquire, std::memory_order_relaxed)) {
+    return node;
+  }
+  return nullptr;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef S21_HAZARD_POINTER_H
+#define S21_HAZARD_POINTER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// hazard_pointer lets lock-free containers free nodes that other threads
+// may still be reading. A reader announces the node it is about to
+// dereference with protect() and re-checks that the node is still reachable;
+// a thread that unlinks a node hands it to retire() instead of deleting it.
+// Retired nodes are freed in batches, skipping every node some hazard
+// pointer still announces.
+//
+// Slots live in one process-wide list that only grows; a thread keeps a
+// spare slot so that creating a hazard_pointer is usually free. Retired
+// nodes wait in a per-thread list, and a thread that exits with nodes that
+// are still protected leaves them to the next thread that collects.
+class hazard_pointer {
+ public:
+  hazard_pointer();   // takes a slot, usually the spare of this thread
+  ~hazard_pointer();  // clears the slot and gives it back
+  hazard_pointer(const hazard_pointer &) = delete;
+  hazard_pointer &operator=(const hazard_pointer &) = delete;
+
+  void protect(const void *p) noexcept;  // announces p; re-read the source
+                                         // afterwards to validate it
+  void reset() noexcept;                 // announces nothing
+
+  static void retire(void *p,
+                     void (*reclaim)(void *));  // calls reclaim(p) once no
+                                                // hazard pointer announces p
+  static void collect();  // reclaims what this thread retired, except the
+                          // pointers that are still announced
+
+ private:
+  struct slot {
+    std::atomic<const void *> pointer{nullptr};
+    std::atomic<bool> taken{false};
+    slot *next = nullptr;
+  };
+  struct retired_pointer {
+    void *pointer;
+    void (*reclaim)(void *);
+  };
+  // what a thread keeps between operations
+  struct thread_state {
+    slot *spare = nullptr;
+    vector<retired_pointer> retired;
+    vector<retired_pointer> batch;  // scratch space of scan()
+    vector<const void *> hazards;   // scratch space of scan()
+    ~thread_state();
+  };
+  // retired pointers of threads that have exited
+  struct orphan_list {
+    std::mutex mutex;
+    vector<retired_pointer> retired;
+    ~orphan_list();
+  };
+
+  static constexpr size_t kBatch = 64;  // retired pointers kept before a
+                                        // scan, on top of two per slot
+
+  static slot *acquire();  // finds a free slot or adds one
+  static void release(slot *s) noexcept;
+  static thread_state &local();
+  static void scan(thread_state &state);  // reclaims the retired pointers
+                                          // that no slot announces
+
+  static inline std::atomic<slot *> slots_{nullptr};
+  static inline std::atomic<size_t> slot_count_{0};
+  static inline orphan_list orphans_;
+
+  slot *slot_;
+};
+
+}  // namespace s21
+
+#include "s21_hazard_pointer.tpp"
+
+#endif
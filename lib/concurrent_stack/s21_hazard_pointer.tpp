@@ -0,0 +1,121 @@
+namespace s21 {
+
+inline hazard_pointer::hazard_pointer() {
+  thread_state &state = local();
+  if (state.spare) {
+    slot_ = state.spare;
+    state.spare = nullptr;
+  } else {
+    slot_ = acquire();
+  }
+}
+
+inline hazard_pointer::~hazard_pointer() {
+  reset();
+  thread_state &state = local();
+  if (!state.spare) {
+    state.spare = slot_;
+  } else {
+    release(slot_);
+  }
+}
+
+// the store is seq_cst so that it is ordered before the caller re-reads the
+// source: either the scan of a thread that unlinked p sees the announcement,
+// or the re-read sees that p is gone
+inline void hazard_pointer::protect(const void *p) noexcept {
+  slot_->pointer.store(p, std::memory_order_seq_cst);
+}
+
+inline void hazard_pointer::reset() noexcept {
+  slot_->pointer.store(nullptr, std::memory_order_release);
+}
+
+inline void hazard_pointer::retire(void *p, void (*reclaim)(void *)) {
+  thread_state &state = local();
+  state.retired.push_back({p, reclaim});
+  if (state.retired.size() >=
+      kBatch + 2 * slot_count_.load(std::memory_order_relaxed)) {
+    scan(state);
+  }
+}
+
+inline void hazard_pointer::collect() { scan(local()); }
+
+// private
+
+inline hazard_pointer::slot *hazard_pointer::acquire() {
+  for (slot *s = slots_.load(std::memory_order_acquire); s; s = s->next) {
+    if (!s->taken.load(std::memory_order_relaxed) &&
+        !s->taken.exchange(true, std::memory_order_acquire)) {
+      return s;
+    }
+  }
+  slot *s = new slot;
+  s->taken.store(true, std::memory_order_relaxed);
+  s->next = slots_.load(std::memory_order_relaxed);
+  while (!slots_.compare_exchange_weak(s->next, s, std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+  }
+  slot_count_.fetch_add(1, std::memory_order_relaxed);
+  return s;
+}
+
+inline void hazard_pointer::release(slot *s) noexcept {
+  s->pointer.store(nullptr, std::memory_order_release);
+  s->taken.store(false, std::memory_order_release);
+}
+
+inline hazard_pointer::thread_state &hazard_pointer::local() {
+  static thread_local thread_state state;
+  return state;
+}
+
+// moves the retired pointers to the scratch batch first, so that a reclaim
+// that retires more pointers does not change the list being scanned
+inline void hazard_pointer::scan(thread_state &state) {
+  vector<retired_pointer> &batch = state.batch;
+  if (!batch.empty()) return;  // a reclaim called back into scan
+  batch.swap(state.retired);
+  {
+    std::unique_lock<std::mutex> lock(orphans_.mutex, std::try_to_lock);
+    if (lock.owns_lock()) {
+      for (const retired_pointer &r : orphans_.retired) batch.push_back(r);
+      orphans_.retired.clear();
+    }
+  }
+
+  vector<const void *> &hazards = state.hazards;
+  hazards.clear();
+  for (slot *s = slots_.load(std::memory_order_acquire); s; s = s->next) {
+    const void *p = s->pointer.load(std::memory_order_seq_cst);
+    if (p) hazards.push_back(p);
+  }
+  std::sort(hazards.begin(), hazards.end());
+
+  for (size_t i = 0; i < batch.size(); i++) {
+    const retired_pointer r = batch[i];
+    if (std::binary_search(hazards.begin(), hazards.end(), r.pointer)) {
+      state.retired.push_back(r);
+    } else {
+      r.reclaim(r.pointer);
+    }
+  }
+  batch.clear();
+}
+
+inline hazard_pointer::thread_state::~thread_state() {
+  if (spare) release(spare);
+  scan(*this);
+  if (!retired.empty()) {
+    std::lock_guard<std::mutex> lock(orphans_.mutex);
+    for (const retired_pointer &r : retired) orphans_.retired.push_back(r);
+  }
+}
+
+// runs at exit, when no other thread reads the nodes any more
+inline hazard_pointer::orphan_list::~orphan_list() {
+  for (const retired_pointer &r : retired) r.reclaim(r.pointer);
+}
+
+}  // namespace s21
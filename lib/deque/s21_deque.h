@@ -0,0 +1,213 @@
+#ifndef S21_DEQUE_H
+#define S21_DEQUE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_memory.h"
+
+namespace s21 {
+
+// deque<T, BlockSize> stores its elements in fixed blocks of BlockSize
+// elements (4 KB by default) and keeps the block pointers in a map with
+// free room at both ends. Growing at either end adds a block and, rarely,
+// recentres or doubles the map, which moves pointers only: references to
+// elements stay valid until the element is erased. Iterators are
+// invalidated by a push that touches the map.
+//
+// Element i lives at block (start + i) / BlockSize of the map, so random
+// access is O(1). Iterators walk a block as a plain array and step to the
+// next map entry at its end. One empty block is kept at each end so that
+// pushing and popping at a block boundary does not allocate every time.
+template <typename T,
+          size_t BlockSize = std::max<size_t>(16, 4096 / sizeof(T))>
+class deque {
+  static_assert(BlockSize > 1, "deque blocks need room for two elements");
+
+ public:
+  template <bool Const>
+  class basic_iterator;
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  static constexpr size_type block_size = BlockSize;  // elements per block
+
+  deque() noexcept;             // default constructor, allocates nothing
+  explicit deque(size_type n);  // creates n value-initialized elements
+  deque(std::initializer_list<value_type> const
+            &items);        // initializer list constructor
+  deque(const deque &d);      // copy constructor
+  deque(deque &&d) noexcept;  // move constructor
+  ~deque();                   // destructor
+
+  deque &operator=(const deque &d);      // copy assignment
+  deque &operator=(deque &&d) noexcept;  // move assignment
+
+  reference operator[](size_type pos);  // access specified element
+  const_reference operator[](size_type pos) const;
+  reference at(size_type pos);  // access specified element with bounds
+                                // checking
+  const_reference at(size_type pos) const;
+  reference front();  // access the first element
+  reference back();   // access the last element
+  const_reference front() const;
+  const_reference back() const;
+
+  iterator begin() noexcept;  // returns an iterator to the beginning
+  iterator end() noexcept;    // returns an iterator to the end
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+
+  bool empty() const noexcept;      // checks whether the deque is empty
+  size_type size() const noexcept;  // returns the number of elements
+  size_type max_size() const noexcept;
+  void shrink_to_fit() noexcept;  // frees the spare blocks
+
+  void clear() noexcept;                   // clears the contents
+  void push_back(const_reference value);   // adds an element to the end
+  void push_back(value_type &&value);      // moves an element to the end
+  void push_front(const_reference value);  // adds an element to the beginning
+  void push_front(value_type &&value);  // moves an element to the beginning
+  template <typename... Args>
+  reference emplace_back(Args &&...args);  // constructs an element at the end
+  template <typename... Args>
+  reference emplace_front(
+      Args &&...args);  // constructs an element at the beginning
+  void pop_back();      // removes the last element
+  void pop_front();     // removes the first element
+  void swap(deque &other) noexcept;  // swaps the contents
+
+  // random access iterator that walks one block at a time: it keeps the
+  // element, the start of its block and the map entry of the block
+  template <bool Const>
+  class basic_iterator {
+    friend deque;
+    template <bool>
+    friend class basic_iterator;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    basic_iterator() = default;
+    template <bool Other, typename = std::enable_if_t<Const && !Other>>
+    basic_iterator(const basic_iterator<Other> &other) noexcept
+        : cur_(other.cur_), first_(other.first_), node_(other.node_) {}
+
+    reference operator*() const noexcept { return *cur_; }
+    pointer operator->() const noexcept { return cur_; }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+    basic_iterator &operator++() noexcept;  // prefix
+    basic_iterator operator++(int) noexcept {  // postfix
+      basic_iterator copy = *this;
+      ++*this;
+      return copy;
+    }
+    basic_iterator &operator--() noexcept;  // prefix
+    basic_iterator operator--(int) noexcept {  // postfix
+      basic_iterator copy = *this;
+      --*this;
+      return copy;
+    }
+    basic_iterator &operator+=(difference_type n) noexcept;
+    basic_iterator &operator-=(difference_type n) noexcept {
+      return *this += -n;
+    }
+    basic_iterator operator+(difference_type n) const noexcept {
+      basic_iterator copy = *this;
+      return copy += n;
+    }
+    friend basic_iterator operator+(difference_type n,
+                                    const basic_iterator &it) noexcept {
+      return it + n;
+    }
+    basic_iterator operator-(difference_type n) const noexcept {
+      basic_iterator copy = *this;
+      return copy += -n;
+    }
+    difference_type operator-(const basic_iterator &other) const noexcept {
+      return (node_ - other.node_) * static_cast<difference_type>(BlockSize) +
+             (cur_ - first_) - (other.cur_ - other.first_);
+    }
+    bool operator==(const basic_iterator &other) const noexcept {
+      return cur_ == other.cur_;
+    }
+    bool operator!=(const basic_iterator &other) const noexcept {
+      return cur_ != other.cur_;
+    }
+    bool operator<(const basic_iterator &other) const noexcept {
+      return node_ == other.node_ ? cur_ < other.cur_ : node_ < other.node_;
+    }
+    bool operator>(const basic_iterator &other) const noexcept {
+      return other < *this;
+    }
+    bool operator<=(const basic_iterator &other) const noexcept {
+      return !(other < *this);
+    }
+    bool operator>=(const basic_iterator &other) const noexcept {
+      return !(*this < other);
+    }
+
+   private:
+    basic_iterator(T *cur, T **node) noexcept
+        : cur_(cur), first_(node ? *node : nullptr), node_(node) {}
+
+    pointer cur_ = nullptr;
+    pointer first_ = nullptr;  // start of the block of cur_
+    T **node_ = nullptr;       // map entry of the block
+  };
+
+ private:
+  static constexpr size_type kMinMap = 8;
+
+  static T *allocate_block();  // raw storage for one block
+  size_type blocks() const noexcept {  // number of allocated blocks
+    return static_cast<size_type>(last_node_ - first_node_);
+  }
+  T *element(size_type pos) const noexcept {  // address of element pos
+    size_type index = start_ + pos;
+    return first_node_[index / BlockSize] + index % BlockSize;
+  }
+  iterator make_iterator(size_type pos) const noexcept;  // iterator to
+                                                         // element pos
+  void init_map();                // creates the map with one block
+  void grow_map(bool front);      // makes room for one more map entry at
+                                  // the front or back
+  void add_block(bool front);     // allocates a block at one end
+  void release() noexcept;        // frees every block and the map
+
+  T **map_;             // block pointers, with room at both ends
+  size_type map_size_;  // entries in map_
+  T **first_node_;      // first allocated block
+  T **last_node_;       // one past the last allocated block
+  size_type start_;     // index of the first element in *first_node_
+  size_type size_;
+};
+
+// the blocks and the map live on the heap, so a deque can be moved to
+// another address with memcpy
+template <typename T, size_t BlockSize>
+struct is_trivially_relocatable<deque<T, BlockSize>> : std::true_type {};
+
+}  // namespace s21
+
+#include "s21_deque.tpp"
+
+#endif
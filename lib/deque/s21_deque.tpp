@@ -0,0 +1,423 @@
+#ifndef S21_DEQUE_TPP
+#define S21_DEQUE_TPP
+
+#include "s21_deque.h"
+
+namespace s21 {
+
+// Invariant: without a map the deque is empty; with one, the block that
+// holds index start_ + size_ (the end) is allocated, so end() always points
+// into a block and iterators can step into the next block unconditionally.
+
+// default constructor, allocates nothing
+template <typename T, size_t BlockSize>
+deque<T, BlockSize>::deque() noexcept
+    : map_(nullptr),
+      map_size_(0),
+      first_node_(nullptr),
+      last_node_(nullptr),
+      start_(0),
+      size_(0) {}
+
+// creates n value-initialized elements; the constructors below delegate to
+// the default one, so the destructor frees the blocks if they throw
+template <typename T, size_t BlockSize>
+deque<T, BlockSize>::deque(size_type n) : deque() {
+  for (size_type i = 0; i < n; i++) emplace_back();
+}
+
+// initializer list constructor
+template <typename T, size_t BlockSize>
+deque<T, BlockSize>::deque(std::initializer_list<value_type> const &items)
+    : deque() {
+  for (const_reference item : items) emplace_back(item);
+}
+
+// copy constructor
+template <typename T, size_t BlockSize>
+deque<T, BlockSize>::deque(const deque &d) : deque() {
+  for (const_reference item : d) emplace_back(item);
+}
+
+// move constructor
+template <typename T, size_t BlockSize>
+deque<T, BlockSize>::deque(deque &&d) noexcept : deque() {
+  swap(d);
+}
+
+// destructor
+template <typename T, size_t BlockSize>
+deque<T, BlockSize>::~deque() {
+  clear();
+  release();
+}
+
+// copy assignment
+template <typename T, size_t BlockSize>
+deque<T, BlockSize> &deque<T, BlockSize>::operator=(const deque &d) {
+  if (this != &d) {
+    deque copy(d);
+    swap(copy);
+  }
+  return *this;
+}
+
+// move assignment
+template <typename T, size_t BlockSize>
+deque<T, BlockSize> &deque<T, BlockSize>::operator=(deque &&d) noexcept {
+  if (this != &d) {
+    deque moved(std::move(d));
+    swap(moved);
+  }
+  return *this;
+}
+
+// access specified element
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::reference deque<T, BlockSize>::operator[](
+    size_type pos) {
+  return *element(pos);
+}
+
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::const_reference deque<T, BlockSize>::operator[](
+    size_type pos) const {
+  return *element(pos);
+}
+
+// access specified element with bounds checking
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::reference deque<T, BlockSize>::at(
+    size_type pos) {
+  if (pos >= size_)
+    throw std::out_of_range("Error! Position of value is out of range");
+  return *element(pos);
+}
+
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::const_reference deque<T, BlockSize>::at(
+    size_type pos) const {
+  return const_cast<deque *>(this)->at(pos);
+}
+
+// access the first element
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::reference deque<T, BlockSize>::front() {
+  return *element(0);
+}
+
+// access the last element
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::reference deque<T, BlockSize>::back() {
+  return *element(size_ - 1);
+}
+
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::const_reference deque<T, BlockSize>::front()
+    const {
+  return *element(0);
+}
+
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::const_reference deque<T, BlockSize>::back()
+    const {
+  return *element(size_ - 1);
+}
+
+// returns an iterator to the beginning
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::iterator deque<T, BlockSize>::begin() noexcept {
+  return make_iterator(0);
+}
+
+// returns an iterator to the end
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::iterator deque<T, BlockSize>::end() noexcept {
+  return make_iterator(size_);
+}
+
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::const_iterator deque<T, BlockSize>::begin()
+    const noexcept {
+  return make_iterator(0);
+}
+
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::const_iterator deque<T, BlockSize>::end()
+    const noexcept {
+  return make_iterator(size_);
+}
+
+// checks whether the deque is empty
+template <typename T, size_t BlockSize>
+bool deque<T, BlockSize>::empty() const noexcept {
+  return size_ == 0;
+}
+
+// returns the number of elements
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::size_type deque<T, BlockSize>::size()
+    const noexcept {
+  return size_;
+}
+
+// returns the maximum possible number of elements
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::size_type deque<T, BlockSize>::max_size()
+    const noexcept {
+  size_type bits = (sizeof(void *) == 4) ? 31 : 63;
+  return (static_cast<size_type>(1) << bits) / sizeof(value_type);
+}
+
+// frees the spare blocks at both ends, and everything when empty
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::shrink_to_fit() noexcept {
+  if (size_ == 0) {
+    release();
+    return;
+  }
+  while (start_ >= BlockSize) {
+    deallocate_storage(*first_node_++);
+    start_ -= BlockSize;
+  }
+  while (blocks() > (start_ + size_) / BlockSize + 1) {
+    deallocate_storage(*--last_node_);
+  }
+}
+
+// clears the contents, keeping one block
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::clear() noexcept {
+  if (!map_) return;
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    for (size_type i = 0; i < size_; i++) element(i)->~T();
+  }
+  while (blocks() > 1) deallocate_storage(*--last_node_);
+  start_ = BlockSize / 2;
+  size_ = 0;
+}
+
+// adds an element to the end
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+// moves an element to the end
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+// adds an element to the beginning
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+// moves an element to the beginning
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+// constructs an element at the end; the block after it is allocated first,
+// so a failed allocation leaves the deque unchanged
+template <typename T, size_t BlockSize>
+template <typename... Args>
+typename deque<T, BlockSize>::reference deque<T, BlockSize>::emplace_back(
+    Args &&...args) {
+  if (!map_) init_map();
+  if (start_ + size_ + 1 == blocks() * BlockSize) add_block(false);
+  T *slot = element(size_);
+  ::new (static_cast<void *>(slot)) T(std::forward<Args>(args)...);
+  size_++;
+  return *slot;
+}
+
+// constructs an element at the beginning
+template <typename T, size_t BlockSize>
+template <typename... Args>
+typename deque<T, BlockSize>::reference deque<T, BlockSize>::emplace_front(
+    Args &&...args) {
+  if (!map_) init_map();
+  if (start_ == 0) add_block(true);
+  size_type index = start_ - 1;
+  T *slot = first_node_[index / BlockSize] + index % BlockSize;
+  ::new (static_cast<void *>(slot)) T(std::forward<Args>(args)...);
+  start_ = index;
+  size_++;
+  return *slot;
+}
+
+// removes the last element, freeing a second spare block at the back
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::pop_back() {
+  if (empty()) throw std::out_of_range("Error! deque is empty");
+  element(size_ - 1)->~T();
+  size_--;
+  if (blocks() > (start_ + size_) / BlockSize + 2) {
+    deallocate_storage(*--last_node_);
+  }
+}
+
+// removes the first element, freeing a second spare block at the front
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::pop_front() {
+  if (empty()) throw std::out_of_range("Error! deque is empty");
+  element(0)->~T();
+  start_++;
+  size_--;
+  if (start_ >= 2 * BlockSize) {
+    deallocate_storage(*first_node_++);
+    start_ -= BlockSize;
+  }
+}
+
+// swaps the contents
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::swap(deque &other) noexcept {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(first_node_, other.first_node_);
+  std::swap(last_node_, other.last_node_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+}
+
+// private
+
+// raw storage for one block, aligned for T
+template <typename T, size_t BlockSize>
+T *deque<T, BlockSize>::allocate_block() {
+  return allocate_storage<T>(BlockSize);
+}
+
+// iterator to element pos, pos <= size_
+template <typename T, size_t BlockSize>
+typename deque<T, BlockSize>::iterator deque<T, BlockSize>::make_iterator(
+    size_type pos) const noexcept {
+  if (!map_) return iterator();
+  size_type index = start_ + pos;
+  T **node = first_node_ + index / BlockSize;
+  return iterator(*node + index % BlockSize, node);
+}
+
+// creates the map with one block in its middle; the first element goes to
+// the middle of the block, so either end can grow before a new block
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::init_map() {
+  T *block = allocate_block();
+  try {
+    map_ = new T *[kMinMap];
+  } catch (...) {
+    deallocate_storage(block);
+    throw;
+  }
+  map_size_ = kMinMap;
+  first_node_ = map_ + kMinMap / 2;
+  *first_node_ = block;
+  last_node_ = first_node_ + 1;
+  start_ = BlockSize / 2;
+}
+
+// makes room for one more map entry at the front or back: recentres the
+// blocks when the map is at most half full, otherwise doubles it
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::grow_map(bool front) {
+  size_type count = blocks();
+  size_type needed = count + 1;
+  T **new_first;
+  if (map_size_ >= 2 * needed) {
+    new_first = map_ + (map_size_ - needed) / 2 + (front ? 1 : 0);
+    std::memmove(new_first, first_node_, count * sizeof(T *));
+  } else {
+    size_type new_size = std::max(map_size_ * 2, needed * 2);
+    T **new_map = new T *[new_size];
+    new_first = new_map + (new_size - needed) / 2 + (front ? 1 : 0);
+    std::memcpy(new_first, first_node_, count * sizeof(T *));
+    delete[] map_;
+    map_ = new_map;
+    map_size_ = new_size;
+  }
+  first_node_ = new_first;
+  last_node_ = new_first + count;
+}
+
+// allocates a block at one end; a block at the front shifts start_ by a
+// block
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::add_block(bool front) {
+  if (front ? first_node_ == map_ : last_node_ == map_ + map_size_) {
+    grow_map(front);
+  }
+  T *block = allocate_block();
+  if (front) {
+    *--first_node_ = block;
+    start_ += BlockSize;
+  } else {
+    *last_node_++ = block;
+  }
+}
+
+// frees every block and the map; the elements must be destroyed already
+template <typename T, size_t BlockSize>
+void deque<T, BlockSize>::release() noexcept {
+  if (!map_) return;
+  for (T **node = first_node_; node != last_node_; ++node) {
+    deallocate_storage(*node);
+  }
+  delete[] map_;
+  map_ = nullptr;
+  map_size_ = 0;
+  first_node_ = nullptr;
+  last_node_ = nullptr;
+  start_ = 0;
+  size_ = 0;
+}
+
+template <typename T, size_t BlockSize>
+template <bool Const>
+typename deque<T, BlockSize>::template basic_iterator<Const>
+    &deque<T, BlockSize>::basic_iterator<Const>::operator++() noexcept {
+  if (++cur_ == first_ + BlockSize) {
+    first_ = *++node_;
+    cur_ = first_;
+  }
+  return *this;
+}
+
+template <typename T, size_t BlockSize>
+template <bool Const>
+typename deque<T, BlockSize>::template basic_iterator<Const>
+    &deque<T, BlockSize>::basic_iterator<Const>::operator--() noexcept {
+  if (cur_ == first_) {
+    first_ = *--node_;
+    cur_ = first_ + BlockSize;
+  }
+  --cur_;
+  return *this;
+}
+
+template <typename T, size_t BlockSize>
+template <bool Const>
+typename deque<T, BlockSize>::template basic_iterator<Const>
+    &deque<T, BlockSize>::basic_iterator<Const>::operator+=(
+        difference_type n) noexcept {
+  const difference_type block = static_cast<difference_type>(BlockSize);
+  difference_type offset = n + (cur_ - first_);
+  if (offset >= 0 && offset < block) {
+    cur_ += n;
+  } else {
+    difference_type nodes =
+        offset > 0 ? offset / block : -((-offset - 1) / block) - 1;
+    node_ += nodes;
+    first_ = *node_;
+    cur_ = first_ + (offset - nodes * block);
+  }
+  return *this;
+}
+
+}  // namespace s21
+
+#endif
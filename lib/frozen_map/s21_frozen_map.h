@@ -0,0 +1,57 @@
+#ifndef S21_FROZEN_MAP_H
+#define S21_FROZEN_MAP_H
+
+#include "../s21_frozen_table.h"
+
+namespace s21 {
+
+// frozen_map<Key, T, N> is an immutable map of N entries built in a constant
+// expression, for lookup tables that are known at build time. Integer and
+// enum keys get a perfect hash, other keys (std::string_view for strings)
+// an Eytzinger layout:
+//
+//   constexpr auto methods = s21::make_frozen_map<std::string_view, int>(
+//       {{"GET", 1}, {"PUT", 2}, {"POST", 3}});
+//   static_assert(methods.at("PUT") == 2);
+template <typename Key, typename T, size_t N,
+          typename Layout = frozen_layout_for<Key>>
+class frozen_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = frozen_entry<Key, T>;
+  using const_reference = const value_type &;
+  using iterator = const value_type *;
+  using const_iterator = const value_type *;
+  using size_type = size_t;
+
+  constexpr explicit frozen_map(const s21::array<value_type, N> &items)
+      : table_(items) {}
+
+  constexpr const T &at(const Key &key) const;  // throws when key is missing
+
+  constexpr const_iterator begin() const noexcept;
+  constexpr const_iterator end() const noexcept;
+  static constexpr bool empty() noexcept;
+  static constexpr size_type size() noexcept;
+  static constexpr size_type max_size() noexcept;
+
+  constexpr const_iterator find(const Key &key) const noexcept;
+  constexpr bool contains(const Key &key) const noexcept;
+  constexpr size_type count(const Key &key) const noexcept;
+
+ private:
+  frozen_table<value_type, Key, N, Layout> table_;
+};
+
+// builds a frozen_map from a braced list of {key, value} pairs
+template <typename Key, typename T, typename Layout = frozen_layout_for<Key>,
+          size_t N>
+constexpr frozen_map<Key, T, N, Layout> make_frozen_map(
+    const frozen_entry<Key, T> (&items)[N]);
+
+}  // namespace s21
+
+#include "s21_frozen_map.tpp"
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef S21_FROZEN_MAP_TPP
+#define S21_FROZEN_MAP_TPP
+
+#include "s21_frozen_map.h"
+
+namespace s21 {
+
+// access the value of key with bounds checking
+template <typename Key, typename T, size_t N, typename Layout>
+constexpr const T &frozen_map<Key, T, N, Layout>::at(const Key &key) const {
+  const_iterator it = table_.find(key);
+  if (it == table_.end())
+    throw std::out_of_range("frozen_map::at - Key not found");
+  return it->second;
+}
+
+template <typename Key, typename T, size_t N, typename Layout>
+constexpr typename frozen_map<Key, T, N, Layout>::const_iterator
+frozen_map<Key, T, N, Layout>::begin() const noexcept {
+  return table_.begin();
+}
+
+template <typename Key, typename T, size_t N, typename Layout>
+constexpr typename frozen_map<Key, T, N, Layout>::const_iterator
+frozen_map<Key, T, N, Layout>::end() const noexcept {
+  return table_.end();
+}
+
+template <typename Key, typename T, size_t N, typename Layout>
+constexpr bool frozen_map<Key, T, N, Layout>::empty() noexcept {
+  return N == 0;
+}
+
+template <typename Key, typename T, size_t N, typename Layout>
+constexpr typename frozen_map<Key, T, N, Layout>::size_type
+frozen_map<Key, T, N, Layout>::size() noexcept {
+  return N;
+}
+
+template <typename Key, typename T, size_t N, typename Layout>
+constexpr typename frozen_map<Key, T, N, Layout>::size_type
+frozen_map<Key, T, N, Layout>::max_size() noexcept {
+  return N;
+}
+
+template <typename Key, typename T, size_t N, typename Layout>
+constexpr typename frozen_map<Key, T, N, Layout>::const_iterator
+frozen_map<Key, T, N, Layout>::find(const Key &key) const noexcept {
+  return table_.find(key);
+}
+
+template <typename Key, typename T, size_t N, typename Layout>
+constexpr bool frozen_map<Key, T, N, Layout>::contains(
+    const Key &key) const noexcept {
+  return table_.contains(key);
+}
+
+template <typename Key, typename T, size_t N, typename Layout>
+constexpr typename frozen_map<Key, T, N, Layout>::size_type
+frozen_map<Key, T, N, Layout>::count(const Key &key) const noexcept {
+  return table_.contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Layout, size_t N>
+constexpr frozen_map<Key, T, N, Layout> make_frozen_map(
+    const frozen_entry<Key, T> (&items)[N]) {
+  return frozen_map<Key, T, N, Layout>(frozen_array(items));
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef S21_FROZEN_SET_H
+#define S21_FROZEN_SET_H
+
+#include "../s21_frozen_table.h"
+
+namespace s21 {
+
+// frozen_set<Key, N> is an immutable set of N keys built in a constant
+// expression, laid out like frozen_map:
+//
+//   constexpr auto reserved = s21::make_frozen_set<std::string_view>(
+//       {"if", "else", "while"});
+//   static_assert(reserved.contains("else"));
+template <typename Key, size_t N, typename Layout = frozen_layout_for<Key>>
+class frozen_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using const_reference = const value_type &;
+  using iterator = const value_type *;
+  using const_iterator = const value_type *;
+  using size_type = size_t;
+
+  constexpr explicit frozen_set(const s21::array<value_type, N> &keys)
+      : table_(keys) {}
+
+  constexpr const_iterator begin() const noexcept;
+  constexpr const_iterator end() const noexcept;
+  static constexpr bool empty() noexcept;
+  static constexpr size_type size() noexcept;
+  static constexpr size_type max_size() noexcept;
+
+  constexpr const_iterator find(const Key &key) const noexcept;
+  constexpr bool contains(const Key &key) const noexcept;
+  constexpr size_type count(const Key &key) const noexcept;
+
+ private:
+  frozen_table<value_type, Key, N, Layout> table_;
+};
+
+// builds a frozen_set from a braced list of keys
+template <typename Key, typename Layout = frozen_layout_for<Key>, size_t N>
+constexpr frozen_set<Key, N, Layout> make_frozen_set(const Key (&keys)[N]);
+
+}  // namespace s21
+
+#include "s21_frozen_set.tpp"
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef S21_FROZEN_SET_TPP
+#define S21_FROZEN_SET_TPP
+
+#include "s21_frozen_set.h"
+
+namespace s21 {
+
+template <typename Key, size_t N, typename Layout>
+constexpr typename frozen_set<Key, N, Layout>::const_iterator
+frozen_set<Key, N, Layout>::begin() const noexcept {
+  return table_.begin();
+}
+
+template <typename Key, size_t N, typename Layout>
+constexpr typename frozen_set<Key, N, Layout>::const_iterator
+frozen_set<Key, N, Layout>::end() const noexcept {
+  return table_.end();
+}
+
+template <typename Key, size_t N, typename Layout>
+constexpr bool frozen_set<Key, N, Layout>::empty() noexcept {
+  return N == 0;
+}
+
+template <typename Key, size_t N, typename Layout>
+constexpr typename frozen_set<Key, N, Layout>::size_type
+frozen_set<Key, N, Layout>::size() noexcept {
+  return N;
+}
+
+template <typename Key, size_t N, typename Layout>
+constexpr typename frozen_set<Key, N, Layout>::size_type
+frozen_set<Key, N, Layout>::max_size() noexcept {
+  return N;
+}
+
+template <typename Key, size_t N, typename Layout>
+constexpr typename frozen_set<Key, N, Layout>::const_iterator
+frozen_set<Key, N, Layout>::find(const Key &key) const noexcept {
+  return table_.find(key);
+}
+
+template <typename Key, size_t N, typename Layout>
+constexpr bool frozen_set<Key, N, Layout>::contains(
+    const Key &key) const noexcept {
+  return table_.contains(key);
+}
+
+template <typename Key, size_t N, typename Layout>
+constexpr typename frozen_set<Key, N, Layout>::size_type
+frozen_set<Key, N, Layout>::count(const Key &key) const noexcept {
+  return table_.contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Layout, size_t N>
+constexpr frozen_set<Key, N, Layout> make_frozen_set(const Key (&keys)[N]) {
+  return frozen_set<Key, N, Layout>(frozen_array(keys));
+}
+
+}  // namespace s21
+
+#endif
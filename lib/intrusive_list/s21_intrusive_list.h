@@ -0,0 +1,178 @@
+#ifndef S21_INTRUSIVE_LIST_H
+#define S21_INTRUSIVE_LIST_H
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// intrusive_list_hook holds the links of an element of an intrusive_list.
+// It is a member of the element type; a copied hook starts unlinked and
+// assigning elements leaves their hooks alone, so copies never join a list.
+class intrusive_list_hook {
+  template <typename T, intrusive_list_hook T::*Hook>
+  friend class intrusive_list;
+
+ public:
+  intrusive_list_hook() noexcept = default;
+  intrusive_list_hook(const intrusive_list_hook &) noexcept {}
+  intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept {
+    return *this;
+  }
+  ~intrusive_list_hook() {
+    assert(!is_linked() && "element destroyed while still in a list");
+  }
+
+  bool is_linked() const noexcept { return next_ != nullptr; }
+
+ private:
+  intrusive_list_hook *next_ = nullptr;
+  intrusive_list_hook *prev_ = nullptr;
+};
+
+// intrusive_list<T, &T::hook> links objects that the caller owns through an
+// intrusive_list_hook member instead of copying them into allocated nodes.
+// Insert, erase and splice are O(1) and never allocate or throw; an element
+// stays where it is and can be in one list per hook member at a time.
+//
+// The list does not own its elements: it unlinks them when it is cleared or
+// destroyed, and an element must be erased before it is destroyed. Debug
+// builds assert that inserted elements are unlinked and erased ones linked.
+template <typename T, intrusive_list_hook T::*Hook>
+class intrusive_list {
+ public:
+  template <bool Const>
+  class basic_iterator;
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  intrusive_list() noexcept;                       // default constructor
+  intrusive_list(const intrusive_list &) = delete;  // elements are not owned
+  intrusive_list(intrusive_list &&l) noexcept;      // move constructor
+  ~intrusive_list();  // destructor, unlinks the elements
+
+  intrusive_list &operator=(const intrusive_list &) = delete;
+  intrusive_list &operator=(intrusive_list &&l) noexcept;  // move assignment
+
+  iterator begin() noexcept;  // returns an iterator to the beginning
+  iterator end() noexcept;    // returns an iterator to the end
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+  iterator iterator_to(reference value) noexcept;  // iterator to an element
+                                                   // of this list
+  const_iterator iterator_to(const_reference value) const noexcept;
+
+  reference front() noexcept;  // access the first element
+  reference back() noexcept;   // access the last element
+  const_reference front() const noexcept;
+  const_reference back() const noexcept;
+  size_type size() const noexcept;  // returns the number of elements
+  bool empty() const noexcept;      // checks whether the container is empty
+
+  void push_back(reference value) noexcept;   // links value at the end
+  void push_front(reference value) noexcept;  // links value at the beginning
+  void pop_back() noexcept;                   // unlinks the last element
+  void pop_front() noexcept;                  // unlinks the first element
+  iterator insert(const_iterator pos,
+                  reference value) noexcept;  // links value before pos
+  iterator erase(const_iterator pos) noexcept;  // unlinks the element at pos
+                                                // and returns the next one
+  iterator erase(const_iterator first,
+                 const_iterator last) noexcept;  // unlinks [first, last)
+  void clear() noexcept;                      // unlinks every element
+  void swap(intrusive_list &other) noexcept;  // swaps the contents
+  void splice(const_iterator pos,
+              intrusive_list &other) noexcept;  // moves every element of
+                                                // other before pos
+  void splice(const_iterator pos, intrusive_list &other,
+              const_iterator it) noexcept;  // moves the element at it
+  void splice(const_iterator pos, intrusive_list &other, const_iterator first,
+              const_iterator last) noexcept;  // moves [first, last); O(k) to
+                                              // count k elements of another
+                                              // list
+
+  // bidirectional iterator modeled on ListIterator; end() is the sentinel
+  // hook of the list, so stepping back from it needs no list pointer
+  template <bool Const>
+  class basic_iterator {
+    friend intrusive_list;
+    template <bool>
+    friend class basic_iterator;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    basic_iterator() = default;
+    template <bool Other, typename = std::enable_if_t<Const && !Other>>
+    basic_iterator(const basic_iterator<Other> &other) noexcept
+        : node_(other.node_) {}
+
+    reference operator*() const noexcept { return *owner(node_); }
+    pointer operator->() const noexcept { return owner(node_); }
+    basic_iterator &operator++() noexcept {  // prefix
+      node_ = node_->next_;
+      return *this;
+    }
+    basic_iterator operator++(int) noexcept {  // postfix
+      basic_iterator copy = *this;
+      node_ = node_->next_;
+      return copy;
+    }
+    basic_iterator &operator--() noexcept {  // prefix
+      node_ = node_->prev_;
+      return *this;
+    }
+    basic_iterator operator--(int) noexcept {  // postfix
+      basic_iterator copy = *this;
+      node_ = node_->prev_;
+      return copy;
+    }
+    bool operator==(const basic_iterator &other) const noexcept {
+      return node_ == other.node_;
+    }
+    bool operator!=(const basic_iterator &other) const noexcept {
+      return node_ != other.node_;
+    }
+
+   private:
+    explicit basic_iterator(const intrusive_list_hook *node) noexcept
+        : node_(const_cast<intrusive_list_hook *>(node)) {}
+
+    intrusive_list_hook *node_ = nullptr;
+  };
+
+ private:
+  static std::ptrdiff_t hook_offset() noexcept;  // offset of the hook in T
+  static T *owner(intrusive_list_hook *node) noexcept;  // element of a hook
+  static intrusive_list_hook *hook_of(const_reference value) noexcept;
+  // inserts the chain [first, last] before pos
+  static void link_before(intrusive_list_hook *pos, intrusive_list_hook *first,
+                          intrusive_list_hook *last) noexcept;
+  // takes the chain [first, last] out of its list, leaving its links as
+  // they are
+  static void unlink(intrusive_list_hook *first,
+                     intrusive_list_hook *last) noexcept;
+  void take(intrusive_list &l) noexcept;  // moves the elements of l into this
+                                          // list, which holds none
+
+  intrusive_list_hook root_;  // sentinel: next_ is the head, prev_ the tail
+  size_type size_;
+};
+
+}  // namespace s21
+
+#include "s21_intrusive_list.tpp"
+
+#endif
@@ -0,0 +1,312 @@
+#ifndef S21_INTRUSIVE_LIST_TPP
+#define S21_INTRUSIVE_LIST_TPP
+
+#include "s21_intrusive_list.h"
+
+namespace s21 {
+
+// default constructor
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list() noexcept : size_(0) {
+  root_.next_ = &root_;
+  root_.prev_ = &root_;
+}
+
+// move constructor
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::intrusive_list(intrusive_list &&l) noexcept {
+  take(l);
+}
+
+// destructor, unlinks the elements
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook>::~intrusive_list() {
+  clear();
+  root_.next_ = nullptr;
+  root_.prev_ = nullptr;
+}
+
+// move assignment
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list<T, Hook> &intrusive_list<T, Hook>::operator=(
+    intrusive_list &&l) noexcept {
+  if (this != &l) {
+    clear();
+    take(l);
+  }
+  return *this;
+}
+
+// returns an iterator to the beginning
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator
+intrusive_list<T, Hook>::begin() noexcept {
+  return iterator(root_.next_);
+}
+
+// returns an iterator to the end
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator
+intrusive_list<T, Hook>::end() noexcept {
+  return iterator(&root_);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator
+intrusive_list<T, Hook>::begin() const noexcept {
+  return const_iterator(root_.next_);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator
+intrusive_list<T, Hook>::end() const noexcept {
+  return const_iterator(&root_);
+}
+
+// iterator to an element of this list, found in O(1) from its hook
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::iterator_to(
+    reference value) noexcept {
+  assert(hook_of(value)->is_linked() && "element is not in a list");
+  return iterator(hook_of(value));
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_iterator
+intrusive_list<T, Hook>::iterator_to(const_reference value) const noexcept {
+  assert(hook_of(value)->is_linked() && "element is not in a list");
+  return const_iterator(hook_of(value));
+}
+
+// access the first element
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::reference
+intrusive_list<T, Hook>::front() noexcept {
+  return *begin();
+}
+
+// access the last element
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::reference
+intrusive_list<T, Hook>::back() noexcept {
+  return *owner(root_.prev_);
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_reference
+intrusive_list<T, Hook>::front() const noexcept {
+  return *begin();
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::const_reference
+intrusive_list<T, Hook>::back() const noexcept {
+  return *owner(root_.prev_);
+}
+
+// returns the number of elements
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::size_type intrusive_list<T, Hook>::size()
+    const noexcept {
+  return size_;
+}
+
+// checks whether the container is empty
+template <typename T, intrusive_list_hook T::*Hook>
+bool intrusive_list<T, Hook>::empty() const noexcept {
+  return size_ == 0;
+}
+
+// links value at the end
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_back(reference value) noexcept {
+  insert(end(), value);
+}
+
+// links value at the beginning
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::push_front(reference value) noexcept {
+  insert(begin(), value);
+}
+
+// unlinks the last element
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_back() noexcept {
+  erase(const_iterator(root_.prev_));
+}
+
+// unlinks the first element
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::pop_front() noexcept {
+  erase(begin());
+}
+
+// links value before pos
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(
+    const_iterator pos, reference value) noexcept {
+  intrusive_list_hook *node = hook_of(value);
+  assert(!node->is_linked() && "element is already in a list");
+  link_before(pos.node_, node, node);
+  size_++;
+  return iterator(node);
+}
+
+// unlinks the element at pos and returns the next one
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(
+    const_iterator pos) noexcept {
+  intrusive_list_hook *node = pos.node_;
+  assert(node != &root_ && node->is_linked() && "erasing a missing element");
+  intrusive_list_hook *next = node->next_;
+  unlink(node, node);
+  node->next_ = nullptr;
+  node->prev_ = nullptr;
+  size_--;
+  return iterator(next);
+}
+
+// unlinks [first, last)
+template <typename T, intrusive_list_hook T::*Hook>
+typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(
+    const_iterator first, const_iterator last) noexcept {
+  while (first != last) first = erase(first);
+  return iterator(last.node_);
+}
+
+// unlinks every element
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::clear() noexcept {
+  intrusive_list_hook *node = root_.next_;
+  while (node != &root_) {
+    intrusive_list_hook *next = node->next_;
+    node->next_ = nullptr;
+    node->prev_ = nullptr;
+    node = next;
+  }
+  root_.next_ = &root_;
+  root_.prev_ = &root_;
+  size_ = 0;
+}
+
+// swaps the contents; the sentinels stay put, so the end elements are
+// relinked to them
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::swap(intrusive_list &other) noexcept {
+  if (this == &other) return;
+  intrusive_list tmp(std::move(other));
+  other.take(*this);
+  take(tmp);
+}
+
+// moves every element of other before pos
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                     intrusive_list &other) noexcept {
+  if (this == &other || other.empty()) return;
+  intrusive_list_hook *first = other.root_.next_;
+  intrusive_list_hook *last = other.root_.prev_;
+  unlink(first, last);
+  link_before(pos.node_, first, last);
+  size_ += other.size_;
+  other.size_ = 0;
+}
+
+// moves the element at it from other to before pos
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list &other,
+                                     const_iterator it) noexcept {
+  intrusive_list_hook *node = it.node_;
+  if (node == pos.node_ || node->next_ == pos.node_) return;
+  unlink(node, node);
+  link_before(pos.node_, node, node);
+  other.size_--;
+  size_++;
+}
+
+// moves [first, last) from other to before pos; O(1) inside one list,
+// otherwise O(k) to count the k moved elements
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::splice(const_iterator pos, intrusive_list &other,
+                                     const_iterator first,
+                                     const_iterator last) noexcept {
+  if (first == last || pos == last) return;
+  intrusive_list_hook *first_node = first.node_;
+  intrusive_list_hook *last_node = last.node_->prev_;
+  if (this != &other) {
+    size_type count = 1;
+    for (intrusive_list_hook *node = first_node; node != last_node;
+         node = node->next_) {
+      count++;
+    }
+    other.size_ -= count;
+    size_ += count;
+  }
+  unlink(first_node, last_node);
+  link_before(pos.node_, first_node, last_node);
+}
+
+// offset of the hook in T, measured on an aligned buffer of T's size; no T
+// is read through it
+template <typename T, intrusive_list_hook T::*Hook>
+std::ptrdiff_t intrusive_list<T, Hook>::hook_offset() noexcept {
+  alignas(T) static const unsigned char probe[sizeof(T)] = {};
+  const T *object = reinterpret_cast<const T *>(probe);
+  return reinterpret_cast<const unsigned char *>(&(object->*Hook)) - probe;
+}
+
+// element of a hook
+template <typename T, intrusive_list_hook T::*Hook>
+T *intrusive_list<T, Hook>::owner(intrusive_list_hook *node) noexcept {
+  return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(node) -
+                               hook_offset());
+}
+
+template <typename T, intrusive_list_hook T::*Hook>
+intrusive_list_hook *intrusive_list<T, Hook>::hook_of(
+    const_reference value) noexcept {
+  return const_cast<intrusive_list_hook *>(&(value.*Hook));
+}
+
+// inserts the chain [first, last] before pos
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::link_before(intrusive_list_hook *pos,
+                                          intrusive_list_hook *first,
+                                          intrusive_list_hook *last) noexcept {
+  intrusive_list_hook *prev = pos->prev_;
+  first->prev_ = prev;
+  last->next_ = pos;
+  prev->next_ = first;
+  pos->prev_ = last;
+}
+
+// takes the chain [first, last] out of its list
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::unlink(intrusive_list_hook *first,
+                                     intrusive_list_hook *last) noexcept {
+  first->prev_->next_ = last->next_;
+  last->next_->prev_ = first->prev_;
+}
+
+// moves the chain of l here, discarding the links of this list, and leaves
+// l empty
+template <typename T, intrusive_list_hook T::*Hook>
+void intrusive_list<T, Hook>::take(intrusive_list &l) noexcept {
+  size_ = l.size_;
+  if (l.size_ == 0) {
+    root_.next_ = &root_;
+    root_.prev_ = &root_;
+    return;
+  }
+  root_.next_ = l.root_.next_;
+  root_.prev_ = l.root_.prev_;
+  root_.next_->prev_ = &root_;
+  root_.prev_->next_ = &root_;
+  l.root_.next_ = &l.root_;
+  l.root_.prev_ = &l.root_;
+  l.size_ = 0;
+}
+
+}  // namespace s21
+
+#endif
@@ -2,24 +2,49 @@
 #define S21_LINKED_LIST_H
 
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include "../s21_memory.h"
 
 namespace s21 {
 
-template <typename T>
-class linked_list {
+// nodes come from Allocator rebound to the node type; the allocator must
+// hand out plain pointers
+template <typename T, typename Allocator = std::allocator<T>>
+class linked_list : private allocator_holder<Allocator> {
+  static_assert(std::is_same<typename Allocator::value_type, T>::value,
+                "Error! linked_list needs an allocator of its value_type");
+
  public:
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   linked_list();  // default constructor, creates empty linked_list
-  linked_list(std::initializer_list<value_type> const &items);  // init list
+  explicit linked_list(const Allocator &alloc) noexcept;  // empty linked_list
+                                                          // using alloc
+  linked_list(std::initializer_list<value_type> const &items,
+              const Allocator &alloc = Allocator());  // init list
   linked_list(const linked_list &q);  // copy constructor
-  linked_list(linked_list &&q);       // move constructor
-  ~linked_list();                     // destructor
-  linked_list &operator=(
-      linked_list &&q);  // assignment operator overload for moving object
+  linked_list(const linked_list &q,
+              const Allocator &alloc);  // copy constructor using alloc
+  linked_list(linked_list &&q) noexcept;  // move constructor, takes the nodes
+                                          // of q
+  linked_list(linked_list &&q,
+              const Allocator &alloc);  // takes the nodes of q when alloc can
+                                        // free them, moves the elements
+                                        // otherwise
+  ~linked_list();                       // destructor
+  linked_list &operator=(linked_list &&q) noexcept(
+      allocator_moves_storage_v<Allocator>);  // assignment operator overload
+                                              // for moving object, frees the
+                                              // current nodes
+
+  allocator_type get_allocator() const noexcept;  // returns the allocator
 
   const_reference front();  // access the first element
   const_reference back();   // access the last element
@@ -28,15 +53,34 @@ class linked_list {
   size_type size();
 
   void push_back(const_reference value);   // inserts element at the end
+  void push_back(value_type &&value);      // moves an element to the end
   void push_front(const_reference value);  // inserts element at the top
+  void push_front(value_type &&value);     // moves an element to the top
+  template <typename... Args>
+  reference emplace_back(Args &&...args);  // constructs an element in place
+                                           // at the end
+  template <typename... Args>
+  reference emplace_front(Args &&...args);  // constructs an element in place
+                                            // at the top
 
   void pop();                     // remove first elem
-  void swap(linked_list &other);  // swaps the contents
+  void pop_front();               // remove first elem
+  void swap(linked_list &other) noexcept;  // swaps the contents
 
   void copy(const linked_list &q);
 
  private:
+  using allocator_holder<Allocator>::allocator;
+
+  void take_nodes(linked_list &q) noexcept;  // frees the nodes and takes the
+                                             // ones of q
+
+  // the payload is built in place from the arguments of the node
   typedef struct Node {
+    template <typename... Args>
+    explicit Node(Node *next, Args &&...args)
+        : data_(std::forward<Args>(args)...), next_(next) {}
+
     value_type data_;
     Node *next_;
   } Node;
@@ -46,6 +90,24 @@ class linked_list {
   size_type size_;
 };
 
+// the nodes do not point back into the object, so a linked_list can be moved
+// to another address with memcpy when its allocator can: a stateless one
+// like std::allocator always can, others say so through their own trait
+template <typename T, typename Allocator>
+struct is_trivially_relocatable<linked_list<T, Allocator>>
+    : std::integral_constant<bool,
+                             std::is_empty<Allocator>::value ||
+                                 is_trivially_relocatable<Allocator>::value> {
+};
+
+namespace pmr {
+
+// linked_list whose nodes come from a std::pmr::memory_resource
+template <typename T>
+using linked_list = s21::linked_list<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #include "s21_linked_list.tpp"
@@ -2,79 +2,159 @@
 
 namespace s21 {
 
-template <typename T>
-linked_list<T>::linked_list() : head_(nullptr), tail_(nullptr), size_(0) {}
-
-template <typename T>
-linked_list<T>::linked_list(std::initializer_list<value_type> const &items)
-    : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename T, typename Allocator>
+linked_list<T, Allocator>::linked_list() : linked_list(Allocator()) {}
+
+template <typename T, typename Allocator>
+linked_list<T, Allocator>::linked_list(const Allocator &alloc) noexcept
+    : allocator_holder<Allocator>(alloc),
+      head_(nullptr),
+      tail_(nullptr),
+      size_(0) {}
+
+template <typename T, typename Allocator>
+linked_list<T, Allocator>::linked_list(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : linked_list(alloc) {
   for (const value_type &item : items) {
     push_back(item);
   }
 }
 
-template <typename T>
-linked_list<T>::linked_list(const linked_list &q)
-    : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename T, typename Allocator>
+linked_list<T, Allocator>::linked_list(const linked_list &q)
+    : linked_list(q, std::allocator_traits<Allocator>::
+                         select_on_container_copy_construction(
+                             q.allocator())) {}
+
+template <typename T, typename Allocator>
+linked_list<T, Allocator>::linked_list(const linked_list &q,
+                                       const Allocator &alloc)
+    : linked_list(alloc) {
   copy(q);
 }
 
-template <typename T>
-linked_list<T>::linked_list(linked_list &&q)
-    : head_(nullptr), tail_(nullptr), size_(0) {
-  copy(q);
+template <typename T, typename Allocator>
+linked_list<T, Allocator>::linked_list(linked_list &&q) noexcept
+    : allocator_holder<Allocator>(q.allocator()),
+      head_(q.head_),
+      tail_(q.tail_),
+      size_(q.size_) {
+  q.head_ = nullptr;
+  q.tail_ = nullptr;
+  q.size_ = 0;
+}
 
-  while (!q.empty()) q.pop();
+template <typename T, typename Allocator>
+linked_list<T, Allocator>::linked_list(linked_list &&q,
+                                       const Allocator &alloc)
+    : linked_list(alloc) {
+  if (allocators_equal(allocator(), q.allocator())) {
+    take_nodes(q);
+  } else {
+    for (Node *n = q.head_; n != nullptr; n = n->next_) {
+      emplace_back(std::move(n->data_));
+    }
+  }
 }
 
-template <typename T>
-linked_list<T>::~linked_list() {
+template <typename T, typename Allocator>
+linked_list<T, Allocator>::~linked_list() {
   while (!empty()) pop();
 }
 
-template <typename T>
-linked_list<T> &linked_list<T>::operator=(linked_list &&q) {
-  copy(q);
-  while (!q.empty()) q.pop();
-
+// with unequal allocators that stay put the elements of q are moved one by
+// one into nodes of this list
+template <typename T, typename Allocator>
+linked_list<T, Allocator> &
+linked_list<T, Allocator>::operator=(
+    linked_list &&q) noexcept(allocator_moves_storage_v<Allocator>) {
+  if (this == &q) return *this;
+  if constexpr (allocator_moves_storage_v<Allocator>) {
+    take_nodes(q);
+  } else if (allocators_equal(allocator(), q.allocator())) {
+    take_nodes(q);
+  } else {
+    linked_list moved(allocator());
+    for (Node *n = q.head_; n != nullptr; n = n->next_) {
+      moved.emplace_back(std::move(n->data_));
+    }
+    take_nodes(moved);
+  }
   return *this;
 }
 
-template <typename T>
-typename linked_list<T>::const_reference linked_list<T>::front() {
+template <typename T, typename Allocator>
+typename linked_list<T, Allocator>::allocator_type
+linked_list<T, Allocator>::get_allocator() const noexcept {
+  return allocator();
+}
+
+template <typename T, typename Allocator>
+typename linked_list<T, Allocator>::const_reference
+linked_list<T, Allocator>::front() {
   return head_->data_;
 }
 
-template <typename T>
-typename linked_list<T>::const_reference linked_list<T>::back() {
+template <typename T, typename Allocator>
+typename linked_list<T, Allocator>::const_reference
+linked_list<T, Allocator>::back() {
   return tail_->data_;
 }
 
-template <typename T>
-bool linked_list<T>::empty() {
+template <typename T, typename Allocator>
+bool linked_list<T, Allocator>::empty() {
   return head_ == nullptr;
 }
 
-template <typename T>
-typename linked_list<T>::size_type linked_list<T>::size() {
+template <typename T, typename Allocator>
+typename linked_list<T, Allocator>::size_type
+linked_list<T, Allocator>::size() {
   return size_;
 }
 
-template <typename T>
-void linked_list<T>::pop() {
+template <typename T, typename Allocator>
+void linked_list<T, Allocator>::pop() {
+  pop_front();
+}
+
+template <typename T, typename Allocator>
+void linked_list<T, Allocator>::pop_front() {
   if (head_) {
     Node *nextNode = head_;
     head_ = nextNode->next_;
+    if (!head_) tail_ = nullptr;
     size_--;
-    delete nextNode;
+    deallocate_node(allocator(), nextNode);
   }
 }
 
-template <typename T>
-void linked_list<T>::push_back(const_reference value) {
-  Node *newNode = new Node;
-  newNode->data_ = value;
-  newNode->next_ = nullptr;
+template <typename T, typename Allocator>
+void linked_list<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void linked_list<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+void linked_list<T, Allocator>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, typename Allocator>
+void linked_list<T, Allocator>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename linked_list<T, Allocator>::reference
+linked_list<T, Allocator>::emplace_back(Args &&...args) {
+  Node *newNode =
+      allocate_node<Node>(allocator(), nullptr, std::forward<Args>(args)...);
   if (!head_) {
     head_ = newNode;
   }
@@ -83,41 +163,64 @@ void linked_list<T>::push_back(const_reference value) {
   }
   tail_ = newNode;
   size_++;
+  return newNode->data_;
 }
 
-template <typename T>
-void linked_list<T>::push_front(const_reference value) {
-  Node *newNode = new Node;
-  newNode->data_ = value;
-  newNode->next_ = head_;
+template <typename T, typename Allocator>
+template <typename... Args>
+typename linked_list<T, Allocator>::reference
+linked_list<T, Allocator>::emplace_front(Args &&...args) {
+  Node *newNode =
+      allocate_node<Node>(allocator(), head_, std::forward<Args>(args)...);
   head_ = newNode;
   if (!tail_) tail_ = newNode;
   size_++;
+  return newNode->data_;
 }
 
-template <typename T>
-void linked_list<T>::swap(linked_list &other) {
+template <typename T, typename Allocator>
+void linked_list<T, Allocator>::swap(linked_list &other) noexcept {
+  if constexpr (std::allocator_traits<
+                    Allocator>::propagate_on_container_swap::value) {
+    std::swap(allocator(), other.allocator());
+  }
   std::swap(this->size_, other.size_);
   std::swap(this->head_, other.head_);
   std::swap(this->tail_, other.tail_);
 }
 
-template <typename T>
-void linked_list<T>::copy(const linked_list &s) {
-  Node *tail = nullptr;
+// appends copies of the elements of s; the copies are chained apart first,
+// so an exception leaves the list as it was
+template <typename T, typename Allocator>
+void linked_list<T, Allocator>::copy(const linked_list &s) {
+  linked_list copies(allocator());
   for (Node *n = s.head_; n != nullptr; n = n->next_) {
-    Node *current = new Node;
-    current->data_ = n->data_;
-    current->next_ = nullptr;
-
-    if (!head_) {
-      head_ = current;
-    } else {
-      tail->next_ = current;
-    }
-    tail = current;
+    copies.emplace_back(n->data_);
+  }
+  if (copies.empty()) return;
+  if (tail_) {
+    tail_->next_ = copies.head_;
+  } else {
+    head_ = copies.head_;
+  }
+  tail_ = copies.tail_;
+  size_ += copies.size_;
+  copies.head_ = copies.tail_ = nullptr;
+  copies.size_ = 0;
+}
+
+// frees the nodes and takes the ones of q, along with its allocator when
+// that propagates on move assignment
+template <typename T, typename Allocator>
+void linked_list<T, Allocator>::take_nodes(linked_list &q) noexcept {
+  while (!empty()) pop();
+  if constexpr (std::allocator_traits<Allocator>::
+                    propagate_on_container_move_assignment::value) {
+    allocator() = std::move(q.allocator());
   }
-  size_ = s.size_;
+  std::swap(head_, q.head_);
+  std::swap(tail_, q.tail_);
+  std::swap(size_, q.size_);
 }
 
 }  // namespace s21
\ No newline at end of file
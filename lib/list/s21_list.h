@@ -1,49 +1,84 @@
 #ifndef S21_LIST_H
 #define S21_LIST_H
 
+#include <functional>
+#include <memory>
+#include <memory_resource>
+
+#include "../algorithm/s21_radix_sort.h"
+
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class ListIterator;
 
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class ListConstIterator;
 
-template <typename T>
-class list {
-  friend ListIterator<T>;
-  friend ListConstIterator<T>;
+// nodes come from Allocator rebound to the node type; the allocator must
+// hand out plain pointers
+template <typename T, typename Allocator = std::allocator<T>>
+class list : private allocator_holder<Allocator> {
+  friend ListIterator<T, Allocator>;
+  friend ListConstIterator<T, Allocator>;
+  static_assert(std::is_same<typename Allocator::value_type, T>::value,
+                "Error! list needs an allocator of its value_type");
 
  public:
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
-  using iterator = ListIterator<T>;
-  using const_iterator = ListConstIterator<T>;
+  using iterator = ListIterator<T, Allocator>;
+  using const_iterator = ListConstIterator<T, Allocator>;
+  using allocator_type = Allocator;
 
   list();   // default constructor
   ~list();  // destructor
-  explicit list(
-      size_type n);     // parameterized constructor, creates the list of size n
-  list(const list& l);  // copy constructor
-  list(list&& l);       // move constructor
-  list(std::initializer_list<value_type> const&
-           items);  // initializer list constructor, creates list initizialized
-                    // using std::initializer_list
+  explicit list(const Allocator& alloc) noexcept;  // empty list using alloc
+  explicit list(size_type n,
+                const Allocator& alloc =
+                    Allocator());  // parameterized constructor, creates the
+                                   // list of size n
+  list(const list& l);             // copy constructor
+  list(const list& l, const Allocator& alloc);  // copy constructor using alloc
+  list(list&& l);                               // move constructor
+  list(list&& l,
+       const Allocator& alloc);  // takes the nodes of l when alloc can free
+                                 // them, moves the elements otherwise
+  list(std::initializer_list<value_type> const& items,
+       const Allocator& alloc =
+           Allocator());  // initializer list constructor, creates list
+                          // initizialized using std::initializer_list
+
+  allocator_type get_allocator() const noexcept;  // returns the allocator
 
   size_type size() const noexcept;  // returns the number of elements
   iterator insert(
       iterator pos,
       const_reference value);  // inserts elements into concrete pos and returns
                                // the iterator that points to the new element
+  iterator insert(iterator pos,
+                  value_type&& value);  // moves value into concrete pos
+  template <typename... Args>
+  iterator emplace(const_iterator pos,
+                   Args&&... args);  // constructs an element in place
+                                     // directly before pos
   iterator begin() noexcept;   // returns an iterator to the beginning
   iterator end() noexcept;     // returns an iterator to the end
   const_iterator begin()
       const noexcept;                   // returns an iterator to the beginning
   const_iterator end() const noexcept;  // returns an iterator to the end
   void push_back(const_reference value);   // adds an element to the end
+  void push_back(value_type&& value);      // moves an element to the end
   void push_front(const_reference value);  // adds an element to the end
+  void push_front(value_type&& value);     // moves an element to the beginning
+  template <typename... Args>
+  reference emplace_back(Args&&... args);  // constructs an element in place
+                                           // at the end
+  template <typename... Args>
+  reference emplace_front(Args&&... args);  // constructs an element in place
+                                            // at the beginning
   void pop_back();                         // removes the last element
   void pop_front();                        // removes the first element
   bool empty() const noexcept;    // checks whether the container is empty
@@ -58,8 +93,24 @@ class list {
   void splice(
       const_iterator pos,
       list& other);  // transfers elements from list other starting from pos
+  void splice(const_iterator pos, list& other,
+              const_iterator it);  // transfers the element at it from other
+                                   // to before pos
+  void splice(const_iterator pos, list& other, const_iterator first,
+              const_iterator last);  // transfers [first, last) from other to
+                                     // before pos
   void sort();       // sorts the elements
+  template <typename Compare>
+  void sort(Compare comp);  // sorts the elements by comp, keeping the order of
+                            // equal elements
+  template <typename KeyFn = radix_identity>
+  void radix_sort(KeyFn key = KeyFn());  // sorts the elements by an integer
+                                         // or floating key, relinking nodes
   void merge(list& other);  // merges two sorted lists
+  template <typename Compare>
+  void merge(list& other,
+             Compare comp);  // merges two lists sorted by comp, elements of
+                             // this list go first among equals
   void unique();            // removes consecutive duplicate elements
 
   // bonus part
@@ -83,9 +134,34 @@ class list {
     T data_;
     ListNode_* next_;
     ListNode_* prev_;
-    explicit ListNode_(const T& data);
+    template <typename... Args>
+    explicit ListNode_(Args&&... args);  // builds data_ from args in place
   };
 
+  using allocator_holder<Allocator>::allocator;
+
+  void take_nodes(list& l) noexcept;  // takes the nodes of l into this
+                                      // empty list
+
+  template <unsigned Bits, typename KeyFn>
+  void radix_relink(KeyFn& key);  // radix_sort with Bits-wide digits
+  template <typename Compare>
+  static ListNode_* cut_run(ListNode_*& run,
+                            Compare& comp);  // detaches the sorted run that
+                                             // starts at run, returns the rest
+  template <typename Compare>
+  static ListNode_* merge_chains(ListNode_* left, ListNode_* right,
+                                 Compare& comp);  // merges two sorted
+                                                  // nullptr-terminated chains
+  void relink(ListNode_* first) noexcept;  // makes the chain from first the
+                                           // contents, fixing prev_ and tail_
+  void link_before(ListNode_* pos, ListNode_* first,
+                   ListNode_* last) noexcept;  // inserts the chain
+                                               // [first, last] before pos
+  void unlink(ListNode_* first,
+              ListNode_* last) noexcept;  // takes [first, last] out of the
+                                          // list, leaving size_ as it is
+
   ListNode_* head_;  // first elem
   ListNode_* tail_;  // last elem
   size_type size_;   // size
@@ -93,20 +169,22 @@ class list {
 
 // internal class ListIterator<T> defines the type for iterating through the
 // container
-template <typename T>
+template <typename T, typename Allocator>
 class ListIterator {
-  friend list<T>;
+  friend list<T, Allocator>;
 
  public:
   ListIterator();
-  explicit ListIterator(const typename list<T>::ListNode_* list_element_ptr,
-                        const list<T>* list_ptr_);
-  explicit ListIterator(typename list<T>::ListNode_* list_element_ptr,
-                        const list<T>* list_ptr_);
+  explicit ListIterator(
+      const typename list<T, Allocator>::ListNode_* list_element_ptr,
+      const list<T, Allocator>* list_ptr_);
+  explicit ListIterator(
+      typename list<T, Allocator>::ListNode_* list_element_ptr,
+      const list<T, Allocator>* list_ptr_);
   ListIterator(std::nullptr_t) : iterator_(nullptr){};
   ListIterator(const ListIterator& list_original_element,
-               const list<T>* list_ptr_);
-  typename list<T>::reference operator*();
+               const list<T, Allocator>* list_ptr_);
+  typename list<T, Allocator>::reference operator*();
   ListIterator& operator++();     // prefix
   ListIterator& operator++(int);  // postfix
   ListIterator& operator--();     // prefix
@@ -117,29 +195,38 @@ class ListIterator {
   bool operator!=(const ListIterator& other);
 
  protected:
-  typename list<T>::ListNode_* iterator_;
-  const list<T>* list_ptr_;
+  typename list<T, Allocator>::ListNode_* iterator_;
+  const list<T, Allocator>* list_ptr_;
 };
 
 // internal class ListConstIterator<T> defines the constant type for iterating
 // through the container
-template <typename T>
-class ListConstIterator : public ListIterator<T> {
-  friend list<T>;
+template <typename T, typename Allocator>
+class ListConstIterator : public ListIterator<T, Allocator> {
+  friend list<T, Allocator>;
 
  public:
-  ListConstIterator() : ListIterator<T>() {}
+  ListConstIterator() : ListIterator<T, Allocator>() {}
   explicit ListConstIterator(
-      const typename list<T>::ListNode_* list_element_ptr,
-      const list<T>* list_ptr_);
-  ListConstIterator(std::nullptr_t) : ListIterator<T>(nullptr) {}
-  ListConstIterator(const ListIterator<T>& other) : ListIterator<T>(other) {}
-  const typename list<T>::const_reference operator*() const;
-  const typename list<T>::ListNode_* operator->() const {
+      const typename list<T, Allocator>::ListNode_* list_element_ptr,
+      const list<T, Allocator>* list_ptr_);
+  ListConstIterator(std::nullptr_t) : ListIterator<T, Allocator>(nullptr) {}
+  ListConstIterator(const ListIterator<T, Allocator>& other)
+      : ListIterator<T, Allocator>(other) {}
+  const typename list<T, Allocator>::const_reference operator*() const;
+  const typename list<T, Allocator>::ListNode_* operator->() const {
     return this->iterator_;
   }
 };
 
+namespace pmr {
+
+// list whose nodes come from a std::pmr::memory_resource
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #include "s21_list.tpp"
@@ -6,20 +6,36 @@
 namespace s21 {
 
 // default constructor
-template <typename T>
-list<T>::list() : head_(nullptr), tail_(nullptr), size_(0) {}
+template <typename T, typename Allocator>
+list<T, Allocator>::list() : list(Allocator()) {}
+
+// empty list using alloc
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const Allocator& alloc) noexcept
+    : allocator_holder<Allocator>(alloc),
+      head_(nullptr),
+      tail_(nullptr),
+      size_(0) {}
 
 // parameterized constructor, creates the list of size n
-template <typename T>
-list<T>::list(size_type n) : list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(size_type n, const Allocator& alloc) : list(alloc) {
   for (size_type i = 0; i < n; i++) {
-    push_front(T());
+    emplace_front();
   }
 }
 
-// copy constructor
-template <typename T>
-list<T>::list(const list& l) : list() {
+// copy constructor; the allocator is the one the allocator of l picks for
+// copies
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const list& l)
+    : list(l, std::allocator_traits<
+                  Allocator>::select_on_container_copy_construction(
+                  l.allocator())) {}
+
+// copy constructor using alloc
+template <typename T, typename Allocator>
+list<T, Allocator>::list(const list& l, const Allocator& alloc) : list(alloc) {
   ListNode_* current = l.head_;
   while (current) {
     push_back(current->data_);
@@ -28,56 +44,96 @@ list<T>::list(const list& l) : list() {
 }
 
 // move constructor
-template <typename T>
-list<T>::list(list&& l) : head_(nullptr), tail_(nullptr), size_(0) {
-  swap(l);
+template <typename T, typename Allocator>
+list<T, Allocator>::list(list&& l) : list(l.allocator()) {
+  take_nodes(l);
+}
+
+// takes the nodes of l when alloc can free them, moves the elements into
+// nodes from alloc otherwise
+template <typename T, typename Allocator>
+list<T, Allocator>::list(list&& l, const Allocator& alloc) : list(alloc) {
+  if (allocators_equal(allocator(), l.allocator())) {
+    take_nodes(l);
+  } else {
+    for (ListNode_* current = l.head_; current; current = current->next_) {
+      push_back(std::move(current->data_));
+    }
+  }
 }
 
 // initializer list constructor, creates list initizialized using
 // std::initializer_list
-template <typename T>
-list<T>::list(std::initializer_list<value_type> const& items) : list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::list(std::initializer_list<value_type> const& items,
+                         const Allocator& alloc)
+    : list(alloc) {
   for (const auto& iter : items) {
     push_back(iter);
   }
 }
 
+// returns the allocator
+template <typename T, typename Allocator>
+typename list<T, Allocator>::allocator_type
+list<T, Allocator>::get_allocator() const noexcept {
+  return allocator();
+}
+
 // destructor
-template <typename T>
-list<T>::~list() {
+template <typename T, typename Allocator>
+list<T, Allocator>::~list() {
   while (head_) {
     ListNode_* temp = head_;
     head_ = head_->next_;
-    delete temp;
+    deallocate_node(allocator(), temp);
   }
   tail_ = nullptr;
   size_ = 0;
 }
 
 // returns the number of elements
-template <typename T>
-typename list<T>::size_type list<T>::size() const noexcept {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type
+list<T, Allocator>::size() const noexcept {
   return size_;
 }
 
 // checks whether the container is empty
-template <typename T>
-bool list<T>::empty() const noexcept {
+template <typename T, typename Allocator>
+bool list<T, Allocator>::empty() const noexcept {
   return !static_cast<bool>(size());
 }
 
 // create node for list
-template <typename T>
-list<T>::ListNode_::ListNode_(const T& data)
-    : data_(data), next_(nullptr), prev_(nullptr){};
+template <typename T, typename Allocator>
+template <typename... Args>
+list<T, Allocator>::ListNode_::ListNode_(Args&&... args)
+    : data_(std::forward<Args>(args)...), next_(nullptr), prev_(nullptr) {}
 
 // inserts elements into concrete pos and returns the iterator that points to
 // the new element cppreference says "Inserts value before pos"
-template <typename T>
-typename list<T>::iterator list<T>::insert(iterator pos,
-                                           const_reference value) {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator
+list<T, Allocator>::insert(iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+// moves value into concrete pos
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator
+list<T, Allocator>::insert(iterator pos, value_type&& value) {
+  return emplace(pos, std::move(value));
+}
+
+// constructs an element from args in its node, directly before pos
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::iterator
+list<T, Allocator>::emplace(const_iterator pos, Args&&... args) {
   ListNode_* old_position = pos.iterator_;
-  ListNode_* new_element = new ListNode_(value);
+  ListNode_* new_element =
+      allocate_node<ListNode_>(allocator(), std::forward<Args>(args)...);
   if (empty()) {
     head_ = new_element;
     tail_ = new_element;
@@ -99,63 +155,94 @@ typename list<T>::iterator list<T>::insert(iterator pos,
 }
 
 // returns an iterator to the beginning
-template <typename T>
-typename list<T>::iterator list<T>::begin() noexcept {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::begin() noexcept {
   return iterator(head_, this);
 }
 
 // returns an iterator to the end
-template <typename T>
-typename list<T>::iterator list<T>::end() noexcept {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::iterator list<T, Allocator>::end() noexcept {
   return iterator(tail_ ? tail_->next_ : nullptr, this);
 }
 
 // returns an iterator to the beginning
-template <typename T>
-typename list<T>::const_iterator list<T>::begin() const noexcept {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator
+list<T, Allocator>::begin() const noexcept {
   return const_iterator(head_, this);
 }
 
 // returns an iterator to the end
-template <typename T>
-typename list<T>::const_iterator list<T>::end() const noexcept {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_iterator
+list<T, Allocator>::end() const noexcept {
   return const_iterator(tail_ ? tail_->next_ : nullptr, this);
 }
 
 // adds an element to the end
-template <typename T>
-void list<T>::push_back(const_reference value) {
-  insert(end(), value);
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(const_reference value) {
+  emplace(end(), value);
+}
+
+// moves an element to the end
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_back(value_type&& value) {
+  emplace(end(), std::move(value));
 }
 
 // adds an element to the beginning
-template <typename T>
-void list<T>::push_front(const_reference value) {
-  insert(begin(), value);
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(const_reference value) {
+  emplace(begin(), value);
+}
+
+// moves an element to the beginning
+template <typename T, typename Allocator>
+void list<T, Allocator>::push_front(value_type&& value) {
+  emplace(begin(), std::move(value));
+}
+
+// constructs an element in place at the end
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::reference
+list<T, Allocator>::emplace_back(Args&&... args) {
+  return *emplace(end(), std::forward<Args>(args)...);
+}
+
+// constructs an element in place at the beginning
+template <typename T, typename Allocator>
+template <typename... Args>
+typename list<T, Allocator>::reference
+list<T, Allocator>::emplace_front(Args&&... args) {
+  return *emplace(begin(), std::forward<Args>(args)...);
 }
 
 // access the first element
-template <typename T>
-typename list<T>::const_reference list<T>::front() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::front() const {
   return *begin();
 }
 
 // access the last element
-template <typename T>
-typename list<T>::const_reference list<T>::back() const {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::const_reference list<T, Allocator>::back() const {
   return *(end()--);
 }
 
 // returns the maximum possible number of elements
-template <typename T>
-typename list<T>::size_type list<T>::max_size() const noexcept {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::size_type
+list<T, Allocator>::max_size() const noexcept {
   size_type bits = (sizeof(void*) == 4) ? 31 : 63;
   return (static_cast<size_type>(1) << bits) / sizeof(ListNode_);
 }
 
 // erases element at pos
-template <typename T>
-void list<T>::erase(iterator pos) {
+template <typename T, typename Allocator>
+void list<T, Allocator>::erase(iterator pos) {
   if (empty() || pos == end()) {
     throw std::out_of_range("Error! You can't erase this element");
   }
@@ -170,114 +257,330 @@ void list<T>::erase(iterator pos) {
   } else {
     tail_ = delete_position->prev_;
   }
-  delete delete_position;
+  deallocate_node(allocator(), delete_position);
   size_--;
 }
 
 // clears the contents
-template <typename T>
-void list<T>::clear() noexcept {
+template <typename T, typename Allocator>
+void list<T, Allocator>::clear() noexcept {
   while (!empty()) erase(begin());
 }
 
 // removes the last element
-template <typename T>
-void list<T>::pop_back() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_back() {
   erase(--end());
 }
 
 // removes the first element
-template <typename T>
-void list<T>::pop_front() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::pop_front() {
   erase(begin());
 }
 
 // swaps the contents
-template <typename T>
-void list<T>::swap(list& other) noexcept {
+template <typename T, typename Allocator>
+void list<T, Allocator>::swap(list& other) noexcept {
+  if constexpr (std::allocator_traits<
+                    Allocator>::propagate_on_container_swap::value) {
+    std::swap(this->allocator(), other.allocator());
+  }
   std::swap(this->head_, other.head_);
   std::swap(this->tail_, other.tail_);
   std::swap(this->size_, other.size_);
 }
 
 // reverses the order of the elements
-template <typename T>
-void list<T>::reverse() noexcept {
-  if (size() > 1) {
-    iterator left = begin();
-    iterator right = --end();
-    while (left < right) {
-      std::swap(*left, *right);
-      ++left;
-      --right;
-    }
+template <typename T, typename Allocator>
+void list<T, Allocator>::reverse() noexcept {
+  for (ListNode_* node = head_; node; node = node->prev_) {
+    std::swap(node->next_, node->prev_);
   }
+  std::swap(head_, tail_);
 }
 
 // transfers elements from list other starting from pos
-template <typename T>
-void list<T>::splice(const_iterator pos, list& other) {
-  if (!empty()) {
-    ListNode_* position = pos.iterator_;
-    if (empty()) {
-      head_ = other.head_;
-      tail_ = other.tail_;
-    } else if (position == tail_->next_) {
-      tail_->next_ = other.head_;
-      other.head_->prev_ = tail_;
-      tail_ = other.tail_;
-    } else {
-      other.tail_->next_ = position;
-      other.tail_->prev_ = position->prev_;
-      if (position->prev_)
-        position->prev_->next_ = other.head_;
-      else
-        head_ = other.head_;
-      position->prev_ = other.tail_;
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(const_iterator pos, list& other) {
+  if (this == &other || other.empty()) return;
+  link_before(pos.iterator_, other.head_, other.tail_);
+  size_ += other.size_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.size_ = 0;
+}
+
+// transfers the element at it from other to before pos
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(const_iterator pos, list& other,
+                                const_iterator it) {
+  ListNode_* node = it.iterator_;
+  if (this == &other && (node == pos.iterator_ || node->next_ == pos.iterator_))
+    return;
+  other.unlink(node, node);
+  other.size_--;
+  link_before(pos.iterator_, node, node);
+  size_++;
+}
+
+// transfers [first, last) from other to before pos; O(1) inside one list,
+// otherwise O(k) to count the k moved elements
+template <typename T, typename Allocator>
+void list<T, Allocator>::splice(const_iterator pos, list& other,
+                                const_iterator first, const_iterator last) {
+  if (first == last) return;
+  ListNode_* first_node = first.iterator_;
+  ListNode_* last_node = last.iterator_ ? last.iterator_->prev_ : other.tail_;
+  if (this != &other) {
+    size_type count = 1;
+    for (ListNode_* node = first_node; node != last_node; node = node->next_) {
+      count++;
     }
-    size_ += other.size();
-    other.head_ = nullptr;
-    other.tail_ = nullptr;
+    other.size_ -= count;
+    size_ += count;
+  } else if (pos.iterator_ == last.iterator_) {
+    return;
+  }
+  other.unlink(first_node, last_node);
+  link_before(pos.iterator_, first_node, last_node);
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::link_before(ListNode_* pos, ListNode_* first,
+                                     ListNode_* last) noexcept {
+  ListNode_* prev = pos ? pos->prev_ : tail_;
+  first->prev_ = prev;
+  last->next_ = pos;
+  if (prev) {
+    prev->next_ = first;
+  } else {
+    head_ = first;
+  }
+  if (pos) {
+    pos->prev_ = last;
+  } else {
+    tail_ = last;
   }
 }
 
+template <typename T, typename Allocator>
+void list<T, Allocator>::unlink(ListNode_* first, ListNode_* last) noexcept {
+  if (first->prev_) {
+    first->prev_->next_ = last->next_;
+  } else {
+    head_ = last->next_;
+  }
+  if (last->next_) {
+    last->next_->prev_ = first->prev_;
+  } else {
+    tail_ = first->prev_;
+  }
+  first->prev_ = nullptr;
+  last->next_ = nullptr;
+}
+
+// takes the nodes of l into this empty list; the allocator of this list must
+// be able to free them
+template <typename T, typename Allocator>
+void list<T, Allocator>::take_nodes(list& l) noexcept {
+  std::swap(head_, l.head_);
+  std::swap(tail_, l.tail_);
+  std::swap(size_, l.size_);
+}
+
 // sorts the elements
-template <typename T>
-void list<T>::sort() {
-  if (!empty()) {
-    bool swap = true;
-    while (swap) {
-      swap = false;
-      ListNode_* cur = head_;
-      while (cur->next_) {
-        if (cur->data_ > cur->next_->data_) {
-          std::swap(cur->data_, cur->next_->data_);
-          swap = true;
-        }
-        cur = cur->next_;
+template <typename T, typename Allocator>
+void list<T, Allocator>::sort() {
+  sort(std::less<>());
+}
+
+// Sorts the elements with a bottom-up natural merge sort that relinks nodes
+// and never moves values. The list is cut into its sorted runs (strictly
+// descending runs are reversed), and runs are merged like a binary counter:
+// slot k holds a merge of about 2^k runs. Sorted input is one run, O(n).
+template <typename T, typename Allocator>
+template <typename Compare>
+void list<T, Allocator>::sort(Compare comp) {
+  if (size_ < 2) return;
+  ListNode_* slots[64] = {};
+  size_t used = 0;
+  ListNode_* rest = head_;
+  while (rest) {
+    ListNode_* carry = rest;
+    rest = cut_run(carry, comp);
+    size_t k = 0;
+    for (; slots[k]; k++) {
+      carry = merge_chains(slots[k], carry, comp);
+      slots[k] = nullptr;
+    }
+    slots[k] = carry;
+    used = std::max(used, k + 1);
+  }
+  ListNode_* sorted = nullptr;
+  for (size_t k = 0; k < used; k++) {
+    if (slots[k]) sorted = sorted ? merge_chains(slots[k], sorted, comp)
+                                  : slots[k];
+  }
+  relink(sorted);
+}
+
+template <typename T, typename Allocator>
+template <typename Compare>
+typename list<T, Allocator>::ListNode_*
+list<T, Allocator>::cut_run(ListNode_*& run, Compare& comp) {
+  ListNode_* last = run;
+  ListNode_* next = run->next_;
+  if (next && comp(next->data_, run->data_)) {
+    ListNode_* reversed = nullptr;
+    do {
+      last = next;
+      next = next->next_;
+    } while (next && comp(next->data_, last->data_));
+    last->next_ = nullptr;
+    for (ListNode_* node = run; node;) {
+      ListNode_* following = node->next_;
+      node->next_ = reversed;
+      reversed = node;
+      node = following;
+    }
+    run = reversed;
+  } else {
+    while (next && !comp(next->data_, last->data_)) {
+      last = next;
+      next = next->next_;
+    }
+    last->next_ = nullptr;
+  }
+  return next;
+}
+
+// ties take the left chain first, which keeps the sort stable
+template <typename T, typename Allocator>
+template <typename Compare>
+typename list<T, Allocator>::ListNode_*
+list<T, Allocator>::merge_chains(ListNode_* left, ListNode_* right,
+                                 Compare& comp) {
+  ListNode_* head = nullptr;
+  ListNode_** link = &head;
+  while (left && right) {
+    if (comp(right->data_, left->data_)) {
+      *link = right;
+      right = right->next_;
+    } else {
+      *link = left;
+      left = left->next_;
+    }
+    link = &(*link)->next_;
+  }
+  *link = left ? left : right;
+  return head;
+}
+
+template <typename T, typename Allocator>
+void list<T, Allocator>::relink(ListNode_* first) noexcept {
+  head_ = first;
+  tail_ = nullptr;
+  for (ListNode_* node = first; node; node = node->next_) {
+    node->prev_ = tail_;
+    tail_ = node;
+  }
+}
+
+// sorts the elements by key(element) with an LSD radix sort that moves
+// nodes between bucket chains; the values stay where they are, so iterators
+// keep pointing to the same elements
+template <typename T, typename Allocator>
+template <typename KeyFn>
+void list<T, Allocator>::radix_sort(KeyFn key) {
+  using U = radix_detail::image_of<T, KeyFn>;
+  if (size_ < 2) return;
+  // every pass chases each node once, so long lists take 16-bit digits to
+  // halve the number of passes
+  if (sizeof(U) > 1 && size_ >= (size_type{1} << 16)) {
+    radix_relink<16>(key);
+  } else {
+    radix_relink<8>(key);
+  }
+}
+
+template <typename T, typename Allocator>
+template <unsigned Bits, typename KeyFn>
+void list<T, Allocator>::radix_relink(KeyFn& key) {
+  using Key = radix_detail::key_of<T, KeyFn>;
+  using Hist =
+      radix_detail::histograms<typename radix_key<Key>::type, Bits>;
+
+  Hist hist;
+  for (ListNode_* node = head_; node; node = node->next_) {
+    hist.add(radix_key<Key>::encode(key(node->data_)));
+  }
+  vector<ListNode_*> bucket_head(Hist::kRadix);
+  vector<ListNode_*> bucket_tail(Hist::kRadix);
+  for (size_t d = 0; d < Hist::kDigits; d++) {
+    if (hist.same_everywhere(d, size_)) continue;
+    std::fill(bucket_head.begin(), bucket_head.end(), nullptr);
+    std::fill(bucket_tail.begin(), bucket_tail.end(), nullptr);
+    for (ListNode_* node = head_; node; node = node->next_) {
+      size_t v = Hist::digit(radix_key<Key>::encode(key(node->data_)), d);
+      if (bucket_tail[v]) {
+        bucket_tail[v]->next_ = node;
+      } else {
+        bucket_head[v] = node;
+      }
+      bucket_tail[v] = node;
+    }
+    ListNode_* last = nullptr;
+    for (size_t v = 0; v < Hist::kRadix; v++) {
+      if (!bucket_head[v]) continue;
+      if (last) {
+        last->next_ = bucket_head[v];
+      } else {
+        head_ = bucket_head[v];
       }
+      last = bucket_tail[v];
     }
+    last->next_ = nullptr;
   }
+  relink(head_);
 }
 
 // merges two sorted lists
-template <typename T>
-void list<T>::merge(list& other) {
-  list<T> tmp_1(*this);
-  list<T> tmp_2(other);
-  tmp_1.sort();
-  tmp_2.sort();
-  if (*this != other && tmp_1 == *this && tmp_2 == other) {
-    splice(begin(), other);
-    sort();
+template <typename T, typename Allocator>
+void list<T, Allocator>::merge(list& other) {
+  merge(other, std::less<>());
+}
+
+// merges two lists sorted by comp in one pass: each run of nodes of other
+// that belongs before a node of this list is linked in there as a whole
+template <typename T, typename Allocator>
+template <typename Compare>
+void list<T, Allocator>::merge(list& other, Compare comp) {
+  if (this == &other || other.empty()) return;
+  ListNode_* pos = head_;
+  ListNode_* node = other.head_;
+  while (pos && node) {
+    if (comp(node->data_, pos->data_)) {
+      ListNode_* last = node;
+      while (last->next_ && comp(last->next_->data_, pos->data_)) {
+        last = last->next_;
+      }
+      ListNode_* next = last->next_;
+      link_before(pos, node, last);
+      node = next;
+    } else {
+      pos = pos->next_;
+    }
   }
-  size_ += other.size();
+  if (node) link_before(nullptr, node, other.tail_);
+  size_ += other.size_;
   other.head_ = nullptr;
   other.tail_ = nullptr;
+  other.size_ = 0;
 }
 
-template <typename T>
-bool list<T>::operator==(const list<T>& other) {
+template <typename T, typename Allocator>
+bool list<T, Allocator>::operator==(const list<T, Allocator>& other) {
   bool result = false;
   if (size() == other.size()) {
     result = true;
@@ -295,14 +598,14 @@ bool list<T>::operator==(const list<T>& other) {
   return result;
 }
 
-template <typename T>
-bool list<T>::operator!=(const list<T>& other) {
+template <typename T, typename Allocator>
+bool list<T, Allocator>::operator!=(const list<T, Allocator>& other) {
   return !(*this == other);
 }
 
 // removes consecutive duplicate elements
-template <typename T>
-void list<T>::unique() {
+template <typename T, typename Allocator>
+void list<T, Allocator>::unique() {
   if (!empty()) {
     for (iterator it = begin(); it != end(); ++it) {
       iterator next = it;
@@ -319,30 +622,26 @@ void list<T>::unique() {
 // bonus part
 
 // Inserts new elements into the container directly before pos
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-typename list<T>::iterator list<T>::insert_many(const_iterator pos,
-                                                Args&&... args) {
-  iterator it = pos;
-  for (const auto& elem : {args...}) {
-    it = insert(it, elem);
-    if (it.iterator_ != tail_->next_) it++;
-  }
-  return it;
+typename list<T, Allocator>::iterator
+list<T, Allocator>::insert_many(const_iterator pos, Args&&... args) {
+  (emplace(pos, std::forward<Args>(args)), ...);
+  return iterator(pos.iterator_, this);
 }
 
 // Inserts new elements into the container directly before pos
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_back(Args&&... args) {
-  insert_many(end(), std::forward<value_type>(args)...);
+void list<T, Allocator>::insert_many_back(Args&&... args) {
+  insert_many(end(), std::forward<Args>(args)...);
 }
 
 // Appends new elements to the top of the container
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-void list<T>::insert_many_front(Args&&... args) {
-  insert_many(begin(), std::forward<value_type>(args)...);
+void list<T, Allocator>::insert_many_front(Args&&... args) {
+  insert_many(begin(), std::forward<Args>(args)...);
 }
 
 }  // namespace s21
@@ -5,57 +5,60 @@
 
 namespace s21 {
 
-template <typename T>
-ListIterator<T>::ListIterator() {
+template <typename T, typename Allocator>
+ListIterator<T, Allocator>::ListIterator() {
   iterator_ = nullptr;
 }
 
-template <typename T>
-ListIterator<T>::ListIterator(
-    const typename list<T>::ListNode_ *list_element_ptr,
-    const list<T> *list_ptr_)
+template <typename T, typename Allocator>
+ListIterator<T, Allocator>::ListIterator(
+    const typename list<T, Allocator>::ListNode_ *list_element_ptr,
+    const list<T, Allocator> *list_ptr_)
     : iterator_(list_element_ptr), list_ptr_(list_ptr_) {}
 
-template <typename T>
-ListIterator<T>::ListIterator(typename list<T>::ListNode_ *list_element_ptr,
-                              const list<T> *list_ptr_)
+template <typename T, typename Allocator>
+ListIterator<T, Allocator>::ListIterator(
+    typename list<T, Allocator>::ListNode_ *list_element_ptr,
+    const list<T, Allocator> *list_ptr_)
     : iterator_(list_element_ptr), list_ptr_(list_ptr_) {}
 
-template <typename T>
-ListIterator<T>::ListIterator(const ListIterator &list_original_element,
-                              const list<T> *list_ptr_)
+template <typename T, typename Allocator>
+ListIterator<T, Allocator>::ListIterator(
+    const ListIterator &list_original_element,
+    const list<T, Allocator> *list_ptr_)
     : iterator_(list_original_element.iterator_), list_ptr_(list_ptr_) {}
 
-template <typename T>
-ListConstIterator<T>::ListConstIterator(
-    const typename list<T>::ListNode_ *list_element_ptr,
-    const list<T> *list_ptr_)
-    : ListIterator<T>(
-          const_cast<typename list<T>::ListNode_ *>(list_element_ptr),
+template <typename T, typename Allocator>
+ListConstIterator<T, Allocator>::ListConstIterator(
+    const typename list<T, Allocator>::ListNode_ *list_element_ptr,
+    const list<T, Allocator> *list_ptr_)
+    : ListIterator<T, Allocator>(
+          const_cast<typename list<T, Allocator>::ListNode_ *>(
+              list_element_ptr),
           list_ptr_) {}
 
-template <typename T>
-typename list<T>::reference ListIterator<T>::operator*() {
+template <typename T, typename Allocator>
+typename list<T, Allocator>::reference ListIterator<T, Allocator>::operator*() {
   if (iterator_ == nullptr) {
     throw std::out_of_range("Error - Invalid pointer");
   }
   return iterator_->data_;
 }
 
-template <typename T>
-ListIterator<T> &ListIterator<T>::operator++() {
+template <typename T, typename Allocator>
+ListIterator<T, Allocator> &ListIterator<T, Allocator>::operator++() {
   iterator_ = iterator_->next_;
   return *this;
 }
 
-template <typename T>
-ListIterator<T> &ListIterator<T>::operator++(int) {
+template <typename T, typename Allocator>
+ListIterator<T, Allocator> &ListIterator<T, Allocator>::operator++(int) {
   iterator_ = iterator_->next_;
   return *this;
 }
 
-template <typename T>
-ListIterator<T> &ListIterator<T>::operator--() {
+template <typename T, typename Allocator>
+ListIterator<T, Allocator> &ListIterator<T, Allocator>::operator--() {
   if (iterator_ == list_ptr_->head_) {
     throw std::out_of_range("Error - Decrementing out of range");
   } else if (iterator_ == nullptr)
@@ -65,8 +68,8 @@ ListIterator<T> &ListIterator<T>::operator--() {
   return *this;
 }
 
-template <typename T>
-ListIterator<T> &ListIterator<T>::operator--(int) {
+template <typename T, typename Allocator>
+ListIterator<T, Allocator> &ListIterator<T, Allocator>::operator--(int) {
   if (iterator_ == list_ptr_->head_) {
     throw std::out_of_range("Error - Decrementing out of range");
   } else if (iterator_ == nullptr)
@@ -76,30 +79,30 @@ ListIterator<T> &ListIterator<T>::operator--(int) {
   return *this;
 }
 
-template <typename T>
-bool ListIterator<T>::operator==(const ListIterator &other) {
+template <typename T, typename Allocator>
+bool ListIterator<T, Allocator>::operator==(const ListIterator &other) {
   return iterator_ == other.iterator_;
 }
 
-template <typename T>
-bool ListIterator<T>::operator!=(const ListIterator &other) {
+template <typename T, typename Allocator>
+bool ListIterator<T, Allocator>::operator!=(const ListIterator &other) {
   return iterator_ != other.iterator_;
 }
 
-template <typename T>
-bool ListIterator<T>::operator>(const ListIterator &other) {
+template <typename T, typename Allocator>
+bool ListIterator<T, Allocator>::operator>(const ListIterator &other) {
   return iterator_ > other.iterator_;
 }
 
-template <typename T>
-bool ListIterator<T>::operator<(const ListIterator &other) {
+template <typename T, typename Allocator>
+bool ListIterator<T, Allocator>::operator<(const ListIterator &other) {
   return iterator_ < other.iterator_;
 }
 
 // ConstListIterator
-template <typename T>
-const typename list<T>::const_reference ListConstIterator<T>::operator*()
-    const {
+template <typename T, typename Allocator>
+const typename list<T, Allocator>::const_reference
+ListConstIterator<T, Allocator>::operator*() const {
   if (this->iterator_ == nullptr) {
     throw std::out_of_range("Error - Invalid pointer");
   }
@@ -1,11 +1,16 @@
 #ifndef S21_MAP_H
 #define S21_MAP_H
 
+#include <memory>
+#include <memory_resource>
+
 #include "../red_black_tree.h"
 
 namespace s21 {
 
-template <typename Key, typename T>
+// nodes come from Allocator rebound to the tree node type
+template <typename Key, typename T,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
 class map {
  public:
   using key_type = Key;
@@ -13,18 +18,23 @@ class map {
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename RedBlackTree<std::pair<Key, T>, Key, T>::iterator;
-  using const_iterator =
-      typename RedBlackTree<std::pair<Key, T>, Key, T>::const_iterator;
+  using tree_type = RedBlackTree<std::pair<Key, T>, Key, T, Allocator>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   map() : tree_(){};
-  map(std::initializer_list<value_type> const& items);
+  explicit map(const Allocator& alloc) : tree_(alloc){};
+  map(std::initializer_list<value_type> const& items,
+      const Allocator& alloc = Allocator());
   map(const map& m) : tree_(m.tree_){};
   map(map&& m);
   ~map() = default;
   map& operator=(map&& m);
 
+  allocator_type get_allocator() const noexcept;
+
   T& at(const Key& key);
   T& operator[](const Key& key);
 
@@ -46,8 +56,18 @@ class map {
   s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
  private:
-  RedBlackTree<std::pair<Key, T>, Key, T> tree_;
+  tree_type tree_;
 };
+
+namespace pmr {
+
+// map whose nodes come from a std::pmr::memory_resource
+template <typename Key, typename T>
+using map = s21::map<Key, T,
+                     std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #include "s21_map.tpp"
@@ -5,80 +5,86 @@
 
 namespace s21 {
 
-template <typename Key, typename T>
-map<Key, T>::map(std::initializer_list<value_type> const& items) {
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::map(std::initializer_list<value_type> const& items,
+                            const Allocator& alloc)
+    : tree_(alloc) {
   for (auto iter = items.begin(); iter != items.end(); iter++) {
     tree_.insert(*iter);
   }
 }
 
-template <typename Key, typename T>
-map<Key, T>::map(map&& m) {
-  tree_ = std::move(m.tree_);
-}
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::map(map&& m) : tree_(std::move(m.tree_)) {}
 
-template <typename Key, typename T>
-map<Key, T>& map<Key, T>::operator=(map&& m) {
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>& map<Key, T, Allocator>::operator=(map&& m) {
   tree_ = std::move(m.tree_);
   return *this;
 }
 
-template <typename Key, typename T>
-T& map<Key, T>::at(const Key& key) {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::allocator_type
+map<Key, T, Allocator>::get_allocator() const noexcept {
+  return tree_.get_allocator();
+}
+
+template <typename Key, typename T, typename Allocator>
+T& map<Key, T, Allocator>::at(const Key& key) {
   if (!tree_.contains(key)) throw std::out_of_range("map::at - Key not found");
   return tree_[key].second;
 }
 
-template <typename Key, typename T>
-T& map<Key, T>::operator[](const Key& key) {
+template <typename Key, typename T, typename Allocator>
+T& map<Key, T, Allocator>::operator[](const Key& key) {
   return tree_[key].second;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::begin() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::iterator map<Key, T, Allocator>::begin() {
   return tree_.begin();
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::end() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::iterator map<Key, T, Allocator>::end() {
   return tree_.end();
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::empty() {
+template <typename Key, typename T, typename Allocator>
+bool map<Key, T, Allocator>::empty() {
   return tree_.empty();
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::size_type map<Key, T>::size() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::size_type map<Key, T, Allocator>::size() {
   return tree_.size();
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::size_type map<Key, T>::max_size() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::size_type map<Key, T, Allocator>::max_size() {
   return tree_.max_size();
 }
 
-template <typename Key, typename T>
-void map<Key, T>::clear() {
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::clear() {
   tree_.clear();
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const value_type& value) {
+template <typename Key, typename T, typename Allocator>
+std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::insert(const value_type& value) {
   return tree_.insert(value);
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const Key& key, const T& obj) {
+template <typename Key, typename T, typename Allocator>
+std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::insert(const Key& key, const T& obj) {
   return tree_.insert({key, obj});
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
-    const Key& key, const T& obj) {
+template <typename Key, typename T, typename Allocator>
+std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::insert_or_assign(const Key& key, const T& obj) {
   auto result = tree_.insert({key, obj});
   if (!result.second) {
     tree_[key].second = obj;
@@ -86,30 +92,30 @@ std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
   return result;
 }
 
-template <typename Key, typename T>
-void map<Key, T>::erase(iterator pos) {
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::erase(iterator pos) {
   tree_.erase(pos);
 }
 
-template <typename Key, typename T>
-void map<Key, T>::swap(map& other) {
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::swap(map& other) {
   tree_.swap(other.tree_);
 }
 
-template <typename Key, typename T>
-void map<Key, T>::merge(map& other) {
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::merge(map& other) {
   tree_.merge(other.tree_);
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::contains(const Key& key) {
+template <typename Key, typename T, typename Allocator>
+bool map<Key, T, Allocator>::contains(const Key& key) {
   return tree_.contains(key);
 }
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Allocator>
 template <typename... Args>
-s21::vector<std::pair<typename map<Key, T>::iterator, bool>>
-map<Key, T>::insert_many(Args&&... args) {
+s21::vector<std::pair<typename map<Key, T, Allocator>::iterator, bool>>
+map<Key, T, Allocator>::insert_many(Args&&... args) {
   return tree_.insert_many(std::forward<Args>(args)...);
 }
 
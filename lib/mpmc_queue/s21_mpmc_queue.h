@@ -0,0 +1,120 @@
+#ifndef S21_MPMC_QUEUE_H
+#define S21_MPMC_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_memory.h"
+
+namespace s21 {
+
+// mpmc_queue<T> is a bounded FIFO shared by any number of producer and
+// consumer threads. Every slot carries a sequence number that says whose
+// turn it is: a producer claims position p when its slot holds p, and a
+// consumer claims it when the slot holds p + 1. Claiming is one CAS on the
+// shared position, so try_push and try_pop never take a lock and threads
+// working on different slots do not wait for each other.
+//
+// push and pop block on a condition variable when the queue is full or
+// empty; the try_..._for forms give up after a timeout. The lock-free side
+// only touches the mutex when a thread is actually blocked. pop_bulk
+// claims a run of ready slots with a single CAS.
+//
+// Elements must be nothrow movable: a claimed slot cannot be given back,
+// so nothing may throw between claiming and publishing it.
+template <typename T>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible<T>::value &&
+                    std::is_nothrow_move_assignable<T>::value,
+                "mpmc_queue elements must be nothrow movable");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  explicit mpmc_queue(size_type capacity);  // room for capacity elements,
+                                            // rounded up to a power of two
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+  ~mpmc_queue();  // destroys the elements left in the queue
+
+  size_type capacity() const noexcept;  // returns the number of slots
+  size_type size() const noexcept;  // returns the number of elements; only
+                                    // a snapshot while other threads run
+  bool empty() const noexcept;      // checks whether the queue is empty
+
+  template <typename... Args>
+  bool try_emplace(Args &&...args);  // constructs an element in a free slot;
+                                     // false when full
+  bool try_push(const T &value);     // copies value in; false when full
+  bool try_push(T &&value);          // moves value in; false when full
+  bool try_pop(T &out);  // moves the oldest element to out; false when empty
+  template <typename OutputIt>
+  size_type pop_bulk(OutputIt out,
+                     size_type max);  // moves up to max elements to out,
+                                      // returns how many there were
+
+  void push(T value);  // waits until there is room
+  void pop(T &out);    // waits until there is an element
+  // waits up to timeout for room; value is moved from only on success
+  template <typename Rep, typename Period>
+  bool try_push_for(T &&value,
+                    const std::chrono::duration<Rep, Period> &timeout);
+  // waits up to timeout for an element
+  template <typename Rep, typename Period>
+  bool try_pop_for(T &out, const std::chrono::duration<Rep, Period> &timeout);
+
+ private:
+  // one slot: the sequence number and storage for an element
+  struct Cell_ {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T *value() noexcept { return reinterpret_cast<T *>(storage); }
+  };
+
+  static constexpr int kSpins = 64;  // failed tries before blocking
+
+  template <typename... Args>
+  void publish(Cell_ &cell, size_type pos,
+               Args &&...args) noexcept;  // fills a claimed slot
+  size_type claim_ready(size_type pos,
+                        size_type max) const noexcept;  // counts the slots
+                                                        // ready for pop
+                                                        // from pos on
+  void wake(std::atomic<size_type> &waiting, std::condition_variable &cv,
+            size_type n);  // wakes blocked threads after n slots changed
+  bool can_push() const noexcept;  // the next push finds a free slot
+  bool can_pop() const noexcept;   // the next pop finds an element
+  // retries attempt, then blocks on cv until ready() or the deadline
+  template <typename Try, typename Ready>
+  bool wait_until(Try &&attempt, Ready &&ready, std::atomic<size_type> &waiting,
+                  std::condition_variable &cv,
+                  const std::chrono::steady_clock::time_point *deadline);
+
+  alignas(cache_line_size) std::atomic<size_type> enqueue_pos_{0};
+  alignas(cache_line_size) std::atomic<size_type> dequeue_pos_{0};
+  alignas(cache_line_size) Cell_ *cells_;
+  size_type mask_;
+  // blocking side
+  alignas(cache_line_size) std::atomic<size_type> waiting_pushers_{0};
+  std::atomic<size_type> waiting_poppers_{0};
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+};
+
+}  // namespace s21
+
+#include "s21_mpmc_queue.tpp"
+
+#endif
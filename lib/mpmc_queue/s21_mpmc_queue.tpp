@@ -0,0 +1,289 @@
+#ifndef S21_MPMC_QUEUE_TPP
+#define S21_MPMC_QUEUE_TPP
+
+#include "s21_mpmc_queue.h"
+
+namespace s21 {
+
+// Slot i starts with sequence i. A producer that claims position p fills
+// the slot and sets its sequence to p + 1; the consumer that claims p
+// empties it and sets p + capacity, which is the next producer's position
+// for the same slot. Positions only grow and wrap around size_type.
+
+// room for capacity elements, rounded up to a power of two
+template <typename T>
+mpmc_queue<T>::mpmc_queue(size_type capacity) {
+  if (capacity > (static_cast<size_type>(-1) >> 1) / sizeof(Cell_))
+    throw std::length_error("Size of reserving storage is unavailable");
+  size_type slots = 2;
+  while (slots < capacity) slots *= 2;
+  cells_ = new Cell_[slots];
+  mask_ = slots - 1;
+  for (size_type i = 0; i < slots; i++) {
+    cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+// destroys the elements left in the queue; no other thread may use it
+template <typename T>
+mpmc_queue<T>::~mpmc_queue() {
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    size_type end = enqueue_pos_.load(std::memory_order_acquire);
+    for (size_type pos = dequeue_pos_.load(std::memory_order_acquire);
+         pos != end; pos++) {
+      cells_[pos & mask_].value()->~T();
+    }
+  }
+  delete[] cells_;
+}
+
+// returns the number of slots
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::capacity() const noexcept {
+  return mask_ + 1;
+}
+
+// returns the number of elements; dequeue_pos_ is read first so the
+// difference cannot go below zero
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::size() const noexcept {
+  size_type head = dequeue_pos_.load(std::memory_order_acquire);
+  size_type tail = enqueue_pos_.load(std::memory_order_acquire);
+  return std::min(tail - head, capacity());
+}
+
+// checks whether the queue is empty
+template <typename T>
+bool mpmc_queue<T>::empty() const noexcept {
+  return size() == 0;
+}
+
+// constructs an element in a free slot; an element whose constructor may
+// throw is built before a slot is claimed
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::try_emplace(Args &&...args) {
+  if constexpr (!std::is_nothrow_constructible<T, Args &&...>::value) {
+    T value(std::forward<Args>(args)...);
+    return try_emplace(std::move(value));
+  } else {
+    size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell_ &cell = cells_[pos & mask_];
+      size_type sequence = cell.sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          publish(cell, pos, std::forward<Args>(args)...);
+          wake(waiting_poppers_, not_empty_, 1);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;  // the slot still holds an element from a lap ago
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+// copies value in; false when full
+template <typename T>
+bool mpmc_queue<T>::try_push(const T &value) {
+  return try_emplace(value);
+}
+
+// moves value in; false when full
+template <typename T>
+bool mpmc_queue<T>::try_push(T &&value) {
+  return try_emplace(std::move(value));
+}
+
+// moves the oldest element to out; false when empty
+template <typename T>
+bool mpmc_queue<T>::try_pop(T &out) {
+  size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+  Cell_ *cell;
+  for (;;) {
+    cell = &cells_[pos & mask_];
+    size_type sequence = cell->sequence.load(std::memory_order_acquire);
+    auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                             std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      return false;  // no producer has filled this position yet
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+  out = std::move(*cell->value());
+  cell->value()->~T();
+  cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+  wake(waiting_pushers_, not_full_, 1);
+  return true;
+}
+
+// moves up to max elements to out: counts the filled slots from the front
+// and claims all of them with one CAS
+template <typename T>
+template <typename OutputIt>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::pop_bulk(OutputIt out,
+                                                          size_type max) {
+  if (max == 0) return 0;
+  size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+  size_type n;
+  for (;;) {
+    n = claim_ready(pos, max);
+    if (n == 0) {
+      size_type current = dequeue_pos_.load(std::memory_order_relaxed);
+      if (current == pos) return 0;
+      pos = current;
+    } else if (dequeue_pos_.compare_exchange_weak(
+                   pos, pos + n, std::memory_order_relaxed)) {
+      break;
+    }
+  }
+  for (size_type i = 0; i < n; ++i, ++out) {
+    Cell_ &cell = cells_[(pos + i) & mask_];
+    *out = std::move(*cell.value());
+    cell.value()->~T();
+    cell.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+  }
+  wake(waiting_pushers_, not_full_, n);
+  return n;
+}
+
+// waits until there is room
+template <typename T>
+void mpmc_queue<T>::push(T value) {
+  wait_until([&] { return try_emplace(std::move(value)); },
+             [this] { return can_push(); }, waiting_pushers_, not_full_,
+             nullptr);
+}
+
+// waits until there is an element
+template <typename T>
+void mpmc_queue<T>::pop(T &out) {
+  wait_until([&] { return try_pop(out); }, [this] { return can_pop(); },
+             waiting_poppers_, not_empty_, nullptr);
+}
+
+// waits up to timeout for room; value is moved from only on success
+template <typename T>
+template <typename Rep, typename Period>
+bool mpmc_queue<T>::try_push_for(
+    T &&value, const std::chrono::duration<Rep, Period> &timeout) {
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::ceil<std::chrono::steady_clock::duration>(
+                      timeout);
+  return wait_until([&] { return try_emplace(std::move(value)); },
+                    [this] { return can_push(); }, waiting_pushers_,
+                    not_full_, &deadline);
+}
+
+// waits up to timeout for an element
+template <typename T>
+template <typename Rep, typename Period>
+bool mpmc_queue<T>::try_pop_for(
+    T &out, const std::chrono::duration<Rep, Period> &timeout) {
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::ceil<std::chrono::steady_clock::duration>(
+                      timeout);
+  return wait_until([&] { return try_pop(out); },
+                    [this] { return can_pop(); }, waiting_poppers_,
+                    not_empty_, &deadline);
+}
+
+// private
+
+// fills the slot claimed at pos and hands it to the consumers
+template <typename T>
+template <typename... Args>
+void mpmc_queue<T>::publish(Cell_ &cell, size_type pos,
+                            Args &&...args) noexcept {
+  ::new (static_cast<void *>(cell.storage)) T(std::forward<Args>(args)...);
+  cell.sequence.store(pos + 1, std::memory_order_release);
+}
+
+// checks whether the next push finds a free slot
+template <typename T>
+bool mpmc_queue<T>::can_push() const noexcept {
+  size_type pos = enqueue_pos_.load(std::memory_order_relaxed);
+  return cells_[pos & mask_].sequence.load(std::memory_order_acquire) == pos;
+}
+
+// checks whether the next pop finds an element
+template <typename T>
+bool mpmc_queue<T>::can_pop() const noexcept {
+  size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+  return cells_[pos & mask_].sequence.load(std::memory_order_acquire) ==
+         pos + 1;
+}
+
+// counts the slots from pos on that hold an element, up to max
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::claim_ready(
+    size_type pos, size_type max) const noexcept {
+  size_type n = 0;
+  while (n < max && cells_[(pos + n) & mask_].sequence.load(
+                        std::memory_order_acquire) == pos + n + 1) {
+    n++;
+  }
+  return n;
+}
+
+// wakes blocked threads after n slots changed hands. The fence pairs with
+// the one in wait_until: either this thread sees the waiter's count, or
+// the waiter's check under the mutex sees the slot, so no wakeup is lost.
+// Taking the mutex makes sure a waiter that saw nothing is already asleep.
+template <typename T>
+void mpmc_queue<T>::wake(std::atomic<size_type> &waiting,
+                         std::condition_variable &cv, size_type n) {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (waiting.load(std::memory_order_relaxed) == 0) return;
+  { std::lock_guard<std::mutex> lock(mutex_); }
+  if (n == 1) {
+    cv.notify_one();
+  } else {
+    cv.notify_all();
+  }
+}
+
+// retries attempt a few times, then sleeps on cv until ready() says an
+// attempt can succeed, or the deadline passes; a null deadline waits
+// forever. attempt runs without the mutex because it may call wake().
+template <typename T>
+template <typename Try, typename Ready>
+bool mpmc_queue<T>::wait_until(
+    Try &&attempt, Ready &&ready, std::atomic<size_type> &waiting,
+    std::condition_variable &cv,
+    const std::chrono::steady_clock::time_point *deadline) {
+  for (int i = 0; i < kSpins; i++) {
+    if (attempt()) return true;
+    std::this_thread::yield();
+  }
+  waiting.fetch_add(1);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  bool done = false;
+  while (!(done = attempt())) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (ready()) continue;
+    if (!deadline) {
+      cv.wait(lock);
+    } else if (cv.wait_until(lock, *deadline) == std::cv_status::timeout) {
+      lock.unlock();
+      done = attempt();
+      break;
+    }
+  }
+  waiting.fetch_sub(1);
+  return done;
+}
+
+}  // namespace s21
+
+#endif
@@ -1,28 +1,38 @@
 #ifndef S21_MULTISET_H
 #define S21_MULTISET_H
 
+#include <memory>
+#include <memory_resource>
+
 #include "../red_black_tree.h"
 
 namespace s21 {
 
-template <typename Key>
+// nodes come from Allocator rebound to the tree node type
+template <typename Key, typename Allocator = std::allocator<Key>>
 class multiset {
  public:
   using key_type = Key;
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = typename RedBlackTree<Key, Key, Key>::iterator;
-  using const_iterator = typename RedBlackTree<Key, Key, Key>::const_iterator;
+  using tree_type = RedBlackTree<Key, Key, Key, Allocator>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   multiset() : tree_(){};
-  multiset(std::initializer_list<value_type> const& items);
+  explicit multiset(const Allocator& alloc) : tree_(alloc){};
+  multiset(std::initializer_list<value_type> const& items,
+           const Allocator& alloc = Allocator());
   multiset(const multiset& ms) : tree_(ms.tree_){};
   multiset(multiset&& ms);
   ~multiset() = default;
   multiset& operator=(multiset&& ms);
 
+  allocator_type get_allocator() const noexcept;
+
   iterator begin();
   iterator end();
   bool empty();
@@ -46,8 +56,17 @@ class multiset {
   s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
  private:
-  RedBlackTree<Key, Key, Key> tree_;
+  tree_type tree_;
 };
+
+namespace pmr {
+
+// multiset whose nodes come from a std::pmr::memory_resource
+template <typename Key>
+using multiset = s21::multiset<Key, std::pmr::polymorphic_allocator<Key>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 #include "s21_multiset.tpp"
 #endif
\ No newline at end of file
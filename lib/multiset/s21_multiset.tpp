@@ -5,81 +5,89 @@
 
 namespace s21 {
 
-template <typename Key>
-multiset<Key>::multiset(std::initializer_list<value_type> const& items)
-    : tree_() {
+template <typename Key, typename Allocator>
+multiset<Key, Allocator>::multiset(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : tree_(alloc) {
   for (auto iter = items.begin(); iter != items.end(); iter++) {
     tree_.multi_insert(*iter);
   }
 }
 
-template <typename Key>
-multiset<Key>::multiset(multiset&& ms) {
-  tree_ = std::move(ms.tree_);
-}
+template <typename Key, typename Allocator>
+multiset<Key, Allocator>::multiset(multiset&& ms)
+    : tree_(std::move(ms.tree_)) {}
 
-template <typename Key>
-multiset<Key>& multiset<Key>::operator=(multiset&& ms) {
+template <typename Key, typename Allocator>
+multiset<Key, Allocator>& multiset<Key, Allocator>::operator=(multiset&& ms) {
   tree_ = std::move(ms.tree_);
   return *this;
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::begin() {
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::allocator_type
+multiset<Key, Allocator>::get_allocator() const noexcept {
+  return tree_.get_allocator();
+}
+
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::begin() {
   return tree_.begin();
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::end() {
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator multiset<Key, Allocator>::end() {
   return tree_.end();
 }
 
-template <typename Key>
-bool multiset<Key>::empty() {
+template <typename Key, typename Allocator>
+bool multiset<Key, Allocator>::empty() {
   return tree_.empty();
 }
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::size() {
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::size_type multiset<Key, Allocator>::size() {
   return tree_.size();
 }
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::max_size() {
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::size_type
+multiset<Key, Allocator>::max_size() {
   return tree_.max_size();
 }
 
-template <typename Key>
-void multiset<Key>::clear() {
+template <typename Key, typename Allocator>
+void multiset<Key, Allocator>::clear() {
   tree_.clear();
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::insert(
-    const value_type& value) {
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator
+multiset<Key, Allocator>::insert(const value_type& value) {
   return tree_.multi_insert(value);
 }
 
-template <typename Key>
-void multiset<Key>::erase(iterator pos) {
+template <typename Key, typename Allocator>
+void multiset<Key, Allocator>::erase(iterator pos) {
   tree_.erase(pos);
 }
 
-template <typename Key>
-void multiset<Key>::swap(multiset& other) {
+template <typename Key, typename Allocator>
+void multiset<Key, Allocator>::swap(multiset& other) {
   tree_.swap(other.tree_);
 }
 
-template <typename Key>
-void multiset<Key>::merge(multiset& other) {
+template <typename Key, typename Allocator>
+void multiset<Key, Allocator>::merge(multiset& other) {
   for (auto iter = other.begin(); iter != other.end(); iter++) {
     insert(*iter);
   }
   other.clear();
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::find(const Key& key) {
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator
+multiset<Key, Allocator>::find(const Key& key) {
   for (auto iter = tree_.begin(); iter != tree_.end(); iter++) {
     if (*iter == key) {
       return iter;
@@ -88,13 +96,14 @@ typename multiset<Key>::iterator multiset<Key>::find(const Key& key) {
   return tree_.end();
 }
 
-template <typename Key>
-bool multiset<Key>::contains(const Key& key) {
+template <typename Key, typename Allocator>
+bool multiset<Key, Allocator>::contains(const Key& key) {
   return tree_.contains(key);
 }
 
-template <typename Key>
-typename multiset<Key>::size_type multiset<Key>::count(const Key& key) {
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::size_type
+multiset<Key, Allocator>::count(const Key& key) {
   size_type count = 0;
   for (auto iter = tree_.begin(); iter != tree_.end(); iter++) {
     if (*iter == key) {
@@ -104,14 +113,16 @@ typename multiset<Key>::size_type multiset<Key>::count(const Key& key) {
   return count;
 }
 
-template <typename Key>
-std::pair<typename multiset<Key>::iterator, typename multiset<Key>::iterator>
-multiset<Key>::equal_range(const Key& key) {
+template <typename Key, typename Allocator>
+std::pair<typename multiset<Key, Allocator>::iterator,
+          typename multiset<Key, Allocator>::iterator>
+multiset<Key, Allocator>::equal_range(const Key& key) {
   return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::lower_bound(const Key& key) {
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator
+multiset<Key, Allocator>::lower_bound(const Key& key) {
   for (auto iter = tree_.begin(); iter != tree_.end(); iter++) {
     if (*iter >= key) {
       return iter;
@@ -120,8 +131,9 @@ typename multiset<Key>::iterator multiset<Key>::lower_bound(const Key& key) {
   return tree_.end();
 }
 
-template <typename Key>
-typename multiset<Key>::iterator multiset<Key>::upper_bound(const Key& key) {
+template <typename Key, typename Allocator>
+typename multiset<Key, Allocator>::iterator
+multiset<Key, Allocator>::upper_bound(const Key& key) {
   for (auto iter = tree_.begin(); iter != tree_.end(); iter++) {
     if (*iter > key) {
       return iter;
@@ -130,10 +142,10 @@ typename multiset<Key>::iterator multiset<Key>::upper_bound(const Key& key) {
   return tree_.end();
 }
 
-template <typename Key>
+template <typename Key, typename Allocator>
 template <typename... Args>
-s21::vector<std::pair<typename multiset<Key>::iterator, bool>>
-multiset<Key>::insert_many(Args&&... args) {
+s21::vector<std::pair<typename multiset<Key, Allocator>::iterator, bool>>
+multiset<Key, Allocator>::insert_many(Args&&... args) {
   s21::vector<std::pair<iterator, bool>> result;
   (result.push_back(
        std::make_pair(tree_.multi_insert(std::forward<Args>(args)), true)),
@@ -0,0 +1,95 @@
+#ifndef S21_INDEXED_PRIORITY_QUEUE_H
+#define S21_INDEXED_PRIORITY_QUEUE_H
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// indexed_priority_queue<T, Compare, Arity> is a d-ary heap whose elements
+// can be found again: push returns a handle, and the handle stays valid
+// until its element is popped or erased. With the handle, update,
+// decrease_key and erase work in O(log n), as Dijkstra's and Prim's
+// algorithms need:
+//
+//   s21::indexed_priority_queue<int, std::greater<int>> dist;  // min-heap
+//   auto h = dist.push(100);
+//   dist.decrease_key(h, 42);  // h moves towards the top
+//
+// The heap stores each value next to its handle; a second array maps a
+// handle to its heap position and is patched on every move. Handles of
+// removed elements are reused.
+template <typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class indexed_priority_queue {
+  static_assert(Arity >= 2,
+                "indexed_priority_queue needs at least two children");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using handle = size_t;
+  using value_compare = Compare;
+
+  static constexpr size_type arity = Arity;  // children per node
+
+  indexed_priority_queue();  // default constructor, creates empty queue
+  explicit indexed_priority_queue(const Compare &compare);
+
+  const_reference top() const;  // the greatest element
+  handle top_handle() const;    // the handle of the greatest element
+  const_reference operator[](handle h) const;  // the element of h
+  bool contains(handle h) const noexcept;  // checks whether h is in the queue
+
+  size_type size() const noexcept;
+  bool empty() const noexcept;
+
+  handle push(const_reference value);  // inserts an element
+  handle push(value_type &&value);     // moves an element in
+  template <typename... Args>
+  handle emplace(Args &&...args);  // constructs an element in place
+  void pop();                      // removes the greatest element
+  void erase(handle h);            // removes the element of h
+  void update(handle h,
+              value_type value);  // replaces the element of h and moves it
+                                  // up or down
+  void decrease_key(handle h,
+                    value_type value);  // replaces the element of h with one
+                                        // that does not compare less, and
+                                        // moves it towards the top
+  void clear() noexcept;  // removes every element; all handles are freed
+
+ private:
+  static constexpr size_type kAbsent = static_cast<size_type>(-1);
+
+  struct Entry_ {
+    T value;
+    handle id;
+  };
+
+  handle new_handle();                    // a free handle
+  size_type checked_position(handle h) const;  // heap position of a live h
+  void place(size_type pos, Entry_ &&entry);  // writes entry at pos and
+                                              // records its position
+  void sift_up(size_type pos);
+  void sift_down(size_type pos);
+  void remove_at(size_type pos);  // removes the element at a heap position
+
+  vector<Entry_> heap_;
+  vector<size_type> position_;  // heap position of every handle, kAbsent
+                                // for free handles
+  vector<handle> free_;         // handles to reuse
+  Compare compare_;
+};
+
+}  // namespace s21
+
+#include "s21_indexed_priority_queue.tpp"
+
+#endif
@@ -0,0 +1,216 @@
+#include "s21_indexed_priority_queue.h"
+
+namespace s21 {
+
+template <typename T, typename Compare, size_t Arity>
+indexed_priority_queue<T, Compare, Arity>::indexed_priority_queue()
+    : compare_() {}
+
+template <typename T, typename Compare, size_t Arity>
+indexed_priority_queue<T, Compare, Arity>::indexed_priority_queue(
+    const Compare &compare)
+    : compare_(compare) {}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::const_reference
+indexed_priority_queue<T, Compare, Arity>::top() const {
+  if (empty()) throw std::out_of_range("Error! priority_queue is empty");
+  return heap_[0].value;
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle
+indexed_priority_queue<T, Compare, Arity>::top_handle() const {
+  if (empty()) throw std::out_of_range("Error! priority_queue is empty");
+  return heap_[0].id;
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::const_reference
+indexed_priority_queue<T, Compare, Arity>::operator[](handle h) const {
+  return heap_[checked_position(h)].value;
+}
+
+template <typename T, typename Compare, size_t Arity>
+bool indexed_priority_queue<T, Compare, Arity>::contains(
+    handle h) const noexcept {
+  return h < position_.size() && position_[h] != kAbsent;
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::size_type
+indexed_priority_queue<T, Compare, Arity>::size() const noexcept {
+  return heap_.size();
+}
+
+template <typename T, typename Compare, size_t Arity>
+bool indexed_priority_queue<T, Compare, Arity>::empty() const noexcept {
+  return heap_.empty();
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle
+indexed_priority_queue<T, Compare, Arity>::push(const_reference value) {
+  return emplace(value);
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle
+indexed_priority_queue<T, Compare, Arity>::push(value_type &&value) {
+  return emplace(std::move(value));
+}
+
+// the handle is taken only after the element is in the heap, so a throwing
+// constructor leaks no handle
+template <typename T, typename Compare, size_t Arity>
+template <typename... Args>
+typename indexed_priority_queue<T, Compare, Arity>::handle
+indexed_priority_queue<T, Compare, Arity>::emplace(Args &&...args) {
+  heap_.push_back(Entry_{T(std::forward<Args>(args)...), 0});
+  size_type pos = heap_.size() - 1;
+  handle h;
+  try {
+    h = new_handle();
+  } catch (...) {
+    heap_.pop_back();
+    throw;
+  }
+  heap_[pos].id = h;
+  position_[h] = pos;
+  sift_up(pos);
+  return h;
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::pop() {
+  if (empty()) throw std::out_of_range("Error! priority_queue is empty");
+  remove_at(0);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::erase(handle h) {
+  remove_at(checked_position(h));
+}
+
+// the new value decides the direction: it sifts up when it beats its
+// parent and down otherwise
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::update(handle h,
+                                                       value_type value) {
+  size_type pos = checked_position(h);
+  heap_[pos].value = std::move(value);
+  if (pos > 0 && compare_(heap_[(pos - 1) / Arity].value, heap_[pos].value)) {
+    sift_up(pos);
+  } else {
+    sift_down(pos);
+  }
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::decrease_key(
+    handle h, value_type value) {
+  size_type pos = checked_position(h);
+  assert(!compare_(value, heap_[pos].value) &&
+         "decrease_key must not move an element away from the top");
+  heap_[pos].value = std::move(value);
+  sift_up(pos);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::clear() noexcept {
+  heap_.clear();
+  position_.clear();
+  free_.clear();
+}
+
+// private
+
+// a free handle; free_ keeps room for every handle, so that remove_at can
+// return one without allocating
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::handle
+indexed_priority_queue<T, Compare, Arity>::new_handle() {
+  if (!free_.empty()) {
+    handle h = free_[free_.size() - 1];
+    free_.pop_back();
+    return h;
+  }
+  position_.push_back(kAbsent);
+  try {
+    free_.reserve(position_.capacity());
+  } catch (...) {
+    position_.pop_back();
+    throw;
+  }
+  return position_.size() - 1;
+}
+
+template <typename T, typename Compare, size_t Arity>
+typename indexed_priority_queue<T, Compare, Arity>::size_type
+indexed_priority_queue<T, Compare, Arity>::checked_position(handle h) const {
+  if (!contains(h))
+    throw std::out_of_range("Error! handle is not in the priority_queue");
+  return position_[h];
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::place(size_type pos,
+                                                      Entry_ &&entry) {
+  position_[entry.id] = pos;
+  heap_[pos] = std::move(entry);
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::sift_up(size_type pos) {
+  Entry_ moving = std::move(heap_[pos]);
+  while (pos > 0) {
+    size_type parent = (pos - 1) / Arity;
+    if (!compare_(heap_[parent].value, moving.value)) break;
+    place(pos, std::move(heap_[parent]));
+    pos = parent;
+  }
+  place(pos, std::move(moving));
+}
+
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::sift_down(size_type pos) {
+  const size_type size = heap_.size();
+  Entry_ moving = std::move(heap_[pos]);
+  for (;;) {
+    size_type first = pos * Arity + 1;
+    if (first >= size) break;
+    size_type last = first + Arity < size ? first + Arity : size;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; child++) {
+      if (compare_(heap_[best].value, heap_[child].value)) best = child;
+    }
+    if (!compare_(moving.value, heap_[best].value)) break;
+    place(pos, std::move(heap_[best]));
+    pos = best;
+  }
+  place(pos, std::move(moving));
+}
+
+// moves the last entry into the gap and sifts it whichever way it belongs;
+// the handle goes to the free list, which new_handle made room for
+template <typename T, typename Compare, size_t Arity>
+void indexed_priority_queue<T, Compare, Arity>::remove_at(size_type pos) {
+  handle h = heap_[pos].id;
+  position_[h] = kAbsent;
+  free_.push_back(h);
+  size_type last = heap_.size() - 1;
+  if (pos != last) {
+    place(pos, std::move(heap_[last]));
+    heap_.pop_back();
+    if (pos > 0 &&
+        compare_(heap_[(pos - 1) / Arity].value, heap_[pos].value)) {
+      sift_up(pos);
+    } else {
+      sift_down(pos);
+    }
+  } else {
+    heap_.pop_back();
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,89 @@
+#ifndef S21_PRIORITY_QUEUE_H
+#define S21_PRIORITY_QUEUE_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// priority_queue<T, Container, Compare, Arity> keeps its elements as an
+// implicit Arity-ary heap in a random access Container: top() is the
+// element that compares greatest. Every node has Arity children, so the
+// heap is log(Arity) times shallower than a binary one. With the default 4
+// the children of a node are adjacent, a sift-down reads one or two cache
+// lines per level, and push climbs half as many levels.
+//
+// Sifting moves a hole instead of swapping: the element in motion is held
+// aside and written once at its final position.
+template <typename T, typename Container = vector<T>,
+          typename Compare = std::less<T>, size_t Arity = 4>
+class priority_queue {
+  static_assert(Arity >= 2, "priority_queue needs at least two children");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using container_type = Container;
+  using value_compare = Compare;
+
+  static constexpr size_type arity = Arity;  // children per node
+
+  priority_queue();  // default constructor, creates empty queue
+  explicit priority_queue(const Compare &compare);
+  priority_queue(std::initializer_list<value_type> const &items,
+                 const Compare &compare = Compare());  // builds the heap in
+                                                       // O(n)
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last,
+                 const Compare &compare = Compare());  // builds the heap in
+                                                       // O(n)
+  priority_queue(const priority_queue &q) = default;
+  priority_queue(priority_queue &&q) = default;  // noexcept when Container
+                                                 // and Compare move so
+  ~priority_queue() = default;
+  priority_queue &operator=(const priority_queue &q) = default;
+  priority_queue &operator=(priority_queue &&q) = default;
+
+  const_reference top() const;  // the greatest element
+
+  size_type size() const;
+  bool empty() const;
+
+  void push(const_reference value);  // inserts an element
+  void push(value_type &&value);     // moves an element in
+  template <typename... Args>
+  void emplace(Args &&...args);  // constructs an element in place
+  void pop();                    // removes the greatest element
+  void swap(priority_queue &other);  // swaps the contents
+
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  void sift_up(size_type pos);    // moves the element at pos up to its place
+  void sift_down(size_type pos);  // moves the element at pos down
+  void make_heap();               // orders the whole container
+
+  Container container_;
+  Compare compare_;
+};
+
+// an adapter is relocatable exactly when its container is
+template <typename T, typename Container, typename Compare, size_t Arity>
+struct is_trivially_relocatable<priority_queue<T, Container, Compare, Arity>>
+    : std::integral_constant<bool, is_trivially_relocatable<Container>::value &&
+                                       std::is_empty<Compare>::value> {};
+
+}  // namespace s21
+
+#include "s21_priority_queue.tpp"
+
+#endif
@@ -0,0 +1,138 @@
+#include "s21_priority_queue.h"
+
+namespace s21 {
+
+// The children of node i are Arity * i + 1 ... Arity * i + Arity and its
+// parent is (i - 1) / Arity.
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue()
+    : container_(), compare_() {}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    const Compare &compare)
+    : container_(), compare_(compare) {}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    std::initializer_list<value_type> const &items, const Compare &compare)
+    : container_(items), compare_(compare) {
+  make_heap();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename InputIt>
+priority_queue<T, Container, Compare, Arity>::priority_queue(
+    InputIt first, InputIt last, const Compare &compare)
+    : container_(), compare_(compare) {
+  for (; first != last; ++first) container_.push_back(*first);
+  make_heap();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::const_reference
+priority_queue<T, Container, Compare, Arity>::top() const {
+  if (empty()) throw std::out_of_range("Error! priority_queue is empty");
+  return container_[0];
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+typename priority_queue<T, Container, Compare, Arity>::size_type
+priority_queue<T, Container, Compare, Arity>::size() const {
+  return container_.size();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+bool priority_queue<T, Container, Compare, Arity>::empty() const {
+  return container_.empty();
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(
+    const_reference value) {
+  container_.push_back(value);
+  sift_up(container_.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::push(value_type &&value) {
+  container_.push_back(std::move(value));
+  sift_up(container_.size() - 1);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename... Args>
+void priority_queue<T, Container, Compare, Arity>::emplace(Args &&...args) {
+  container_.emplace_back(std::forward<Args>(args)...);
+  sift_up(container_.size() - 1);
+}
+
+// moves the last element into the root and sifts it down
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::pop() {
+  if (empty()) throw std::out_of_range("Error! priority_queue is empty");
+  size_type last = container_.size() - 1;
+  if (last > 0) container_[0] = std::move(container_[last]);
+  container_.pop_back();
+  if (!container_.empty()) sift_down(0);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::swap(
+    priority_queue &other) {
+  using std::swap;
+  container_.swap(other.container_);
+  swap(compare_, other.compare_);
+}
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+template <typename... Args>
+void priority_queue<T, Container, Compare, Arity>::insert_many_back(
+    Args &&...args) {
+  (push(std::forward<Args>(args)), ...);
+}
+
+// private
+
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::sift_up(size_type pos) {
+  value_type moving = std::move(container_[pos]);
+  while (pos > 0) {
+    size_type parent = (pos - 1) / Arity;
+    if (!compare_(container_[parent], moving)) break;
+    container_[pos] = std::move(container_[parent]);
+    pos = parent;
+  }
+  container_[pos] = std::move(moving);
+}
+
+// the hole follows the greatest child down until moving is not smaller
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::sift_down(size_type pos) {
+  const size_type size = container_.size();
+  value_type moving = std::move(container_[pos]);
+  for (;;) {
+    size_type first = pos * Arity + 1;
+    if (first >= size) break;
+    size_type last = first + Arity < size ? first + Arity : size;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; child++) {
+      if (compare_(container_[best], container_[child])) best = child;
+    }
+    if (!compare_(moving, container_[best])) break;
+    container_[pos] = std::move(container_[best]);
+    pos = best;
+  }
+  container_[pos] = std::move(moving);
+}
+
+// sifts down every inner node from the last one up, O(n) in total
+template <typename T, typename Container, typename Compare, size_t Arity>
+void priority_queue<T, Container, Compare, Arity>::make_heap() {
+  size_type size = container_.size();
+  if (size < 2) return;
+  for (size_type pos = (size - 2) / Arity + 1; pos-- > 0;) sift_down(pos);
+}
+
+}  // namespace s21
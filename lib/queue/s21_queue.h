@@ -2,6 +2,10 @@
 #define S21_QUEUE_H
 
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
 
 #include "../linked_list/s21_linked_list.h"
 
@@ -18,9 +22,27 @@ class queue {
   queue();  // default constructor, creates empty queue
   queue(std::initializer_list<value_type> const &items);  // init list
   queue(const queue &q);
-  queue(queue &&q);  // move constructor
+  queue(queue &&q) noexcept(
+      std::is_nothrow_move_constructible<Container>::value);  // move
+                                                              // constructor
+  // allocator-extended constructors, for containers that take an allocator
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  explicit queue(const Alloc &alloc);  // empty, allocating from alloc
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  queue(std::initializer_list<value_type> const &items, const Alloc &alloc);
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  queue(const queue &q, const Alloc &alloc);
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  queue(queue &&q, const Alloc &alloc);
   ~queue();
-  queue &operator=(queue &&q);  // assignment operator overload for moving
+  queue &operator=(queue &&q) noexcept(
+      std::is_nothrow_move_assignable<Container>::value);  // assignment
+                                                           // operator overload
+                                                           // for moving
 
   const_reference front();
   const_reference back();
@@ -29,8 +51,11 @@ class queue {
   bool empty();
 
   void push(const_reference value);  // inserts element at the end
-  void pop();                        // remove first elem
-  void swap(queue &other);           // swaps the contents
+  void push(value_type &&value);     // moves an element to the end
+  template <typename... Args>
+  void emplace(Args &&...args);  // constructs an element in place at the end
+  void pop();                    // remove first elem
+  void swap(queue &other);       // swaps the contents
 
   template <typename... Args>
   void insert_many_back(Args &&...args);
@@ -39,8 +64,30 @@ class queue {
   Container container_;
 };
 
+// an adapter is relocatable exactly when its container is
+template <typename T, typename Container>
+struct is_trivially_relocatable<queue<T, Container>>
+    : is_trivially_relocatable<Container> {};
+
+namespace pmr {
+
+// queue over a linked_list whose nodes come from a std::pmr::memory_resource
+template <typename T>
+using queue = s21::queue<T, pmr::linked_list<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
+namespace std {
+
+// a queue takes an allocator exactly when its container does
+template <typename T, typename Container, typename Alloc>
+struct uses_allocator<s21::queue<T, Container>, Alloc>
+    : uses_allocator<Container, Alloc>::type {};
+
+}  // namespace std
+
 #include "s21_queue.tpp"
 
 #endif
\ No newline at end of file
@@ -13,18 +13,37 @@ template <typename T, typename Container>
 queue<T, Container>::queue(const queue &q) : container_(q.container_) {}
 
 template <typename T, typename Container>
-queue<T, Container>::queue(queue &&q) : container_(std::move(q.container_)) {}
+queue<T, Container>::queue(queue &&q) noexcept(
+    std::is_nothrow_move_constructible<Container>::value)
+    : container_(std::move(q.container_)) {}
 
 template <typename T, typename Container>
-queue<T, Container>::~queue() {}
+template <typename Alloc, typename>
+queue<T, Container>::queue(const Alloc &alloc) : container_(alloc) {}
+
+template <typename T, typename Container>
+template <typename Alloc, typename>
+queue<T, Container>::queue(std::initializer_list<value_type> const &items,
+                           const Alloc &alloc)
+    : container_(items, alloc) {}
+
+template <typename T, typename Container>
+template <typename Alloc, typename>
+queue<T, Container>::queue(const queue &q, const Alloc &alloc)
+    : container_(q.container_, alloc) {}
+
+template <typename T, typename Container>
+template <typename Alloc, typename>
+queue<T, Container>::queue(queue &&q, const Alloc &alloc)
+    : container_(std::move(q.container_), alloc) {}
 
 template <typename T, typename Container>
-queue<T, Container> &queue<T, Container>::operator=(queue &&q) {
-  if (this != &q) {
-    container_ = std::move(q.container_);
-    while (!q.empty()) q.pop();
-  }
+queue<T, Container>::~queue() {}
 
+template <typename T, typename Container>
+queue<T, Container> &queue<T, Container>::operator=(queue &&q) noexcept(
+    std::is_nothrow_move_assignable<Container>::value) {
+  if (this != &q) container_ = std::move(q.container_);
   return *this;
 }
 
@@ -53,9 +72,20 @@ void queue<T, Container>::push(const_reference value) {
   container_.push_back(value);
 }
 
+template <typename T, typename Container>
+void queue<T, Container>::push(value_type &&value) {
+  container_.push_back(std::move(value));
+}
+
+template <typename T, typename Container>
+template <typename... Args>
+void queue<T, Container>::emplace(Args &&...args) {
+  container_.emplace_back(std::forward<Args>(args)...);
+}
+
 template <typename T, typename Container>
 void queue<T, Container>::pop() {
-  container_.pop();
+  container_.pop_front();
 }
 
 template <typename T, typename Container>
@@ -2,41 +2,51 @@
 #define RED_BLACK_TREE_H
 
 #include <iostream>
+#include <memory>
 
+#include "s21_memory.h"
 #include "vector/s21_vector.h"
 
 namespace s21 {
 
-template <typename D, typename K, typename V>
+template <typename D, typename K, typename V, typename A = std::allocator<D>>
 class TreeIterator;
 
-template <typename D, typename K, typename V>
+template <typename D, typename K, typename V, typename A = std::allocator<D>>
 class TreeConstIterator;
 
-template <typename D, typename K, typename V>
-class RedBlackTree {
+// nodes, the leaf sentinel included, come from A rebound to the node type;
+// A may be an allocator of any type, map passes one of its value_type
+template <typename D, typename K, typename V, typename A = std::allocator<D>>
+class RedBlackTree : private allocator_holder<A> {
  public:
-  friend class TreeIterator<D, K, V>;
-  friend class TreeConstIterator<D, K, V>;
+  friend class TreeIterator<D, K, V, A>;
+  friend class TreeConstIterator<D, K, V, A>;
 
   using data_type = D;
   using key_type = K;
   using value_type = V;
   using reference = data_type &;
   using const_reference = const data_type &;
-  using iterator = TreeIterator<D, K, V>;
-  using const_iterator = TreeConstIterator<D, K, V>;
+  using iterator = TreeIterator<D, K, V, A>;
+  using const_iterator = TreeConstIterator<D, K, V, A>;
   using size_type = size_t;
+  using allocator_type = A;
 
   RedBlackTree();
+  explicit RedBlackTree(const A &alloc);
   RedBlackTree(const RedBlackTree &other);
+  RedBlackTree(const RedBlackTree &other, const A &alloc);
   RedBlackTree(RedBlackTree &&other);
-  RedBlackTree(std::initializer_list<data_type> const &items);
+  RedBlackTree(std::initializer_list<data_type> const &items,
+               const A &alloc = A());
   RedBlackTree &operator=(const RedBlackTree &other);
   reference operator[](const K &key);
   RedBlackTree &operator=(RedBlackTree &&other);
   ~RedBlackTree();
 
+  allocator_type get_allocator() const noexcept;
+
   iterator begin();
   iterator end();
   bool empty();
@@ -69,6 +79,12 @@ class RedBlackTree {
     bool is_leaf = true;
   };
 
+  using allocator_holder<A>::allocator;
+
+  template <typename... Args>
+  Node *new_node(Args &&...args);
+  void free_node(Node *node) noexcept;
+  void swap_nodes(RedBlackTree &other) noexcept;
   Node *insert_node(const data_type &value);
   void left_rotate(Node *node);
   void right_rotate(Node *node);
@@ -96,16 +112,16 @@ class RedBlackTree {
   Node *root_;
 };
 
-template <typename D, typename K, typename V>
+template <typename D, typename K, typename V, typename A>
 class TreeIterator {
  public:
-  friend RedBlackTree<D, K, V>;
+  friend RedBlackTree<D, K, V, A>;
 
   TreeIterator();
-  TreeIterator(const TreeIterator<D, K, V> &other)
+  TreeIterator(const TreeIterator<D, K, V, A> &other)
       : iter_(other.iter_), rbtree_(other.rbtree_){};
-  TreeIterator(typename RedBlackTree<D, K, V>::Node *node,
-               const RedBlackTree<D, K, V> *rbtree_);
+  TreeIterator(typename RedBlackTree<D, K, V, A>::Node *node,
+               const RedBlackTree<D, K, V, A> *rbtree_);
   ~TreeIterator() = default;
   TreeIterator &operator++();
   TreeIterator &operator++(int);
@@ -119,25 +135,25 @@ class TreeIterator {
   bool operator!=(const TreeIterator &other) const;
 
  protected:
-  typename RedBlackTree<D, K, V>::Node *get_next(
-      typename RedBlackTree<D, K, V>::Node *current);
-  typename RedBlackTree<D, K, V>::Node *get_prev(
-      typename RedBlackTree<D, K, V>::Node *current);
+  typename RedBlackTree<D, K, V, A>::Node *get_next(
+      typename RedBlackTree<D, K, V, A>::Node *current);
+  typename RedBlackTree<D, K, V, A>::Node *get_prev(
+      typename RedBlackTree<D, K, V, A>::Node *current);
 
-  typename RedBlackTree<D, K, V>::Node *iter_;
-  const RedBlackTree<D, K, V> *rbtree_;
+  typename RedBlackTree<D, K, V, A>::Node *iter_;
+  const RedBlackTree<D, K, V, A> *rbtree_;
 };
 
-template <typename D, typename K, typename V>
-class TreeConstIterator : public TreeIterator<D, K, V> {
+template <typename D, typename K, typename V, typename A>
+class TreeConstIterator : public TreeIterator<D, K, V, A> {
  public:
-  friend RedBlackTree<D, K, V>;
+  friend RedBlackTree<D, K, V, A>;
 
   TreeConstIterator();
-  TreeConstIterator(const typename RedBlackTree<D, K, V>::Node *node,
-                    const RedBlackTree<D, K, V> *rbtree_);
-  TreeConstIterator(const TreeIterator<D, K, V> &other)
-      : TreeIterator<D, K, V>(other){};
+  TreeConstIterator(const typename RedBlackTree<D, K, V, A>::Node *node,
+                    const RedBlackTree<D, K, V, A> *rbtree_);
+  TreeConstIterator(const TreeIterator<D, K, V, A> &other)
+      : TreeIterator<D, K, V, A>(other){};
   ~TreeConstIterator() = default;
 };
 
@@ -11,43 +11,62 @@ RebBlackTree constructors
 *****************************
 */
 
-template <typename D, typename K, typename V>
-RedBlackTree<D, K, V>::RedBlackTree() {
-  leaf_ = new Node();
+template <typename D, typename K, typename V, typename A>
+RedBlackTree<D, K, V, A>::RedBlackTree() : RedBlackTree(A()) {}
+
+template <typename D, typename K, typename V, typename A>
+RedBlackTree<D, K, V, A>::RedBlackTree(const A& alloc)
+    : allocator_holder<A>(alloc) {
+  leaf_ = new_node();
   root_ = leaf_;
 };
 
-template <typename D, typename K, typename V>
-RedBlackTree<D, K, V>::RedBlackTree(const RedBlackTree& other)
-    : RedBlackTree() {
+template <typename D, typename K, typename V, typename A>
+RedBlackTree<D, K, V, A>::RedBlackTree(const RedBlackTree& other)
+    : RedBlackTree(other, std::allocator_traits<
+                              A>::select_on_container_copy_construction(
+                              other.allocator())) {}
+
+template <typename D, typename K, typename V, typename A>
+RedBlackTree<D, K, V, A>::RedBlackTree(const RedBlackTree& other,
+                                       const A& alloc)
+    : RedBlackTree(alloc) {
   if (other.root_ != nullptr && !other.root_->is_leaf) {
     this->root_ = copy_tree(other.root_);
   }
 };
 
-template <typename D, typename K, typename V>
-RedBlackTree<D, K, V>::RedBlackTree(RedBlackTree&& other) {
-  if (this->root_ != other.root_) {
-    this->root_ = other.root_;
-    this->leaf_ = new Node();
-    other.root_ = other.leaf_;
-  }
+template <typename D, typename K, typename V, typename A>
+RedBlackTree<D, K, V, A>::RedBlackTree(RedBlackTree&& other)
+    : RedBlackTree(other.allocator()) {
+  swap_nodes(other);
 };
 
-template <typename D, typename K, typename V>
-RedBlackTree<D, K, V>::RedBlackTree(
-    std::initializer_list<data_type> const& items)
-    : RedBlackTree() {
+template <typename D, typename K, typename V, typename A>
+RedBlackTree<D, K, V, A>::RedBlackTree(
+    std::initializer_list<data_type> const& items, const A& alloc)
+    : RedBlackTree(alloc) {
   for (auto i = items.begin(); i != items.end(); i++) {
     insert_node(*i);
   }
 };
 
-template <typename D, typename K, typename V>
-RedBlackTree<D, K, V>& RedBlackTree<D, K, V>::operator=(
-    const RedBlackTree& other) {
+// with an allocator that propagates on copy assignment the nodes of this tree
+// go back to the old allocator before the copies come from the new one
+template <typename D, typename K, typename V, typename A>
+RedBlackTree<D, K, V, A>&
+RedBlackTree<D, K, V, A>::operator=(const RedBlackTree& other) {
   if (this->root_ != other.root_) {
     this->clear();
+    if constexpr (std::allocator_traits<
+                      A>::propagate_on_container_copy_assignment::value) {
+      if (!allocators_equal(allocator(), other.allocator())) {
+        free_node(leaf_);
+        allocator() = other.allocator();
+        leaf_ = new_node();
+        root_ = leaf_;
+      }
+    }
     if (other.root_ != nullptr && !other.root_->is_leaf) {
       root_ = copy_tree(other.root_);
     }
@@ -55,34 +74,71 @@ RedBlackTree<D, K, V>& RedBlackTree<D, K, V>::operator=(
   return *this;
 }
 
-template <typename D, typename K, typename V>
-RedBlackTree<D, K, V>& RedBlackTree<D, K, V>::operator=(RedBlackTree&& other) {
+// with unequal allocators that stay put the values of other are copied into
+// nodes of this tree
+template <typename D, typename K, typename V, typename A>
+RedBlackTree<D, K, V, A>&
+RedBlackTree<D, K, V, A>::operator=(RedBlackTree&& other) {
   if (this->root_ != other.root_) {
-    this->clear();
-    delete this->leaf_;
-    this->leaf_ = other.leaf_;
-    this->root_ = other.root_;
-    other.leaf_ = new Node();
-    other.root_ = other.leaf_;
+    if (allocator_moves_storage_v<A> ||
+        allocators_equal(allocator(), other.allocator())) {
+      this->clear();
+      free_node(this->leaf_);
+      if constexpr (std::allocator_traits<
+                        A>::propagate_on_container_move_assignment::value) {
+        allocator() = std::move(other.allocator());
+      }
+      this->leaf_ = other.leaf_;
+      this->root_ = other.root_;
+      other.leaf_ = other.new_node();
+      other.root_ = other.leaf_;
+    } else {
+      *this = static_cast<const RedBlackTree&>(other);
+      other.clear();
+    }
   }
   return *this;
 }
 
-template <typename D, typename K, typename V>
-RedBlackTree<D, K, V>::~RedBlackTree() {
+template <typename D, typename K, typename V, typename A>
+RedBlackTree<D, K, V, A>::~RedBlackTree() {
   clear();
-  delete leaf_;
+  free_node(leaf_);
 };
 
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::allocator_type
+RedBlackTree<D, K, V, A>::get_allocator() const noexcept {
+  return allocator();
+}
+
 /*
 *****************************
 RebBlackTree private methods
 *****************************
 */
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::insert_node(
-    const data_type& value) {
+template <typename D, typename K, typename V, typename A>
+template <typename... Args>
+typename RedBlackTree<D, K, V, A>::Node*
+RedBlackTree<D, K, V, A>::new_node(Args&&... args) {
+  return allocate_node<Node>(allocator(), std::forward<Args>(args)...);
+}
+
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::free_node(Node* node) noexcept {
+  deallocate_node(allocator(), node);
+}
+
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::swap_nodes(RedBlackTree& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(leaf_, other.leaf_);
+}
+
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::Node*
+RedBlackTree<D, K, V, A>::insert_node(const data_type& value) {
   Node* current = this->root_;
   Node* parent = nullptr;
   while (current != nullptr && !current->is_leaf) {
@@ -94,7 +150,7 @@ typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::insert_node(
     }
   }
 
-  Node* new_node = new Node{leaf_, leaf_, parent, RED, value, 0};
+  Node* new_node = this->new_node(leaf_, leaf_, parent, RED, value, false);
   if (parent != nullptr) {
     if (less(value, parent->data)) {
       parent->left = new_node;
@@ -108,8 +164,8 @@ typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::insert_node(
   return new_node;
 };
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::balance_insert(Node* new_node) {
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::balance_insert(Node* new_node) {
   Node* uncle = nullptr;
   while (new_node != root_ && new_node->parent->color == RED) {
     if (new_node->parent == new_node->parent->parent->left) {
@@ -149,8 +205,8 @@ void RedBlackTree<D, K, V>::balance_insert(Node* new_node) {
   this->root_->color = BLACK;
 }
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::left_rotate(Node* node) {
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::left_rotate(Node* node) {
   Node* temp_node = node->right;
   node->right = temp_node->left;
   if (!temp_node->left->is_leaf) {
@@ -174,8 +230,8 @@ void RedBlackTree<D, K, V>::left_rotate(Node* node) {
   }
 }
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::right_rotate(Node* node) {
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::right_rotate(Node* node) {
   Node* temp_node = node->left;
   node->left = temp_node->right;
   if (!temp_node->right->is_leaf) {
@@ -199,9 +255,9 @@ void RedBlackTree<D, K, V>::right_rotate(Node* node) {
   }
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::find_node_data(
-    const D& value) {
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::Node*
+RedBlackTree<D, K, V, A>::find_node_data(const D& value) {
   Node* current = root_;
   while (current != nullptr && !current->is_leaf) {
     if (equal(value, current->data)) {
@@ -217,9 +273,9 @@ typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::find_node_data(
   return nullptr;
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::find_node_key(
-    const K& key) {
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::Node*
+RedBlackTree<D, K, V, A>::find_node_key(const K& key) {
   Node* current = root_;
   while (current != nullptr && !current->is_leaf) {
     if (equal(key, current->data)) {
@@ -235,8 +291,8 @@ typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::find_node_key(
   return nullptr;
 }
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::delete_node(Node* removable) {
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::delete_node(Node* removable) {
   Node *x, *y;
 
   if (removable == nullptr || removable->is_leaf) return;
@@ -268,12 +324,12 @@ void RedBlackTree<D, K, V>::delete_node(Node* removable) {
   if (y != removable) removable->data = y->data;
   if (y->color == BLACK) balance_remove(x);
 
-  delete y;
+  free_node(y);
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::find_max(
-    Node* node) {
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::Node*
+RedBlackTree<D, K, V, A>::find_max(Node* node) {
   Node* max = node;
   Node* right_child = node->right;
   while (right_child != nullptr && !right_child->is_leaf) {
@@ -283,9 +339,9 @@ typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::find_max(
   return max;
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::find_min(
-    Node* node) {
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::Node*
+RedBlackTree<D, K, V, A>::find_min(Node* node) {
   Node* min = node;
   Node* left_child = node->left;
   while (left_child != nullptr && !left_child->is_leaf) {
@@ -295,8 +351,8 @@ typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::find_min(
   return min;
 }
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::balance_remove(Node* node) {
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::balance_remove(Node* node) {
   while (node != root_ && node->color == BLACK) {
     if (node == node->parent->left) {
       Node* brother = node->parent->right;
@@ -351,14 +407,14 @@ void RedBlackTree<D, K, V>::balance_remove(Node* node) {
   node->color = BLACK;
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::copy_tree(
-    Node* node) {
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::Node*
+RedBlackTree<D, K, V, A>::copy_tree(Node* node) {
   if (node == nullptr || node->is_leaf) {
-    return node;
+    return node == nullptr ? node : leaf_;
   }
 
-  Node* new_node = new Node(*node);
+  Node* new_node = this->new_node(*node);
   new_node->color = node->color;
   new_node->data = node->data;
   new_node->left = copy_tree(node->left);
@@ -368,39 +424,39 @@ typename RedBlackTree<D, K, V>::Node* RedBlackTree<D, K, V>::copy_tree(
   return new_node;
 }
 
-template <typename D, typename K, typename V>
-bool RedBlackTree<D, K, V>::less(const K& left_value,
-                                 const K& right_value) const {
+template <typename D, typename K, typename V, typename A>
+bool RedBlackTree<D, K, V, A>::less(const K& left_value,
+                                    const K& right_value) const {
   return (left_value < right_value);
 }
 
-template <typename D, typename K, typename V>
-bool RedBlackTree<D, K, V>::less(const std::pair<K, V>& left_value,
-                                 const std::pair<K, V>& right_value) const {
+template <typename D, typename K, typename V, typename A>
+bool RedBlackTree<D, K, V, A>::less(const std::pair<K, V>& left_value,
+                                    const std::pair<K, V>& right_value) const {
   return (left_value.first < right_value.first);
 }
 
-template <typename D, typename K, typename V>
-bool RedBlackTree<D, K, V>::less(const K& left_value,
-                                 const std::pair<K, V>& right_value) const {
+template <typename D, typename K, typename V, typename A>
+bool RedBlackTree<D, K, V, A>::less(const K& left_value,
+                                    const std::pair<K, V>& right_value) const {
   return (left_value < right_value.first);
 }
 
-template <typename D, typename K, typename V>
-bool RedBlackTree<D, K, V>::equal(const K& left_value,
-                                  const K& right_value) const {
+template <typename D, typename K, typename V, typename A>
+bool RedBlackTree<D, K, V, A>::equal(const K& left_value,
+                                     const K& right_value) const {
   return (left_value == right_value);
 }
 
-template <typename D, typename K, typename V>
-bool RedBlackTree<D, K, V>::equal(const std::pair<K, V>& left_value,
-                                  const std::pair<K, V>& right_value) const {
+template <typename D, typename K, typename V, typename A>
+bool RedBlackTree<D, K, V, A>::equal(const std::pair<K, V>& left_value,
+                                     const std::pair<K, V>& right_value) const {
   return (left_value.first == right_value.first);
 }
 
-template <typename D, typename K, typename V>
-bool RedBlackTree<D, K, V>::equal(const K& left_value,
-                                  const std::pair<K, V>& right_value) const {
+template <typename D, typename K, typename V, typename A>
+bool RedBlackTree<D, K, V, A>::equal(const K& left_value,
+                                     const std::pair<K, V>& right_value) const {
   return (left_value == right_value.first);
 }
 
@@ -410,8 +466,8 @@ RebBlackTree public methods
 *****************************
 */
 
-template <typename D, typename K, typename V>
-D& RedBlackTree<D, K, V>::operator[](const K& key) {
+template <typename D, typename K, typename V, typename A>
+D& RedBlackTree<D, K, V, A>::operator[](const K& key) {
   Node* node = find_node_key(key);
   if (node == nullptr) {
     node = insert_node({key, V()});
@@ -419,24 +475,24 @@ D& RedBlackTree<D, K, V>::operator[](const K& key) {
   return node->data;
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::iterator RedBlackTree<D, K, V>::begin() {
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::iterator RedBlackTree<D, K, V, A>::begin() {
   return iterator(find_min(root_), this);
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::iterator RedBlackTree<D, K, V>::end() {
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::iterator RedBlackTree<D, K, V, A>::end() {
   return (root_->is_leaf) ? iterator(find_max(root_), this)
                           : iterator(find_max(root_)->right, this);
 }
 
-template <typename D, typename K, typename V>
-bool RedBlackTree<D, K, V>::empty() {
+template <typename D, typename K, typename V, typename A>
+bool RedBlackTree<D, K, V, A>::empty() {
   return (root_ == nullptr || root_->is_leaf);
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::size_type RedBlackTree<D, K, V>::size() {
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::size_type RedBlackTree<D, K, V, A>::size() {
   int size = 0;
   auto iter = begin();
   while (iter.iter_ != nullptr && !iter.iter_->is_leaf) {
@@ -446,21 +502,22 @@ typename RedBlackTree<D, K, V>::size_type RedBlackTree<D, K, V>::size() {
   return size;
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::size_type RedBlackTree<D, K, V>::max_size() {
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::size_type
+RedBlackTree<D, K, V, A>::max_size() {
   return std::numeric_limits<size_type>::max() / sizeof(Node) / 2;
 }
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::clear() {
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::clear() {
   while (root_ != nullptr && !root_->is_leaf) {
     delete_node(find_max(root_));
   }
 }
 
-template <typename D, typename K, typename V>
-std::pair<typename RedBlackTree<D, K, V>::iterator, bool>
-RedBlackTree<D, K, V>::insert(const data_type& value) {
+template <typename D, typename K, typename V, typename A>
+std::pair<typename RedBlackTree<D, K, V, A>::iterator, bool>
+RedBlackTree<D, K, V, A>::insert(const data_type& value) {
   bool inserted;
   iterator iter = this->begin();
   iter.iter_ = find_node_data(value);
@@ -470,32 +527,34 @@ RedBlackTree<D, K, V>::insert(const data_type& value) {
     iter.iter_ = insert_node(value);
     inserted = true;
   }
-  std::pair<typename RedBlackTree<D, K, V>::iterator, bool> result{iter,
-                                                                   inserted};
+  std::pair<typename RedBlackTree<D, K, V, A>::iterator, bool> result{
+      iter, inserted};
   return result;
 }
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::erase(iterator pos) {
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::erase(iterator pos) {
   Node* node = find_node_data(pos.iter_->data);
   delete_node(node);
 }
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::erase(const key_type& key) {
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::erase(const key_type& key) {
   Node* node = find_node_key(key);
   delete_node(node);
 }
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::swap(RedBlackTree<D, K, V>& other) {
-  std::swap(root_, other.root_);
-  std::swap(leaf_, other.leaf_);
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::swap(RedBlackTree<D, K, V, A>& other) {
+  if constexpr (std::allocator_traits<A>::propagate_on_container_swap::value) {
+    std::swap(allocator(), other.allocator());
+  }
+  swap_nodes(other);
 }
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::merge(RedBlackTree<D, K, V>& other) {
-  RedBlackTree<D, K, V> temp(other);
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::merge(RedBlackTree<D, K, V, A>& other) {
+  RedBlackTree<D, K, V, A> temp(other, other.allocator());
   for (auto iter = temp.begin(); iter != temp.end(); iter++) {
     auto check = insert(*iter);
     if (check.second) {
@@ -504,23 +563,24 @@ void RedBlackTree<D, K, V>::merge(RedBlackTree<D, K, V>& other) {
   }
 }
 
-template <typename D, typename K, typename V>
-bool RedBlackTree<D, K, V>::contains(const key_type& key) {
+template <typename D, typename K, typename V, typename A>
+bool RedBlackTree<D, K, V, A>::contains(const key_type& key) {
   return (find_node_key(key) != nullptr);
 }
 
-template <typename D, typename K, typename V>
+template <typename D, typename K, typename V, typename A>
 template <typename... Args>
-s21::vector<std::pair<typename RedBlackTree<D, K, V>::iterator, bool>>
-RedBlackTree<D, K, V>::insert_many(Args&&... args) {
-  s21::vector<std::pair<typename RedBlackTree<D, K, V>::iterator, bool>> result;
+s21::vector<std::pair<typename RedBlackTree<D, K, V, A>::iterator, bool>>
+RedBlackTree<D, K, V, A>::insert_many(Args&&... args) {
+  s21::vector<std::pair<typename RedBlackTree<D, K, V, A>::iterator, bool>>
+      result;
   (result.push_back(insert(std::forward<Args>(args))), ...);
   return result;
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::iterator RedBlackTree<D, K, V>::multi_insert(
-    const data_type& value) {
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::iterator
+RedBlackTree<D, K, V, A>::multi_insert(const data_type& value) {
   iterator result(insert_node(value), this);
   return result;
 }
@@ -531,16 +591,17 @@ TreeIterator methods
 *****************************
 */
 
-template <typename D, typename K, typename V>
-TreeIterator<D, K, V>::TreeIterator() : iter_(nullptr) {}
+template <typename D, typename K, typename V, typename A>
+TreeIterator<D, K, V, A>::TreeIterator() : iter_(nullptr) {}
 
-template <typename D, typename K, typename V>
-TreeIterator<D, K, V>::TreeIterator(typename RedBlackTree<D, K, V>::Node* node,
-                                    const RedBlackTree<D, K, V>* rbtree_)
+template <typename D, typename K, typename V, typename A>
+TreeIterator<D, K, V, A>::TreeIterator(
+    typename RedBlackTree<D, K, V, A>::Node* node,
+    const RedBlackTree<D, K, V, A>* rbtree_)
     : iter_(node), rbtree_(rbtree_) {}
 
-template <typename D, typename K, typename V>
-TreeIterator<D, K, V>& TreeIterator<D, K, V>::operator++() {
+template <typename D, typename K, typename V, typename A>
+TreeIterator<D, K, V, A>& TreeIterator<D, K, V, A>::operator++() {
   if (!iter_->is_leaf) {
     if (iter_ == rbtree_->find_max(rbtree_->root_)) {
       iter_ = rbtree_->find_max(rbtree_->root_)->right;
@@ -550,14 +611,14 @@ TreeIterator<D, K, V>& TreeIterator<D, K, V>::operator++() {
   return *this;
 }
 
-template <typename D, typename K, typename V>
-TreeIterator<D, K, V>& TreeIterator<D, K, V>::operator++(int) {
+template <typename D, typename K, typename V, typename A>
+TreeIterator<D, K, V, A>& TreeIterator<D, K, V, A>::operator++(int) {
   ++(*this);
   return *this;
 }
 
-template <typename D, typename K, typename V>
-TreeIterator<D, K, V>& TreeIterator<D, K, V>::operator--() {
+template <typename D, typename K, typename V, typename A>
+TreeIterator<D, K, V, A>& TreeIterator<D, K, V, A>::operator--() {
   if (iter_ == rbtree_->find_max(rbtree_->root_)->right) {
     iter_ = rbtree_->find_max(rbtree_->root_);
   } else if (iter_ != rbtree_->find_min(rbtree_->root_) && !iter_->is_leaf) {
@@ -566,30 +627,30 @@ TreeIterator<D, K, V>& TreeIterator<D, K, V>::operator--() {
   return *this;
 }
 
-template <typename D, typename K, typename V>
-TreeIterator<D, K, V>& TreeIterator<D, K, V>::operator--(int) {
+template <typename D, typename K, typename V, typename A>
+TreeIterator<D, K, V, A>& TreeIterator<D, K, V, A>::operator--(int) {
   --(*this);
   return *this;
 }
 
-template <typename D, typename K, typename V>
-const D& TreeIterator<D, K, V>::operator*() const {
+template <typename D, typename K, typename V, typename A>
+const D& TreeIterator<D, K, V, A>::operator*() const {
   return iter_->data;
 }
 
-template <typename D, typename K, typename V>
-const D* TreeIterator<D, K, V>::operator->() const {
+template <typename D, typename K, typename V, typename A>
+const D* TreeIterator<D, K, V, A>::operator->() const {
   return &(iter_->data);
 }
 
-template <typename D, typename K, typename V>
-std::pair<const K, V>* TreeIterator<D, K, V>::operator->() {
+template <typename D, typename K, typename V, typename A>
+std::pair<const K, V>* TreeIterator<D, K, V, A>::operator->() {
   return reinterpret_cast<std::pair<const K, V>*>(&(iter_->data));
 }
 
-template <typename D, typename K, typename V>
-TreeIterator<D, K, V>& TreeIterator<D, K, V>::operator=(
-    const TreeIterator& other) {
+template <typename D, typename K, typename V, typename A>
+TreeIterator<D, K, V, A>&
+TreeIterator<D, K, V, A>::operator=(const TreeIterator& other) {
   if (this != &other) {
     iter_ = other.iter_;
     rbtree_ = other.rbtree_;
@@ -597,27 +658,28 @@ TreeIterator<D, K, V>& TreeIterator<D, K, V>::operator=(
   return *this;
 }
 
-template <typename D, typename K, typename V>
-bool TreeIterator<D, K, V>::operator==(const TreeIterator& other) const {
+template <typename D, typename K, typename V, typename A>
+bool TreeIterator<D, K, V, A>::operator==(const TreeIterator& other) const {
   return (this->iter_ == other.iter_);
 }
 
-template <typename D, typename K, typename V>
-bool TreeIterator<D, K, V>::operator!=(const TreeIterator& other) const {
+template <typename D, typename K, typename V, typename A>
+bool TreeIterator<D, K, V, A>::operator!=(const TreeIterator& other) const {
   return (this->iter_ != other.iter_);
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::Node* TreeIterator<D, K, V>::get_next(
-    typename RedBlackTree<D, K, V>::Node* current) {
-  typename RedBlackTree<D, K, V>::Node* next = nullptr;
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::Node*
+TreeIterator<D, K, V, A>::get_next(
+    typename RedBlackTree<D, K, V, A>::Node* current) {
+  typename RedBlackTree<D, K, V, A>::Node* next = nullptr;
   if (current->right != nullptr && !current->right->is_leaf) {
     next = current->right;
     while (next->left != nullptr && !next->left->is_leaf) {
       next = next->left;
     }
   } else {
-    typename RedBlackTree<D, K, V>::Node* temp = current;
+    typename RedBlackTree<D, K, V, A>::Node* temp = current;
     next = current->parent;
     while (next != nullptr && !next->is_leaf && next->right == temp) {
       temp = next;
@@ -627,17 +689,18 @@ typename RedBlackTree<D, K, V>::Node* TreeIterator<D, K, V>::get_next(
   return next;
 }
 
-template <typename D, typename K, typename V>
-typename RedBlackTree<D, K, V>::Node* TreeIterator<D, K, V>::get_prev(
-    typename RedBlackTree<D, K, V>::Node* current) {
-  typename RedBlackTree<D, K, V>::Node* prev = nullptr;
+template <typename D, typename K, typename V, typename A>
+typename RedBlackTree<D, K, V, A>::Node*
+TreeIterator<D, K, V, A>::get_prev(
+    typename RedBlackTree<D, K, V, A>::Node* current) {
+  typename RedBlackTree<D, K, V, A>::Node* prev = nullptr;
   if (current->left != nullptr && !current->left->is_leaf) {
     prev = current->left;
     while (prev->right != nullptr && !prev->right->is_leaf) {
       prev = prev->right;
     }
   } else {
-    typename RedBlackTree<D, K, V>::Node* temp = current;
+    typename RedBlackTree<D, K, V, A>::Node* temp = current;
     prev = current->parent;
     while (prev != nullptr && !prev->is_leaf && prev->left == temp) {
       temp = prev;
@@ -653,16 +716,17 @@ TreeConstIterator methods
 *****************************
 */
 
-template <typename D, typename K, typename V>
-TreeConstIterator<D, K, V>::TreeConstIterator() : TreeIterator<D, K, V>() {}
+template <typename D, typename K, typename V, typename A>
+TreeConstIterator<D, K, V, A>::TreeConstIterator()
+    : TreeIterator<D, K, V, A>() {}
 
-template <typename D, typename K, typename V>
-TreeConstIterator<D, K, V>::TreeConstIterator(
-    const typename RedBlackTree<D, K, V>::Node* node,
-    const RedBlackTree<D, K, V>* rbtree_)
-    : TreeIterator<D, K, V>(
-          const_cast<typename RedBlackTree<D, K, V>::Node*>(node),
-          const_cast<RedBlackTree<D, K, V>*>(rbtree_)) {}
+template <typename D, typename K, typename V, typename A>
+TreeConstIterator<D, K, V, A>::TreeConstIterator(
+    const typename RedBlackTree<D, K, V, A>::Node* node,
+    const RedBlackTree<D, K, V, A>* rbtree_)
+    : TreeIterator<D, K, V, A>(
+          const_cast<typename RedBlackTree<D, K, V, A>::Node*>(node),
+          const_cast<RedBlackTree<D, K, V, A>*>(rbtree_)) {}
 
 /*
 *****************************
@@ -670,8 +734,8 @@ Print tree methods
 *****************************
 */
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::print_node(Node* node) {
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::print_node(Node* node) {
   if (node == nullptr || node->is_leaf) {
     printf("\x1b[34m");
     std::cout << "null";
@@ -687,8 +751,8 @@ void RedBlackTree<D, K, V>::print_node(Node* node) {
   }
 }
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::print_recursive(Node* root, int space) {
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::print_recursive(Node* root, int space) {
   constexpr int COUNT = 5;
   if (root == nullptr || root->is_leaf) {
     std::cout << "null tree" << std::endl;
@@ -708,8 +772,8 @@ void RedBlackTree<D, K, V>::print_recursive(Node* root, int space) {
   }
 }
 
-template <typename D, typename K, typename V>
-void RedBlackTree<D, K, V>::print_tree() {
+template <typename D, typename K, typename V, typename A>
+void RedBlackTree<D, K, V, A>::print_tree() {
   print_recursive(root_, 0);
 }
 }  // namespace s21
@@ -0,0 +1,215 @@
+#ifndef S21_RING_BUFFER_H
+#define S21_RING_BUFFER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_memory.h"
+
+namespace s21 {
+
+// ring_buffer<T> keeps its elements in one circular array whose capacity is
+// a power of two, so both ends grow and shrink in O(1) without touching the
+// allocator: a queue or stack in a steady state reuses the same slots
+// forever. A full buffer doubles, relocating the elements once.
+//
+// It provides the interface queue and stack expect from their Container:
+//   s21::queue<int, s21::ring_buffer<int>> tasks;
+// Growing invalidates iterators and references; pushing and popping at the
+// ends keeps references to the other elements valid.
+template <typename T>
+class ring_buffer {
+ public:
+  template <bool Const>
+  class basic_iterator;
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  ring_buffer() noexcept;             // default constructor
+  explicit ring_buffer(size_type n);  // creates n value-initialized elements
+  ring_buffer(std::initializer_list<value_type> const
+                  &items);        // initializer list constructor
+  ring_buffer(const ring_buffer &r);      // copy constructor
+  ring_buffer(ring_buffer &&r) noexcept;  // move constructor
+  ~ring_buffer();                         // destructor
+
+  ring_buffer &operator=(const ring_buffer &r);      // copy assignment
+  ring_buffer &operator=(ring_buffer &&r) noexcept;  // move assignment
+
+  reference operator[](size_type pos);  // access specified element
+  const_reference operator[](size_type pos) const;
+  reference at(size_type pos);  // access specified element with bounds
+                                // checking
+  const_reference at(size_type pos) const;
+  reference front();  // access the first element
+  reference back();   // access the last element
+  const_reference front() const;
+  const_reference back() const;
+
+  iterator begin() noexcept;  // returns an iterator to the beginning
+  iterator end() noexcept;    // returns an iterator to the end
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+
+  bool empty() const noexcept;         // checks whether the buffer is empty
+  size_type size() const noexcept;     // returns the number of elements
+  size_type capacity() const noexcept;  // returns the number of slots
+  size_type max_size() const noexcept;
+  void reserve(size_type size);  // makes room for size elements
+  void shrink_to_fit();  // reduces the capacity to the smallest power of two
+                         // that holds the elements
+
+  void clear() noexcept;                   // clears the contents
+  void push_back(const_reference value);   // adds an element to the end
+  void push_back(value_type &&value);      // moves an element to the end
+  void push_front(const_reference value);  // adds an element to the beginning
+  void push_front(value_type &&value);  // moves an element to the beginning
+  template <typename... Args>
+  reference emplace_back(Args &&...args);  // constructs an element at the end
+  template <typename... Args>
+  reference emplace_front(
+      Args &&...args);  // constructs an element at the beginning
+  void pop_back();      // removes the last element
+  void pop_front();     // removes the first element
+  void swap(ring_buffer &other) noexcept;  // swaps the contents
+
+  // random access iterator over the elements in logical order
+  template <bool Const>
+  class basic_iterator {
+    friend ring_buffer;
+    template <bool>
+    friend class basic_iterator;
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+    using buffer_pointer =
+        std::conditional_t<Const, const ring_buffer *, ring_buffer *>;
+
+    basic_iterator() = default;
+    template <bool Other, typename = std::enable_if_t<Const && !Other>>
+    basic_iterator(const basic_iterator<Other> &other) noexcept
+        : buffer_(other.buffer_), index_(other.index_) {}
+
+    reference operator*() const { return (*buffer_)[index_]; }
+    pointer operator->() const { return &(*buffer_)[index_]; }
+    reference operator[](difference_type n) const {
+      return (*buffer_)[index_ + n];
+    }
+    basic_iterator &operator++() noexcept {  // prefix
+      ++index_;
+      return *this;
+    }
+    basic_iterator operator++(int) noexcept {  // postfix
+      basic_iterator copy = *this;
+      ++index_;
+      return copy;
+    }
+    basic_iterator &operator--() noexcept {  // prefix
+      --index_;
+      return *this;
+    }
+    basic_iterator operator--(int) noexcept {  // postfix
+      basic_iterator copy = *this;
+      --index_;
+      return copy;
+    }
+    basic_iterator &operator+=(difference_type n) noexcept {
+      index_ += n;
+      return *this;
+    }
+    basic_iterator &operator-=(difference_type n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+    basic_iterator operator+(difference_type n) const noexcept {
+      return basic_iterator(buffer_, index_ + n);
+    }
+    friend basic_iterator operator+(difference_type n,
+                                    const basic_iterator &it) noexcept {
+      return it + n;
+    }
+    basic_iterator operator-(difference_type n) const noexcept {
+      return basic_iterator(buffer_, index_ - n);
+    }
+    difference_type operator-(const basic_iterator &other) const noexcept {
+      return static_cast<difference_type>(index_) -
+             static_cast<difference_type>(other.index_);
+    }
+    bool operator==(const basic_iterator &other) const noexcept {
+      return index_ == other.index_;
+    }
+    bool operator!=(const basic_iterator &other) const noexcept {
+      return index_ != other.index_;
+    }
+    bool operator<(const basic_iterator &other) const noexcept {
+      return index_ < other.index_;
+    }
+    bool operator>(const basic_iterator &other) const noexcept {
+      return index_ > other.index_;
+    }
+    bool operator<=(const basic_iterator &other) const noexcept {
+      return index_ <= other.index_;
+    }
+    bool operator>=(const basic_iterator &other) const noexcept {
+      return index_ >= other.index_;
+    }
+
+   private:
+    basic_iterator(buffer_pointer buffer, size_type index) noexcept
+        : buffer_(buffer), index_(index) {}
+
+    buffer_pointer buffer_ = nullptr;
+    size_type index_ = 0;  // logical position, 0 is the front
+  };
+
+ private:
+  static constexpr size_type kMinCapacity = 8;
+
+  static T *allocate(size_type n);  // raw storage for n elements
+  size_type slot(size_type pos) const noexcept {  // array index of element pos
+    return (head_ + pos) & (capacity_ - 1);
+  }
+  size_type next_capacity() const;  // capacity after the buffer fills up
+  void copy_from(const ring_buffer &r);  // copy-constructs the elements of r
+                                         // into an empty buffer with room
+  void relocate_to(T *dest) noexcept(
+      std::is_nothrow_move_constructible<T>::value);  // moves the elements to
+                                                      // dest[0, size_) in order
+  void reallocate(size_type new_capacity);  // moves the elements to a buffer
+                                            // of new_capacity slots
+  template <typename... Args>
+  void grow_and_emplace(bool front,
+                        Args &&...args);  // constructs an element at one end
+                                          // of a doubled buffer
+
+  T *data_;
+  size_type capacity_;  // 0 or a power of two
+  size_type head_;      // slot of the first element
+  size_type size_;
+};
+
+// a ring_buffer does not point into itself, so it can be moved to another
+// address with memcpy
+template <typename T>
+struct is_trivially_relocatable<ring_buffer<T>> : std::true_type {};
+
+}  // namespace s21
+
+#include "s21_ring_buffer.tpp"
+
+#endif
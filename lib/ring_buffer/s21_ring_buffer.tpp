@@ -0,0 +1,366 @@
+#ifndef S21_RING_BUFFER_TPP
+#define S21_RING_BUFFER_TPP
+
+#include "s21_ring_buffer.h"
+
+namespace s21 {
+
+// default constructor, allocates nothing
+template <typename T>
+ring_buffer<T>::ring_buffer() noexcept
+    : data_(nullptr), capacity_(0), head_(0), size_(0) {}
+
+// creates n value-initialized elements; the constructors below delegate to
+// the default one, so the destructor frees the buffer if they throw
+template <typename T>
+ring_buffer<T>::ring_buffer(size_type n) : ring_buffer() {
+  reserve(n);
+  for (; size_ < n; size_++) ::new (static_cast<void *>(data_ + size_)) T();
+}
+
+// initializer list constructor
+template <typename T>
+ring_buffer<T>::ring_buffer(std::initializer_list<value_type> const &items)
+    : ring_buffer() {
+  reserve(items.size());
+  size_ = s21::uninitialized_copy(items.begin(), items.end(), data_) - data_;
+}
+
+// copy constructor
+template <typename T>
+ring_buffer<T>::ring_buffer(const ring_buffer &r) : ring_buffer() {
+  reserve(r.size_);
+  copy_from(r);
+}
+
+// move constructor
+template <typename T>
+ring_buffer<T>::ring_buffer(ring_buffer &&r) noexcept
+    : data_(r.data_), capacity_(r.capacity_), head_(r.head_), size_(r.size_) {
+  r.data_ = nullptr;
+  r.capacity_ = 0;
+  r.head_ = 0;
+  r.size_ = 0;
+}
+
+// destructor
+template <typename T>
+ring_buffer<T>::~ring_buffer() {
+  clear();
+  deallocate_storage(data_);
+}
+
+// copy assignment
+template <typename T>
+ring_buffer<T> &ring_buffer<T>::operator=(const ring_buffer &r) {
+  if (this != &r) {
+    ring_buffer copy(r);
+    swap(copy);
+  }
+  return *this;
+}
+
+// move assignment
+template <typename T>
+ring_buffer<T> &ring_buffer<T>::operator=(ring_buffer &&r) noexcept {
+  if (this != &r) {
+    ring_buffer moved(std::move(r));
+    swap(moved);
+  }
+  return *this;
+}
+
+// access specified element
+template <typename T>
+typename ring_buffer<T>::reference ring_buffer<T>::operator[](size_type pos) {
+  return data_[slot(pos)];
+}
+
+template <typename T>
+typename ring_buffer<T>::const_reference ring_buffer<T>::operator[](
+    size_type pos) const {
+  return data_[slot(pos)];
+}
+
+// access specified element with bounds checking
+template <typename T>
+typename ring_buffer<T>::reference ring_buffer<T>::at(size_type pos) {
+  if (pos >= size_)
+    throw std::out_of_range("Error! Position of value is out of range");
+  return data_[slot(pos)];
+}
+
+template <typename T>
+typename ring_buffer<T>::const_reference ring_buffer<T>::at(
+    size_type pos) const {
+  return const_cast<ring_buffer *>(this)->at(pos);
+}
+
+// access the first element
+template <typename T>
+typename ring_buffer<T>::reference ring_buffer<T>::front() {
+  return data_[head_];
+}
+
+// access the last element
+template <typename T>
+typename ring_buffer<T>::reference ring_buffer<T>::back() {
+  return data_[slot(size_ - 1)];
+}
+
+template <typename T>
+typename ring_buffer<T>::const_reference ring_buffer<T>::front() const {
+  return data_[head_];
+}
+
+template <typename T>
+typename ring_buffer<T>::const_reference ring_buffer<T>::back() const {
+  return data_[slot(size_ - 1)];
+}
+
+// returns an iterator to the beginning
+template <typename T>
+typename ring_buffer<T>::iterator ring_buffer<T>::begin() noexcept {
+  return iterator(this, 0);
+}
+
+// returns an iterator to the end
+template <typename T>
+typename ring_buffer<T>::iterator ring_buffer<T>::end() noexcept {
+  return iterator(this, size_);
+}
+
+template <typename T>
+typename ring_buffer<T>::const_iterator ring_buffer<T>::begin()
+    const noexcept {
+  return const_iterator(this, 0);
+}
+
+template <typename T>
+typename ring_buffer<T>::const_iterator ring_buffer<T>::end() const noexcept {
+  return const_iterator(this, size_);
+}
+
+// checks whether the buffer is empty
+template <typename T>
+bool ring_buffer<T>::empty() const noexcept {
+  return size_ == 0;
+}
+
+// returns the number of elements
+template <typename T>
+typename ring_buffer<T>::size_type ring_buffer<T>::size() const noexcept {
+  return size_;
+}
+
+// returns the number of slots
+template <typename T>
+typename ring_buffer<T>::size_type ring_buffer<T>::capacity() const noexcept {
+  return capacity_;
+}
+
+// returns the maximum possible number of elements, a power of two
+template <typename T>
+typename ring_buffer<T>::size_type ring_buffer<T>::max_size() const noexcept {
+  size_type bits = (sizeof(void *) == 4) ? 31 : 63;
+  size_type limit = (static_cast<size_type>(1) << bits) / sizeof(value_type);
+  size_type max = 1;
+  while (max <= limit / 2) max *= 2;
+  return max;
+}
+
+// makes room for size elements, rounding the capacity up to a power of two
+template <typename T>
+void ring_buffer<T>::reserve(size_type size) {
+  if (size <= capacity_) return;
+  if (size > max_size())
+    throw std::length_error("Size of reserving storage is unavailable");
+  size_type new_capacity = kMinCapacity;
+  while (new_capacity < size) new_capacity *= 2;
+  reallocate(new_capacity);
+}
+
+// reduces the capacity to the smallest power of two that holds the elements
+template <typename T>
+void ring_buffer<T>::shrink_to_fit() {
+  size_type new_capacity = 0;
+  if (size_ > 0) {
+    new_capacity = kMinCapacity;
+    while (new_capacity < size_) new_capacity *= 2;
+  }
+  if (new_capacity < capacity_) reallocate(new_capacity);
+}
+
+// clears the contents, keeping the storage
+template <typename T>
+void ring_buffer<T>::clear() noexcept {
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    for (size_type i = 0; i < size_; i++) data_[slot(i)].~T();
+  }
+  head_ = 0;
+  size_ = 0;
+}
+
+// adds an element to the end
+template <typename T>
+void ring_buffer<T>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+// moves an element to the end
+template <typename T>
+void ring_buffer<T>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+// adds an element to the beginning
+template <typename T>
+void ring_buffer<T>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+// moves an element to the beginning
+template <typename T>
+void ring_buffer<T>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+// constructs an element at the end
+template <typename T>
+template <typename... Args>
+typename ring_buffer<T>::reference ring_buffer<T>::emplace_back(
+    Args &&...args) {
+  if (size_ == capacity_) {
+    grow_and_emplace(false, std::forward<Args>(args)...);
+  } else {
+    ::new (static_cast<void *>(data_ + slot(size_)))
+        T(std::forward<Args>(args)...);
+    size_++;
+  }
+  return back();
+}
+
+// constructs an element at the beginning
+template <typename T>
+template <typename... Args>
+typename ring_buffer<T>::reference ring_buffer<T>::emplace_front(
+    Args &&...args) {
+  if (size_ == capacity_) {
+    grow_and_emplace(true, std::forward<Args>(args)...);
+  } else {
+    size_type new_head = (head_ - 1) & (capacity_ - 1);
+    ::new (static_cast<void *>(data_ + new_head))
+        T(std::forward<Args>(args)...);
+    head_ = new_head;
+    size_++;
+  }
+  return front();
+}
+
+// removes the last element
+template <typename T>
+void ring_buffer<T>::pop_back() {
+  if (empty()) throw std::out_of_range("Error! ring_buffer is empty");
+  data_[slot(size_ - 1)].~T();
+  size_--;
+}
+
+// removes the first element
+template <typename T>
+void ring_buffer<T>::pop_front() {
+  if (empty()) throw std::out_of_range("Error! ring_buffer is empty");
+  data_[head_].~T();
+  head_ = (head_ + 1) & (capacity_ - 1);
+  size_--;
+}
+
+// swaps the contents
+template <typename T>
+void ring_buffer<T>::swap(ring_buffer &other) noexcept {
+  std::swap(data_, other.data_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+}
+
+// private
+
+// raw storage for n elements, aligned for T
+template <typename T>
+T *ring_buffer<T>::allocate(size_type n) {
+  return allocate_storage<T>(n);
+}
+
+// capacity after the buffer fills up: doubles
+template <typename T>
+typename ring_buffer<T>::size_type ring_buffer<T>::next_capacity() const {
+  if (capacity_ == 0) return kMinCapacity;
+  if (capacity_ >= max_size())
+    throw std::length_error("Size of reserving storage is unavailable");
+  return capacity_ * 2;
+}
+
+// copy-constructs the elements of r into this empty buffer, which has room
+// for them, as one contiguous run from slot 0
+template <typename T>
+void ring_buffer<T>::copy_from(const ring_buffer &r) {
+  size_type first = std::min(r.size_, r.capacity_ - r.head_);
+  T *end = s21::uninitialized_copy(r.data_ + r.head_,
+                                   r.data_ + r.head_ + first, data_);
+  try {
+    s21::uninitialized_copy(r.data_, r.data_ + (r.size_ - first), end);
+  } catch (...) {
+    s21::destroy(data_, end);
+    throw;
+  }
+  head_ = 0;
+  size_ = r.size_;
+}
+
+// moves the elements to dest[0, size_) in order; the source slots are left
+// without live objects
+template <typename T>
+void ring_buffer<T>::relocate_to(T *dest) noexcept(
+    std::is_nothrow_move_constructible<T>::value) {
+  if (size_ == 0) return;
+  size_type first = std::min(size_, capacity_ - head_);
+  s21::uninitialized_relocate(data_ + head_, data_ + head_ + first, dest);
+  s21::uninitialized_relocate(data_, data_ + (size_ - first), dest + first);
+}
+
+// moves the elements to a buffer of new_capacity slots
+template <typename T>
+void ring_buffer<T>::reallocate(size_type new_capacity) {
+  T *fresh = new_capacity ? allocate(new_capacity) : nullptr;
+  relocate_to(fresh);
+  deallocate_storage(data_);
+  data_ = fresh;
+  capacity_ = new_capacity;
+  head_ = 0;
+}
+
+// constructs an element at one end of a doubled buffer before the elements
+// move, so args may refer to an element of this buffer
+template <typename T>
+template <typename... Args>
+void ring_buffer<T>::grow_and_emplace(bool front, Args &&...args) {
+  size_type new_capacity = next_capacity();
+  T *fresh = allocate(new_capacity);
+  size_type target = front ? new_capacity - 1 : size_;
+  try {
+    ::new (static_cast<void *>(fresh + target)) T(std::forward<Args>(args)...);
+  } catch (...) {
+    deallocate_storage(fresh);
+    throw;
+  }
+  relocate_to(fresh);
+  deallocate_storage(data_);
+  data_ = fresh;
+  capacity_ = new_capacity;
+  head_ = front ? target : 0;
+  size_++;
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,138 @@
+#ifndef S21_FROZEN_TABLE_H
+#define S21_FROZEN_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "array/s21_array.h"
+
+namespace s21 {
+
+// Layouts of a frozen table:
+//   frozen_perfect_hash - a two-level perfect hash found at compile time:
+//                         a lookup is two hashes, two table loads and one
+//                         key comparison. Integer and enum keys only
+//   frozen_eytzinger    - the sorted keys in breadth-first (Eytzinger)
+//                         order: a lookup is a branch-free descent that
+//                         reads the levels front to back. Any key with a
+//                         constexpr operator<, std::string_view included
+struct frozen_perfect_hash {};
+struct frozen_eytzinger {};
+
+// perfect hashing for integer and enum keys, Eytzinger for everything else
+template <typename Key>
+using frozen_layout_for =
+    std::conditional_t<std::is_integral<Key>::value || std::is_enum<Key>::value,
+                       frozen_perfect_hash, frozen_eytzinger>;
+
+// number of slots of a perfect hash over n keys: a power of two no smaller
+// than n
+constexpr size_t frozen_slot_count(size_t n) noexcept {
+  size_t slots = 1;
+  while (slots < n) slots *= 2;
+  return slots;
+}
+
+// shift that keeps the top log2(slots) bits of a 64-bit product; one slot
+// keeps one bit, which the slot mask then clears
+constexpr unsigned frozen_slot_shift(size_t slots) noexcept {
+  unsigned shift = 64;
+  for (; slots > 1; slots /= 2) shift--;
+  return shift == 64 ? 63 : shift;
+}
+
+// element of a frozen_map; an aggregate, so it is built and assigned in
+// constant expressions, which std::pair is not in C++17
+template <typename Key, typename T>
+struct frozen_entry {
+  Key first;
+  T second;
+};
+
+// copies a built-in array into an s21::array, in constant expressions too
+template <typename T, size_t N>
+constexpr s21::array<T, N> frozen_array(const T (&values)[N]) {
+  s21::array<T, N> result{};
+  for (size_t i = 0; i < N; i++) result[i] = values[i];
+  return result;
+}
+
+// frozen_table<Value, Key, N, Layout> is the immutable lookup structure
+// behind frozen_map and frozen_set, built once from N values with distinct
+// keys. All storage is s21::array members sized from N, so a constexpr
+// table lives in read-only data with no heap and nothing to run at startup.
+// Building needs Value to be default constructible and, in a constant
+// expression, assignable there.
+template <typename Value, typename Key, size_t N, typename Layout>
+class frozen_table {
+  static_assert(N < (size_t{1} << 31), "Error! frozen table is too big");
+  static_assert(std::is_same<Layout, frozen_perfect_hash>::value ||
+                    std::is_same<Layout, frozen_eytzinger>::value,
+                "Error! Unknown frozen table layout");
+
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using const_reference = const Value &;
+  using size_type = size_t;
+  using const_iterator = const Value *;
+
+  constexpr explicit frozen_table(
+      const s21::array<Value, N> &values);  // builds the table; throws on a
+                                            // duplicate key, which fails a
+                                            // constant expression
+
+  constexpr const_iterator begin() const noexcept;  // values in storage order
+  constexpr const_iterator end() const noexcept;
+  static constexpr bool empty() noexcept;
+  static constexpr size_type size() noexcept;
+  static constexpr size_type max_size() noexcept;
+
+  constexpr const_iterator find(
+      const Key &key) const noexcept;  // the value with key, or end()
+  constexpr bool contains(const Key &key) const noexcept;
+
+  static constexpr const Key &key_of(const Value &value) noexcept;
+
+ private:
+  static constexpr bool hashed =
+      std::is_same<Layout, frozen_perfect_hash>::value;
+  // Eytzinger descents over string_view keys compare the first 8 bytes
+  // as one integer and only look at the strings when those are equal
+  static constexpr bool prefixed =
+      !hashed && std::is_same<Key, std::string_view>::value;
+  static constexpr size_t kSlots = hashed ? frozen_slot_count(N) : 0;
+  static constexpr unsigned kShift = frozen_slot_shift(kSlots);
+  static constexpr uint64_t kBucketMultiplier = 0x9e3779b97f4a7c15ULL;
+  static constexpr int32_t kMaxSeed = 1 << 16;  // tries per bucket
+
+  static constexpr uint64_t bits_of(const Key &key) noexcept;
+  static constexpr uint64_t multiplier(int32_t seed) noexcept;
+  static constexpr size_t slot_of(uint64_t bits,
+                                  uint64_t multiplier) noexcept;
+  static constexpr uint64_t prefix_of(const Key &key) noexcept;
+  constexpr bool node_less(size_t node, const Key &key,
+                           uint64_t prefix) const noexcept;
+  constexpr void sort() noexcept;  // heap sort of values_ by key
+  constexpr void sift_down(size_t root, size_t count) noexcept;
+  constexpr void build_hash();
+  constexpr size_t build_eytzinger(const s21::array<Value, N> &sorted,
+                                   size_t next,
+                                   size_t node) noexcept;  // in-order fill
+
+  s21::array<Value, N> values_;
+  // per bucket: 0 for an empty bucket, the seed of the second hash, or
+  // -1 - slot for a bucket with a single key
+  s21::array<int32_t, kSlots> displacement_;
+  s21::array<uint32_t, kSlots> slot_value_;  // index into values_ per slot
+  s21::array<uint64_t, prefixed ? N : 0> prefix_;  // per Eytzinger node
+};
+
+}  // namespace s21
+
+#include "s21_frozen_table.tpp"
+
+#endif
@@ -0,0 +1,277 @@
+#ifndef S21_FROZEN_TABLE_TPP
+#define S21_FROZEN_TABLE_TPP
+
+#include "s21_frozen_table.h"
+
+namespace s21 {
+
+// builds the table: sorts the values by key, rejects duplicates and lays
+// them out for the chosen layout
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr frozen_table<Value, Key, N, Layout>::frozen_table(
+    const s21::array<Value, N> &values)
+    : values_(values), displacement_{}, slot_value_{}, prefix_{} {
+  sort();
+  for (size_t i = 1; i < N; i++) {
+    if (!(key_of(values_[i - 1]) < key_of(values_[i])))
+      throw std::invalid_argument("Error! Duplicate key in frozen table");
+  }
+  if constexpr (hashed) {
+    build_hash();
+  } else {
+    s21::array<Value, N> sorted = values_;
+    build_eytzinger(sorted, 0, 1);
+    if constexpr (prefixed) {
+      for (size_t i = 0; i < N; i++) {
+        prefix_[i] = prefix_of(key_of(values_[i]));
+      }
+    }
+  }
+}
+
+// returns an iterator to the first value in storage order: ascending keys
+// for the perfect hash, breadth-first tree order for Eytzinger
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr typename frozen_table<Value, Key, N, Layout>::const_iterator
+frozen_table<Value, Key, N, Layout>::begin() const noexcept {
+  return values_.begin();
+}
+
+// returns an iterator past the last value
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr typename frozen_table<Value, Key, N, Layout>::const_iterator
+frozen_table<Value, Key, N, Layout>::end() const noexcept {
+  return values_.end();
+}
+
+// checks whether the table is empty
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr bool frozen_table<Value, Key, N, Layout>::empty() noexcept {
+  return N == 0;
+}
+
+// returns the number of values
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr typename frozen_table<Value, Key, N, Layout>::size_type
+frozen_table<Value, Key, N, Layout>::size() noexcept {
+  return N;
+}
+
+// returns the maximum possible number of values
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr typename frozen_table<Value, Key, N, Layout>::size_type
+frozen_table<Value, Key, N, Layout>::max_size() noexcept {
+  return N;
+}
+
+// finds the value with key. The perfect hash picks the slot of the key and
+// compares once; Eytzinger descends the implicit tree with the comparison
+// result as the child index, then undoes the right turns after the last left
+// one to land on the lower bound
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr typename frozen_table<Value, Key, N, Layout>::const_iterator
+frozen_table<Value, Key, N, Layout>::find(const Key &key) const noexcept {
+  if constexpr (N == 0) {
+    (void)key;
+    return end();
+  } else if constexpr (hashed) {
+    uint64_t bits = bits_of(key);
+    int32_t seed = displacement_[slot_of(bits, kBucketMultiplier)];
+    size_t hashed_slot = slot_of(bits, multiplier(seed));
+    size_t slot = seed < 0 ? static_cast<size_t>(-1 - seed) : hashed_slot;
+    const Value &value = values_[slot_value_[slot]];
+    return key_of(value) == key ? &value : end();
+  } else {
+    uint64_t prefix = prefix_of(key);
+    size_t node = 1;
+    while (node <= N) node = 2 * node + node_less(node, key, prefix);
+    node >>= __builtin_ctzll(~static_cast<unsigned long long>(node)) + 1;
+    if (node == 0) return end();
+    const Value &value = values_[node - 1];
+    return key < key_of(value) ? end() : &value;
+  }
+}
+
+// checks whether there is a value with key
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr bool frozen_table<Value, Key, N, Layout>::contains(
+    const Key &key) const noexcept {
+  return find(key) != end();
+}
+
+// the key of a value: the value itself in a set, first in a map
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr const Key &frozen_table<Value, Key, N, Layout>::key_of(
+    const Value &value) noexcept {
+  if constexpr (std::is_same<Value, Key>::value) {
+    return value;
+  } else {
+    return value.first;
+  }
+}
+
+// private
+
+// the key as 64 bits for multiplicative hashing
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr uint64_t frozen_table<Value, Key, N, Layout>::bits_of(
+    const Key &key) noexcept {
+  if constexpr (std::is_enum<Key>::value) {
+    return static_cast<uint64_t>(
+        static_cast<std::underlying_type_t<Key>>(key));
+  } else {
+    return static_cast<uint64_t>(key);
+  }
+}
+
+// odd multiplier of the second hash for a bucket seed
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr uint64_t frozen_table<Value, Key, N, Layout>::multiplier(
+    int32_t seed) noexcept {
+  return (static_cast<uint64_t>(seed) * 0xbf58476d1ce4e5b9ULL) | 1;
+}
+
+// multiply-shift hash: the top bits of the product select the slot
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr size_t frozen_table<Value, Key, N, Layout>::slot_of(
+    uint64_t bits, uint64_t multiplier) noexcept {
+  return static_cast<size_t>((bits * multiplier) >> kShift) & (kSlots - 1);
+}
+
+// the first 8 bytes of a string_view key, zero-padded and big-endian, so the
+// prefixes order like the strings; 0 for other keys
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr uint64_t frozen_table<Value, Key, N, Layout>::prefix_of(
+    const Key &key) noexcept {
+  uint64_t prefix = 0;
+  if constexpr (prefixed) {
+    for (size_t i = 0; i < 8; i++) {
+      prefix = (prefix << 8) |
+               (i < key.size() ? static_cast<unsigned char>(key[i]) : 0);
+    }
+  } else {
+    (void)key;
+  }
+  return prefix;
+}
+
+// checks whether the key of Eytzinger node is less than key
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr bool frozen_table<Value, Key, N, Layout>::node_less(
+    size_t node, const Key &key, uint64_t prefix) const noexcept {
+  if constexpr (prefixed) {
+    uint64_t node_prefix = prefix_[node - 1];
+    return node_prefix < prefix ||
+           (node_prefix == prefix && key_of(values_[node - 1]) < key);
+  } else {
+    (void)prefix;
+    return key_of(values_[node - 1]) < key;
+  }
+}
+
+// heap sort of values_ by key; assignments only, so it runs in constant
+// expressions
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr void frozen_table<Value, Key, N, Layout>::sort() noexcept {
+  for (size_t i = N / 2; i-- > 0;) sift_down(i, N);
+  for (size_t last = N; last-- > 1;) {
+    Value top = values_[0];
+    values_[0] = values_[last];
+    values_[last] = top;
+    sift_down(0, last);
+  }
+}
+
+// moves values_[root] down the max-heap of the first count values
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr void frozen_table<Value, Key, N, Layout>::sift_down(
+    size_t root, size_t count) noexcept {
+  for (size_t child = 2 * root + 1; child < count; child = 2 * root + 1) {
+    if (child + 1 < count &&
+        key_of(values_[child]) < key_of(values_[child + 1])) {
+      child++;
+    }
+    if (!(key_of(values_[root]) < key_of(values_[child]))) return;
+    Value parent = values_[root];
+    values_[root] = values_[child];
+    values_[child] = parent;
+    root = child;
+  }
+}
+
+// Finds the perfect hash, like CHD: the first hash splits the keys into
+// kSlots buckets; from the largest bucket down, the second hash is tried
+// with seeds 1, 2, ... until every key of the bucket lands in a free slot.
+// Buckets of one key skip the search and take a free slot directly.
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr void frozen_table<Value, Key, N, Layout>::build_hash() {
+  // values grouped by bucket with a counting sort
+  s21::array<uint32_t, kSlots + 1> start{};
+  for (size_t i = 0; i < N; i++) {
+    start[slot_of(bits_of(key_of(values_[i])), kBucketMultiplier) + 1]++;
+  }
+  size_t largest = 0;
+  for (size_t b = 0; b < kSlots; b++) {
+    largest = start[b + 1] > largest ? start[b + 1] : largest;
+    start[b + 1] += start[b];
+  }
+  s21::array<uint32_t, N> order{};
+  s21::array<uint32_t, kSlots> filled{};
+  for (size_t i = 0; i < N; i++) {
+    size_t b = slot_of(bits_of(key_of(values_[i])), kBucketMultiplier);
+    order[start[b] + filled[b]++] = static_cast<uint32_t>(i);
+  }
+
+  s21::array<bool, kSlots> used{};
+  s21::array<size_t, N> slots{};
+  for (size_t count = largest; count >= 2; count--) {
+    for (size_t b = 0; b < kSlots; b++) {
+      if (start[b + 1] - start[b] != count) continue;
+      for (int32_t seed = 1;; seed++) {
+        if (seed > kMaxSeed)
+          throw std::length_error("Error! No perfect hash for frozen table");
+        size_t placed = 0;
+        for (; placed < count; placed++) {
+          const Key &key = key_of(values_[order[start[b] + placed]]);
+          size_t slot = slot_of(bits_of(key), multiplier(seed));
+          if (used[slot]) break;
+          used[slot] = true;
+          slots[placed] = slot;
+        }
+        if (placed == count) {
+          displacement_[b] = seed;
+          for (size_t j = 0; j < count; j++) {
+            slot_value_[slots[j]] = order[start[b] + j];
+          }
+          break;
+        }
+        for (size_t j = 0; j < placed; j++) used[slots[j]] = false;
+      }
+    }
+  }
+
+  size_t free_slot = 0;
+  for (size_t b = 0; b < kSlots; b++) {
+    if (start[b + 1] - start[b] != 1) continue;
+    while (used[free_slot]) free_slot++;
+    used[free_slot] = true;
+    displacement_[b] = -1 - static_cast<int32_t>(free_slot);
+    slot_value_[free_slot] = order[start[b]];
+  }
+}
+
+// stores sorted[next, ...) into the subtree of node in order: node k has its
+// children at 2k and 2k + 1 and lives at values_[k - 1]. Returns the index
+// of the first sorted value not placed
+template <typename Value, typename Key, size_t N, typename Layout>
+constexpr size_t frozen_table<Value, Key, N, Layout>::build_eytzinger(
+    const s21::array<Value, N> &sorted, size_t next, size_t node) noexcept {
+  if (node > N) return next;
+  next = build_eytzinger(sorted, next, 2 * node);
+  values_[node - 1] = sorted[next++];
+  return build_eytzinger(sorted, next, 2 * node + 1);
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef S21_MEMORY_H
+#define S21_MEMORY_H
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// is_trivially_relocatable<T> tells containers that an object of type T can
+// be moved to a new address with memcpy, leaving the source storage dead
+// without running its destructor. Every trivially copyable type qualifies.
+// Types that own resources through a single pointer (unique_ptr wrappers,
+// handles) can opt in with a specialization:
+//
+//   template <>
+//   struct s21::is_trivially_relocatable<MyHandle> : std::true_type {};
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T1, typename T2>
+struct is_trivially_relocatable<std::pair<T1, T2>>
+    : std::integral_constant<bool, is_trivially_relocatable<T1>::value &&
+                                       is_trivially_relocatable<T2>::value> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+// is_forward_iterator<It> is true when It declares a forward (or stronger)
+// iterator category, so a range can be measured before it is consumed.
+// Iterators without std::iterator_traits are treated as single-pass.
+template <typename It, typename = void>
+struct is_forward_iterator : std::false_type {};
+
+template <typename It>
+struct is_forward_iterator<
+    It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::is_base_of<std::forward_iterator_tag,
+                      typename std::iterator_traits<It>::iterator_category> {};
+
+// is_contiguous_container<C> is true when C keeps its elements in one array
+// and exposes them as plain pointers (vector, array, small_vector), so
+// algorithms can work on [c.begin(), c.end()) directly
+template <typename C, typename = void>
+struct is_contiguous_container : std::false_type {};
+
+template <typename C>
+struct is_contiguous_container<
+    C, std::void_t<typename C::value_type, typename C::const_iterator>>
+    : std::is_same<typename C::const_iterator,
+                   const typename C::value_type *> {};
+
+// cache_line_size separates data written by different threads: two atomics
+// at least this far apart never share a line, so one thread's stores do not
+// evict the line the other thread reads
+inline constexpr size_t cache_line_size = 64;
+
+// allocator_holder<Alloc> stores the allocator of a container. A stateless
+// allocator such as std::allocator is kept as an empty base, so it adds
+// nothing to the size of the container; a stateful one (a pmr allocator, an
+// arena handle) is a member
+template <typename Alloc, bool Empty = std::is_empty<Alloc>::value &&
+                                       !std::is_final<Alloc>::value>
+class allocator_holder : private Alloc {
+ public:
+  allocator_holder() = default;
+  explicit allocator_holder(const Alloc &alloc) noexcept : Alloc(alloc) {}
+
+  Alloc &allocator() noexcept { return *this; }
+  const Alloc &allocator() const noexcept { return *this; }
+};
+
+template <typename Alloc>
+class allocator_holder<Alloc, false> {
+ public:
+  allocator_holder() = default;
+  explicit allocator_holder(const Alloc &alloc) noexcept : alloc_(alloc) {}
+
+  Alloc &allocator() noexcept { return alloc_; }
+  const Alloc &allocator() const noexcept { return alloc_; }
+
+ private:
+  Alloc alloc_{};
+};
+
+// checks whether memory from one allocator can be released by the other, so
+// a container may take over the nodes or buffer of another one
+template <typename Alloc>
+bool allocators_equal(const Alloc &a, const Alloc &b) noexcept {
+  return std::allocator_traits<Alloc>::is_always_equal::value || a == b;
+}
+
+// true when move assignment always hands the nodes or buffer over to the
+// target: the allocator moves along with them or any copy of it can free
+// them. Otherwise unequal allocators force an element-wise move
+template <typename Alloc>
+inline constexpr bool allocator_moves_storage_v =
+    std::allocator_traits<
+        Alloc>::propagate_on_container_move_assignment::value ||
+    std::allocator_traits<Alloc>::is_always_equal::value;
+
+template <typename Node, typename Alloc, typename... Args>
+Node *allocate_node(
+    Alloc &alloc,
+    Args &&...args);  // takes storage for one Node from alloc rebound to Node
+                      // and builds the node from args in it
+
+template <typename Node, typename Alloc>
+void deallocate_node(Alloc &alloc,
+                     Node *node) noexcept;  // destroys node and returns its
+                                            // storage to alloc
+
+template <typename T>
+T *allocate_storage(size_t n);  // raw storage for n elements, aligned for T
+                                // even above the default new alignment
+
+template <typename T>
+void deallocate_storage(T *p) noexcept;  // frees storage of allocate_storage
+
+template <typename T>
+void destroy(T *first, T *last) noexcept;  // calls destructors of [first, last)
+
+template <typename T>
+void uninitialized_relocate(
+    T *first, T *last,
+    T *dest);  // moves [first, last) into raw storage at dest and destroys the
+               // source, with memcpy for trivially relocatable T
+
+template <typename T>
+void relocate_forward(T *first, T *last,
+                      T *dest);  // relocates [first, last) to the lower
+                                 // address dest inside the same buffer
+
+template <typename T>
+void relocate_backward(T *first, T *last,
+                       T *dest_last);  // relocates [first, last) so that it
+                                       // ends at the higher address dest_last
+
+template <typename T>
+T *uninitialized_copy(const T *first, const T *last,
+                      T *dest);  // copy-constructs [first, last) into raw
+                                 // storage at dest, with memcpy when trivial
+
+}  // namespace s21
+
+#include "s21_memory.tpp"
+
+#endif
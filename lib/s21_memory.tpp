@@ -0,0 +1,145 @@
+#ifndef S21_MEMORY_TPP
+#define S21_MEMORY_TPP
+
+#include "s21_memory.h"
+
+namespace s21 {
+
+// takes storage for one Node from alloc rebound to Node and builds the node
+// from args in it; the storage goes back if the node constructor throws
+template <typename Node, typename Alloc, typename... Args>
+Node *allocate_node(Alloc &alloc, Args &&...args) {
+  using traits =
+      typename std::allocator_traits<Alloc>::template rebind_traits<Node>;
+  typename traits::allocator_type node_alloc(alloc);
+  Node *node = traits::allocate(node_alloc, 1);
+  try {
+    ::new (static_cast<void *>(node)) Node{std::forward<Args>(args)...};
+  } catch (...) {
+    traits::deallocate(node_alloc, node, 1);
+    throw;
+  }
+  return node;
+}
+
+// destroys node and returns its storage to alloc rebound to Node
+template <typename Node, typename Alloc>
+void deallocate_node(Alloc &alloc, Node *node) noexcept {
+  using traits =
+      typename std::allocator_traits<Alloc>::template rebind_traits<Node>;
+  typename traits::allocator_type node_alloc(alloc);
+  node->~Node();
+  traits::deallocate(node_alloc, node, 1);
+}
+
+// raw storage for n elements; over-aligned T goes through the aligned
+// operator new, which plain operator new does not honour
+template <typename T>
+T *allocate_storage(size_t n) {
+  if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    return static_cast<T *>(
+        ::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+  } else {
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+}
+
+// frees storage of allocate_storage<T>, with the matching operator delete
+template <typename T>
+void deallocate_storage(T *p) noexcept {
+  if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    ::operator delete(p, std::align_val_t{alignof(T)});
+  } else {
+    ::operator delete(p);
+  }
+}
+
+// calls destructors of [first, last)
+template <typename T>
+void destroy(T *first, T *last) noexcept {
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    for (; first != last; ++first) first->~T();
+  }
+}
+
+// moves [first, last) into raw storage at dest and destroys the source
+template <typename T>
+void uninitialized_relocate(T *first, T *last, T *dest) {
+  if constexpr (is_trivially_relocatable<T>::value) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first),
+                  (last - first) * sizeof(T));
+    }
+  } else {
+    for (; first != last; ++first, ++dest) {
+      ::new (static_cast<void *>(dest)) T(std::move_if_noexcept(*first));
+      first->~T();
+    }
+  }
+}
+
+// relocates [first, last) to the lower address dest inside the same buffer;
+// the ranges may overlap and [dest, first) must not hold live objects
+template <typename T>
+void relocate_forward(T *first, T *last, T *dest) {
+  if constexpr (is_trivially_relocatable<T>::value) {
+    if (first != last) {
+      std::memmove(static_cast<void *>(dest), static_cast<const void *>(first),
+                   (last - first) * sizeof(T));
+    }
+  } else {
+    for (; first != last; ++first, ++dest) {
+      ::new (static_cast<void *>(dest)) T(std::move(*first));
+      first->~T();
+    }
+  }
+}
+
+// relocates [first, last) so that it ends at the higher address dest_last;
+// the ranges may overlap and [last, dest_last) must not hold live objects
+template <typename T>
+void relocate_backward(T *first, T *last, T *dest_last) {
+  if constexpr (is_trivially_relocatable<T>::value) {
+    if (first != last) {
+      std::memmove(static_cast<void *>(dest_last - (last - first)),
+                   static_cast<const void *>(first),
+                   (last - first) * sizeof(T));
+    }
+  } else {
+    while (last != first) {
+      --last;
+      --dest_last;
+      ::new (static_cast<void *>(dest_last)) T(std::move(*last));
+      last->~T();
+    }
+  }
+}
+
+// copy-constructs [first, last) into raw storage at dest and returns the end
+// of the constructed range; on exception the constructed prefix is destroyed
+template <typename T>
+T *uninitialized_copy(const T *first, const T *last, T *dest) {
+  if constexpr (std::is_trivially_copy_constructible<T>::value &&
+                std::is_trivially_destructible<T>::value) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(dest), static_cast<const void *>(first),
+                  (last - first) * sizeof(T));
+    }
+    return dest + (last - first);
+  } else {
+    T *current = dest;
+    try {
+      for (; first != last; ++first, ++current) {
+        ::new (static_cast<void *>(current)) T(*first);
+      }
+    } catch (...) {
+      destroy(dest, current);
+      throw;
+    }
+    return current;
+  }
+}
+
+}  // namespace s21
+
+#endif
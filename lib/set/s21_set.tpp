@@ -5,77 +5,84 @@
 
 namespace s21 {
 
-template <typename Key>
-set<Key>::set(std::initializer_list<value_type> const& items) : tree_() {
+template <typename Key, typename Allocator>
+set<Key, Allocator>::set(std::initializer_list<value_type> const& items,
+                         const Allocator& alloc)
+    : tree_(alloc) {
   for (auto iter = items.begin(); iter != items.end(); iter++) {
     tree_.insert(*iter);
   }
 }
 
-template <typename Key>
-set<Key>::set(set&& s) {
-  tree_ = std::move(s.tree_);
-}
+template <typename Key, typename Allocator>
+set<Key, Allocator>::set(set&& s) : tree_(std::move(s.tree_)) {}
 
-template <typename Key>
-set<Key>& set<Key>::operator=(set&& s) {
+template <typename Key, typename Allocator>
+set<Key, Allocator>& set<Key, Allocator>::operator=(set&& s) {
   tree_ = std::move(s.tree_);
   return *this;
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::begin() {
+template <typename Key, typename Allocator>
+typename set<Key, Allocator>::allocator_type
+set<Key, Allocator>::get_allocator() const noexcept {
+  return tree_.get_allocator();
+}
+
+template <typename Key, typename Allocator>
+typename set<Key, Allocator>::iterator set<Key, Allocator>::begin() {
   return tree_.begin();
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::end() {
+template <typename Key, typename Allocator>
+typename set<Key, Allocator>::iterator set<Key, Allocator>::end() {
   return tree_.end();
 }
 
-template <typename Key>
-bool set<Key>::empty() {
+template <typename Key, typename Allocator>
+bool set<Key, Allocator>::empty() {
   return tree_.empty();
 }
 
-template <typename Key>
-typename set<Key>::size_type set<Key>::size() {
+template <typename Key, typename Allocator>
+typename set<Key, Allocator>::size_type set<Key, Allocator>::size() {
   return tree_.size();
 }
 
-template <typename Key>
-typename set<Key>::size_type set<Key>::max_size() {
+template <typename Key, typename Allocator>
+typename set<Key, Allocator>::size_type set<Key, Allocator>::max_size() {
   return tree_.max_size();
 }
 
-template <typename Key>
-void set<Key>::clear() {
+template <typename Key, typename Allocator>
+void set<Key, Allocator>::clear() {
   tree_.clear();
 }
 
-template <typename Key>
-std::pair<typename set<Key>::iterator, bool> set<Key>::insert(
-    const value_type& value) {
+template <typename Key, typename Allocator>
+std::pair<typename set<Key, Allocator>::iterator, bool>
+set<Key, Allocator>::insert(const value_type& value) {
   return tree_.insert(value);
 }
 
-template <typename Key>
-void set<Key>::erase(iterator pos) {
+template <typename Key, typename Allocator>
+void set<Key, Allocator>::erase(iterator pos) {
   tree_.erase(pos);
 }
 
-template <typename Key>
-void set<Key>::swap(set& other) {
+template <typename Key, typename Allocator>
+void set<Key, Allocator>::swap(set& other) {
   tree_.swap(other.tree_);
 }
 
-template <typename Key>
-void set<Key>::merge(set& other) {
+template <typename Key, typename Allocator>
+void set<Key, Allocator>::merge(set& other) {
   tree_.merge(other.tree_);
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::find(const Key& key) {
+template <typename Key, typename Allocator>
+typename set<Key, Allocator>::iterator
+set<Key, Allocator>::find(const Key& key) {
   for (auto iter = tree_.begin(); iter != tree_.end(); iter++) {
     if (*iter == key) {
       return iter;
@@ -84,15 +91,15 @@ typename set<Key>::iterator set<Key>::find(const Key& key) {
   return tree_.end();
 }
 
-template <typename Key>
-bool set<Key>::contains(const Key& key) {
+template <typename Key, typename Allocator>
+bool set<Key, Allocator>::contains(const Key& key) {
   return tree_.contains(key);
 }
 
-template <typename Key>
+template <typename Key, typename Allocator>
 template <typename... Args>
-s21::vector<std::pair<typename set<Key>::iterator, bool>> set<Key>::insert_many(
-    Args&&... args) {
+s21::vector<std::pair<typename set<Key, Allocator>::iterator, bool>>
+set<Key, Allocator>::insert_many(Args&&... args) {
   return tree_.insert_many(std::forward<Args>(args)...);
 }
 
@@ -0,0 +1,152 @@
+#ifndef S21_SMALL_VECTOR_H
+#define S21_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_memory.h"
+
+namespace s21 {
+
+// small_vector<T, N> is a vector that keeps up to N elements inside the
+// object itself and moves them to the heap only when it grows past N
+template <typename T, size_t N>
+class small_vector {
+  static_assert(N > 0, "small_vector needs room for at least one element");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  small_vector();                      // default constructor
+  explicit small_vector(size_type n);  // parameterized constructor
+  explicit small_vector(std::initializer_list<value_type> const
+                            &items);  // initializer list constructor
+  small_vector(const small_vector &v);  // copy constructor
+  small_vector(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible<T>::value);  // move constructor
+  ~small_vector();                                    // destructor
+
+  small_vector &operator=(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible<
+          T>::value);  // assignment operator overload for moving object
+  reference operator[](size_type pos);  // access specified element
+
+  reference at(size_type pos);  // access specified element with bounds checking
+
+  iterator data() noexcept;  // direct access to the underlying array
+  void swap(small_vector &other) noexcept(
+      std::is_nothrow_move_constructible<T>::value);  // swaps the contents
+  size_type capacity()
+      const noexcept;  // returns the number of elements that can be held in
+                       // currently allocated storage
+  void reserve(size_type size);  // allocate storage of size elements and moves
+                                 // current elements there
+  void shrink_to_fit();  // reduces memory usage by freeing unused memory,
+                         // returning to the inline buffer when possible
+  const_reference back() const;   // access the last element
+  const_reference front() const;  // access the first element
+  size_type max_size() const noexcept;
+  size_type size() const noexcept;  // returns the number of elements
+  void pop_back();                  // removes the last element
+  bool is_small() const noexcept;   // checks whether the elements are inline
+
+  void clear();               // clears the contents
+  iterator begin() noexcept;  // returns an iterator to the beginning
+  iterator end() noexcept;    // returns an iterator to the end
+  iterator insert(
+      iterator pos,
+      const_reference value);  // inserts elements into concrete pos and returns
+                               // the iterator that points to the new element
+  iterator insert(iterator pos,
+                  value_type &&value);  // moves value into concrete pos
+  iterator insert(const_iterator pos, size_type count,
+                  const_reference value);  // inserts count copies of value
+                                           // before pos
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  iterator insert(const_iterator pos, InputIt first,
+                  InputIt last);  // inserts elements from range [first, last)
+                                  // before pos
+  template <typename Range>
+  void append_range(Range &&range);  // appends elements of range to the end
+  void assign(size_type count,
+              const_reference value);  // replaces the contents with count
+                                       // copies of value
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  void assign(InputIt first, InputIt last);  // replaces the contents with
+                                             // elements from [first, last)
+  void resize(size_type count);  // changes the number of elements stored
+  void resize(size_type count,
+              const_reference value);  // changes the number of elements
+                                       // stored, appending copies of value
+  void erase(iterator pos);            // erases element at pos
+  void push_back(const_reference value);  // adds an element to the end
+  void push_back(value_type &&value);     // moves an element to the end
+  bool empty() const noexcept;  // checks whether the container is empty
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos,
+                   Args &&...args);  // constructs an element in place directly
+                                     // before pos
+  template <typename... Args>
+  reference emplace_back(
+      Args &&...args);  // constructs an element in place at the end
+
+  // additional
+  const_iterator begin()
+      const noexcept;  // returns a const iterator to the beginning
+  const_iterator end() const noexcept;  // returns a const iterator to the end
+
+  // bonus part
+  template <typename... Args>
+  iterator insert_many(const_iterator pos,
+                       Args &&...args);  // Inserts new elements into the
+                                         // container directly before pos
+
+  template <typename... Args>
+  void insert_many_back(
+      Args &&...args);  // Appends new elements to the end of the container
+
+ private:
+  T *inline_data() noexcept;  // start of the inline buffer
+  static T *allocate(size_type n);          // heap storage for n elements
+  void release() noexcept;  // destroys elements and frees heap storage
+  void steal(small_vector &v) noexcept(
+      std::is_nothrow_move_constructible<T>::value);  // takes the contents of
+                                                      // an empty-handed v
+  void reallocate(size_type new_capacity);  // moves elements to storage of
+                                            // new_capacity elements
+  size_type next_capacity(
+      size_type required) const;  // capacity for growing to hold required
+                                  // elements
+  T *open_gap(size_type index,
+              size_type count);  // turns [index, index + count) into raw
+                                 // storage with one tail shift
+  void close_gap(size_type index,
+                 size_type count) noexcept;  // undoes open_gap
+
+  T *data_;
+  size_type capacity_;
+  size_type size_;
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+};
+
+}  // namespace s21
+
+#include "s21_small_vector.tpp"
+
+#endif
@@ -0,0 +1,551 @@
+#ifndef S21_SMALL_VECTOR_TPP
+#define S21_SMALL_VECTOR_TPP
+
+#include "s21_small_vector.h"
+
+namespace s21 {
+
+// default constructor
+template <typename T, size_t N>
+small_vector<T, N>::small_vector()
+    : data_(inline_data()), capacity_(N), size_(0) {}
+
+// parameterized constructor
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(size_type n) : small_vector() {
+  resize(n);
+}
+
+// initializer list constructor
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(std::initializer_list<value_type> const &items)
+    : small_vector() {
+  reserve(items.size());
+  size_ = s21::uninitialized_copy(items.begin(), items.end(), data_) - data_;
+}
+
+// copy constructor
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(const small_vector &v) : small_vector() {
+  reserve(v.size_);
+  size_ = s21::uninitialized_copy(v.data_, v.data_ + v.size_, data_) - data_;
+}
+
+// move constructor
+template <typename T, size_t N>
+small_vector<T, N>::small_vector(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible<T>::value)
+    : small_vector() {
+  steal(v);
+}
+
+// destructor
+template <typename T, size_t N>
+small_vector<T, N>::~small_vector() {
+  release();
+}
+
+// assignment operator overload for moving object
+template <typename T, size_t N>
+small_vector<T, N> &small_vector<T, N>::operator=(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible<T>::value) {
+  if (this != &v) {
+    release();
+    steal(v);
+  }
+  return *this;
+}
+
+// access specified element
+template <typename T, size_t N>
+typename small_vector<T, N>::reference small_vector<T, N>::operator[](
+    size_type pos) {
+  return data_[pos];
+}
+
+// access specified element with bounds checking
+template <typename T, size_t N>
+typename small_vector<T, N>::reference small_vector<T, N>::at(size_type pos) {
+  if (pos >= size_)
+    throw std::out_of_range("Error! Position of value is out of range");
+  return data_[pos];
+}
+
+// direct access to the underlying array
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::data() noexcept {
+  return (size() == 0) ? nullptr : data_;
+}
+
+// swaps the contents; inline elements are moved, heap buffers are exchanged
+template <typename T, size_t N>
+void small_vector<T, N>::swap(small_vector &other) noexcept(
+    std::is_nothrow_move_constructible<T>::value) {
+  if (this == &other) return;
+  if (!is_small() && !other.is_small()) {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  } else {
+    small_vector tmp(std::move(other));
+    other.steal(*this);
+    steal(tmp);
+  }
+}
+
+// returns the number of elements that can be held in currently allocated
+// storage
+template <typename T, size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::capacity()
+    const noexcept {
+  return capacity_;
+}
+
+// allocate storage of size elements and moves current elements there
+template <typename T, size_t N>
+void small_vector<T, N>::reserve(size_type size) {
+  if (size > max_size())
+    throw std::length_error("Size of reserving storage is unavailable");
+  if (size > capacity_) reallocate(size);
+}
+
+// reduces memory usage by freeing unused memory, returning to the inline
+// buffer when possible
+template <typename T, size_t N>
+void small_vector<T, N>::shrink_to_fit() {
+  if (!is_small() && capacity_ > size_) reallocate(std::max(size_, N));
+}
+
+// access the last element
+template <typename T, size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::back() const {
+  return *(end() - 1);
+}
+
+// access the first element
+template <typename T, size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::front()
+    const {
+  return *begin();
+}
+
+// returns the maximum possible number of elements
+template <typename T, size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::max_size()
+    const noexcept {
+  size_type bits = (sizeof(void *) == 4) ? 31 : 63;
+  return (static_cast<size_type>(1) << bits) / sizeof(value_type) - 1;
+}
+
+// returns the number of elements
+template <typename T, size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::size()
+    const noexcept {
+  return size_;
+}
+
+// removes the last element
+template <typename T, size_t N>
+void small_vector<T, N>::pop_back() {
+  data_[size_ - 1].~T();
+  size_--;
+}
+
+// checks whether the elements are stored in the inline buffer
+template <typename T, size_t N>
+bool small_vector<T, N>::is_small() const noexcept {
+  return data_ == reinterpret_cast<const T *>(buffer_);
+}
+
+// clears the contents
+template <typename T, size_t N>
+void small_vector<T, N>::clear() {
+  s21::destroy(data_, data_ + size_);
+  size_ = 0;
+}
+
+// returns an iterator to the beginning
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::begin() noexcept {
+  return data_;
+}
+
+// returns a const iterator to the beginning
+template <typename T, size_t N>
+typename small_vector<T, N>::const_iterator small_vector<T, N>::begin()
+    const noexcept {
+  return data_;
+}
+
+// returns an iterator to the end
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::end() noexcept {
+  return data_ + size_;
+}
+
+// returns a const iterator to the end
+template <typename T, size_t N>
+typename small_vector<T, N>::const_iterator small_vector<T, N>::end()
+    const noexcept {
+  return data_ + size_;
+}
+
+// inserts elements into concrete pos and returns the iterator that points to
+// the new element
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+// moves value into concrete pos and returns the iterator that points to the
+// new element
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+// inserts count copies of value before pos and returns the iterator that
+// points to the first inserted element
+template <typename T, size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    const_iterator pos, size_type count, const_reference value) {
+  size_type index = pos - begin();
+  if (count > 0) {
+    if (&value >= data_ && &value < data_ + size_) {
+      // value lives in this vector and would move together with the tail
+      value_type copy(value);
+      return insert(pos, count, copy);
+    }
+    T *gap = open_gap(index, count);
+    try {
+      std::uninitialized_fill_n(gap, count, value);
+    } catch (...) {
+      close_gap(index, count);
+      throw;
+    }
+    size_ += count;
+  }
+  return begin() + index;
+}
+
+// inserts elements from range [first, last) before pos and returns the
+// iterator that points to the first inserted element; the range must not
+// point into this vector
+template <typename T, size_t N>
+template <typename InputIt, typename>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
+  size_type index = pos - begin();
+  if constexpr (is_forward_iterator<InputIt>::value) {
+    size_type count = std::distance(first, last);
+    if (count > 0) {
+      T *gap = open_gap(index, count);
+      try {
+        std::uninitialized_copy(first, last, gap);
+      } catch (...) {
+        close_gap(index, count);
+        throw;
+      }
+      size_ += count;
+    }
+  } else {
+    // a single-pass range can't be measured: append it, then rotate in place
+    size_type old_size = size_;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(data_ + index, data_ + old_size, data_ + size_);
+  }
+  return begin() + index;
+}
+
+// appends elements of range to the end
+template <typename T, size_t N>
+template <typename Range>
+void small_vector<T, N>::append_range(Range &&range) {
+  insert(end(), std::begin(range), std::end(range));
+}
+
+// replaces the contents with count copies of value
+template <typename T, size_t N>
+void small_vector<T, N>::assign(size_type count, const_reference value) {
+  if (count > capacity_) {
+    small_vector tmp;
+    tmp.reserve(count);
+    std::uninitialized_fill_n(tmp.data_, count, value);
+    tmp.size_ = count;
+    release();
+    steal(tmp);
+  } else {
+    std::fill_n(data_, std::min(count, size_), value);
+    if (count > size_) {
+      std::uninitialized_fill_n(data_ + size_, count - size_, value);
+    } else {
+      s21::destroy(data_ + count, data_ + size_);
+    }
+    size_ = count;
+  }
+}
+
+// replaces the contents with elements from [first, last)
+template <typename T, size_t N>
+template <typename InputIt, typename>
+void small_vector<T, N>::assign(InputIt first, InputIt last) {
+  if constexpr (is_forward_iterator<InputIt>::value) {
+    size_type count = std::distance(first, last);
+    if (count > capacity_) {
+      small_vector tmp;
+      tmp.reserve(count);
+      tmp.size_ = std::uninitialized_copy(first, last, tmp.data_) - tmp.data_;
+      release();
+      steal(tmp);
+    } else if (count > size_) {
+      InputIt middle = std::next(first, size_);
+      std::copy(first, middle, data_);
+      std::uninitialized_copy(middle, last, data_ + size_);
+      size_ = count;
+    } else {
+      std::copy(first, last, data_);
+      s21::destroy(data_ + count, data_ + size_);
+      size_ = count;
+    }
+  } else {
+    clear();
+    for (; first != last; ++first) emplace_back(*first);
+  }
+}
+
+// changes the number of elements stored, value-initializing new elements
+template <typename T, size_t N>
+void small_vector<T, N>::resize(size_type count) {
+  if (count > capacity_) reallocate(next_capacity(count));
+  for (; size_ < count; size_++) ::new (static_cast<void *>(data_ + size_)) T();
+  if (count < size_) {
+    s21::destroy(data_ + count, data_ + size_);
+    size_ = count;
+  }
+}
+
+// changes the number of elements stored, appending copies of value
+template <typename T, size_t N>
+void small_vector<T, N>::resize(size_type count, const_reference value) {
+  if (count > size_) {
+    insert(end(), count - size_, value);
+  } else {
+    s21::destroy(data_ + count, data_ + size_);
+    size_ = count;
+  }
+}
+
+// erases element at pos
+template <typename T, size_t N>
+void small_vector<T, N>::erase(iterator pos) {
+  size_type index = pos - begin();
+  if constexpr (is_trivially_relocatable<T>::value) {
+    data_[index].~T();
+    s21::relocate_forward(data_ + index + 1, data_ + size_, data_ + index);
+  } else {
+    std::move(data_ + index + 1, data_ + size_, data_ + index);
+    data_[size_ - 1].~T();
+  }
+  size_--;
+}
+
+// adds an element to the end
+template <typename T, size_t N>
+void small_vector<T, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+// moves an element to the end
+template <typename T, size_t N>
+void small_vector<T, N>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+// checks whether the container is empty
+template <typename T, size_t N>
+bool small_vector<T, N>::empty() const noexcept {
+  return size_ == 0;
+}
+
+// constructs an element in place directly before pos and returns the iterator
+// that points to the new element
+template <typename T, size_t N>
+template <typename... Args>
+typename small_vector<T, N>::iterator small_vector<T, N>::emplace(
+    const_iterator pos, Args &&...args) {
+  size_type index = pos - begin();
+  if (size_ == capacity_) {
+    // the new element is built before the old storage is released, so args
+    // may safely refer to elements of this vector
+    size_type new_capacity = next_capacity(size_ + 1);
+    T *data_tmp = allocate(new_capacity);
+    try {
+      ::new (static_cast<void *>(data_tmp + index))
+          T(std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate_storage(data_tmp);
+      throw;
+    }
+    s21::uninitialized_relocate(data_, data_ + index, data_tmp);
+    s21::uninitialized_relocate(data_ + index, data_ + size_,
+                                data_tmp + index + 1);
+    if (!is_small()) deallocate_storage(data_);
+    data_ = data_tmp;
+    capacity_ = new_capacity;
+  } else if (index == size_) {
+    ::new (static_cast<void *>(data_ + size_)) T(std::forward<Args>(args)...);
+  } else if constexpr (is_trivially_relocatable<T>::value) {
+    alignas(T) unsigned char value[sizeof(T)];
+    ::new (static_cast<void *>(value)) T(std::forward<Args>(args)...);
+    s21::relocate_backward(data_ + index, data_ + size_, data_ + size_ + 1);
+    std::memcpy(static_cast<void *>(data_ + index), value, sizeof(T));
+  } else {
+    T value(std::forward<Args>(args)...);
+    ::new (static_cast<void *>(data_ + size_)) T(std::move(data_[size_ - 1]));
+    std::move_backward(data_ + index, data_ + size_ - 1, data_ + size_);
+    data_[index] = std::move(value);
+  }
+  size_++;
+  return data_ + index;
+}
+
+// constructs an element in place at the end
+template <typename T, size_t N>
+template <typename... Args>
+typename small_vector<T, N>::reference small_vector<T, N>::emplace_back(
+    Args &&...args) {
+  return *emplace(end(), std::forward<Args>(args)...);
+}
+
+// bonus part
+
+// Inserts new elements into the container directly before pos
+template <typename T, size_t N>
+template <typename... Args>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert_many(
+    const_iterator pos, Args &&...args) {
+  size_type index = pos - begin();
+  if constexpr (sizeof...(Args) > 0) {
+    alignas(T) unsigned char buffer[sizeof...(Args) * sizeof(T)];
+    T *values = reinterpret_cast<T *>(buffer);
+    size_type built = 0;
+    try {
+      ((::new (static_cast<void *>(values + built))
+            T(std::forward<Args>(args)),
+        built++),
+       ...);
+      insert(begin() + index, std::make_move_iterator(values),
+             std::make_move_iterator(values + built));
+    } catch (...) {
+      s21::destroy(values, values + built);
+      throw;
+    }
+    s21::destroy(values, values + built);
+  }
+  return begin() + index + sizeof...(Args);
+}
+
+// Appends new elements to the end of the container
+template <typename T, size_t N>
+template <typename... Args>
+void small_vector<T, N>::insert_many_back(Args &&...args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
+
+// private
+
+// start of the inline buffer
+template <typename T, size_t N>
+T *small_vector<T, N>::inline_data() noexcept {
+  return reinterpret_cast<T *>(buffer_);
+}
+
+// heap storage for n elements, aligned for T
+template <typename T, size_t N>
+T *small_vector<T, N>::allocate(size_type n) {
+  return allocate_storage<T>(n);
+}
+
+// destroys elements and frees heap storage, leaving an empty inline vector
+template <typename T, size_t N>
+void small_vector<T, N>::release() noexcept {
+  s21::destroy(data_, data_ + size_);
+  if (!is_small()) deallocate_storage(data_);
+  data_ = inline_data();
+  capacity_ = N;
+  size_ = 0;
+}
+
+// takes the contents of v, which is left empty and inline; this vector must
+// be empty and inline. Heap buffers change owner, inline elements are moved
+template <typename T, size_t N>
+void small_vector<T, N>::steal(small_vector &v) noexcept(
+    std::is_nothrow_move_constructible<T>::value) {
+  if (v.is_small()) {
+    s21::uninitialized_relocate(v.data_, v.data_ + v.size_, data_);
+  } else {
+    data_ = v.data_;
+    capacity_ = v.capacity_;
+    v.data_ = v.inline_data();
+    v.capacity_ = N;
+  }
+  size_ = v.size_;
+  v.size_ = 0;
+}
+
+// moves elements to storage of new_capacity elements, which is the inline
+// buffer when new_capacity fits in it
+template <typename T, size_t N>
+void small_vector<T, N>::reallocate(size_type new_capacity) {
+  T *data_tmp = new_capacity <= N ? inline_data() : allocate(new_capacity);
+  if (data_tmp == data_) return;
+  s21::uninitialized_relocate(data_, data_ + size_, data_tmp);
+  if (!is_small()) deallocate_storage(data_);
+  data_ = data_tmp;
+  capacity_ = std::max(new_capacity, N);
+}
+
+// capacity for growing to hold required elements: doubles, or clamps to
+// max_size(), but never less than required
+template <typename T, size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::next_capacity(
+    size_type required) const {
+  if (required > max_size())
+    throw std::length_error("Size of reserving storage is unavailable");
+  size_type doubled = (max_size() - capacity_) > capacity_ ? capacity_ * 2
+                                                           : max_size();
+  return std::max(doubled, required);
+}
+
+// turns [index, index + count) into raw storage, reallocating at most once
+// and shifting the tail once; returns the start of the gap
+template <typename T, size_t N>
+T *small_vector<T, N>::open_gap(size_type index, size_type count) {
+  if (count > capacity_ - size_) {
+    size_type new_capacity = next_capacity(size_ + count);
+    T *data_tmp = allocate(new_capacity);
+    s21::uninitialized_relocate(data_, data_ + index, data_tmp);
+    s21::uninitialized_relocate(data_ + index, data_ + size_,
+                                data_tmp + index + count);
+    if (!is_small()) deallocate_storage(data_);
+    data_ = data_tmp;
+    capacity_ = new_capacity;
+  } else {
+    s21::relocate_backward(data_ + index, data_ + size_,
+                           data_ + size_ + count);
+  }
+  return data_ + index;
+}
+
+// undoes open_gap when filling the gap failed
+template <typename T, size_t N>
+void small_vector<T, N>::close_gap(size_type index, size_type count) noexcept {
+  s21::relocate_forward(data_ + index + count, data_ + size_ + count,
+                        data_ + index);
+}
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef S21_SPSC_QUEUE_H
+#define S21_SPSC_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_memory.h"
+
+namespace s21 {
+
+// spsc_queue<T, Capacity> hands elements from exactly one producer thread to
+// exactly one consumer thread through a bounded ring of Capacity slots,
+// without locks: every operation finishes in a bounded number of steps.
+//
+// The producer owns tail_ and the consumer owns head_; each publishes its
+// index with a release store and reads the other's with an acquire load,
+// which also makes the element written before the store visible. The two
+// indices live on separate cache lines, and each side keeps a private copy
+// of the other index so that it only reloads the shared one when the ring
+// looks full (producer) or empty (consumer).
+//
+// try_push, emplace and push_bulk may only be called by the producer,
+// try_pop and pop_bulk only by the consumer. size() and empty() are exact
+// when called by either of them and approximate otherwise.
+template <typename T, size_t Capacity>
+class spsc_queue {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "spsc_queue capacity must be a power of two");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  spsc_queue();  // allocates the slots
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+  ~spsc_queue();  // destroys the elements left in the queue
+
+  static constexpr size_type capacity() noexcept { return Capacity; }
+  size_type size() const noexcept;  // returns the number of elements
+  bool empty() const noexcept;      // checks whether the queue is empty
+
+  bool try_push(const T &value);  // copies value in; false when full
+  bool try_push(T &&value);       // moves value in; false when full
+  template <typename... Args>
+  bool emplace(Args &&...args);  // constructs an element in place; false
+                                 // when full
+  bool try_pop(T &out);  // moves the oldest element to out; false when empty
+
+  template <typename InputIt>
+  size_type push_bulk(InputIt first,
+                      size_type count);  // pushes up to count elements from
+                                         // first, returns how many fit
+  template <typename OutputIt>
+  size_type pop_bulk(OutputIt out,
+                     size_type max);  // moves up to max elements to out,
+                                      // returns how many there were
+
+ private:
+  static constexpr size_type kMask = Capacity - 1;
+
+  size_type free_slots(size_type tail,
+                       size_type wanted) noexcept;  // producer: room left
+  size_type ready_slots(size_type head,
+                        size_type wanted) noexcept;  // consumer: elements
+                                                     // left
+
+  // consumer side
+  alignas(cache_line_size) std::atomic<size_type> head_{0};
+  size_type cached_tail_ = 0;  // last tail_ the consumer saw
+  // producer side
+  alignas(cache_line_size) std::atomic<size_type> tail_{0};
+  size_type cached_head_ = 0;  // last head_ the producer saw
+  // shared, read-only after construction
+  alignas(cache_line_size) T *slots_;
+};
+
+}  // namespace s21
+
+#include "s21_spsc_queue.tpp"
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef S21_SPSC_QUEUE_TPP
+#define S21_SPSC_QUEUE_TPP
+
+#include "s21_spsc_queue.h"
+
+namespace s21 {
+
+// indices only grow and wrap around size_type; slot i is i & kMask, and
+// tail - head is the number of elements even after the indices wrap
+
+// allocates the slots
+template <typename T, size_t Capacity>
+spsc_queue<T, Capacity>::spsc_queue()
+    : slots_(allocate_storage<T>(Capacity)) {}
+
+// destroys the elements left in the queue
+template <typename T, size_t Capacity>
+spsc_queue<T, Capacity>::~spsc_queue() {
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    size_type tail = tail_.load(std::memory_order_acquire);
+    for (size_type i = head_.load(std::memory_order_relaxed); i != tail; i++) {
+      slots_[i & kMask].~T();
+    }
+  }
+  deallocate_storage(slots_);
+}
+
+// returns the number of elements
+template <typename T, size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type spsc_queue<T, Capacity>::size()
+    const noexcept {
+  size_type head = head_.load(std::memory_order_acquire);
+  size_type tail = tail_.load(std::memory_order_acquire);
+  return std::min(tail - head, Capacity);
+}
+
+// checks whether the queue is empty
+template <typename T, size_t Capacity>
+bool spsc_queue<T, Capacity>::empty() const noexcept {
+  return size() == 0;
+}
+
+// copies value in; false when full
+template <typename T, size_t Capacity>
+bool spsc_queue<T, Capacity>::try_push(const T &value) {
+  return emplace(value);
+}
+
+// moves value in; false when full
+template <typename T, size_t Capacity>
+bool spsc_queue<T, Capacity>::try_push(T &&value) {
+  return emplace(std::move(value));
+}
+
+// constructs an element in place; a throwing constructor leaves the queue
+// unchanged
+template <typename T, size_t Capacity>
+template <typename... Args>
+bool spsc_queue<T, Capacity>::emplace(Args &&...args) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (free_slots(tail, 1) == 0) return false;
+  ::new (static_cast<void *>(slots_ + (tail & kMask)))
+      T(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+// moves the oldest element to out; false when empty
+template <typename T, size_t Capacity>
+bool spsc_queue<T, Capacity>::try_pop(T &out) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (ready_slots(head, 1) == 0) return false;
+  T &slot = slots_[head & kMask];
+  out = std::move(slot);
+  slot.~T();
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+// pushes up to count elements from first with a single release store;
+// if a constructor throws, the elements built before it are published
+template <typename T, size_t Capacity>
+template <typename InputIt>
+typename spsc_queue<T, Capacity>::size_type
+spsc_queue<T, Capacity>::push_bulk(InputIt first, size_type count) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  size_type n = std::min(count, free_slots(tail, count));
+  size_type done = 0;
+  try {
+    for (; done < n; ++done, ++first) {
+      ::new (static_cast<void *>(slots_ + ((tail + done) & kMask))) T(*first);
+    }
+  } catch (...) {
+    tail_.store(tail + done, std::memory_order_release);
+    throw;
+  }
+  tail_.store(tail + n, std::memory_order_release);
+  return n;
+}
+
+// moves up to max elements to out with a single release store; if an
+// assignment throws, the elements moved before it are released
+template <typename T, size_t Capacity>
+template <typename OutputIt>
+typename spsc_queue<T, Capacity>::size_type
+spsc_queue<T, Capacity>::pop_bulk(OutputIt out, size_type max) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  size_type n = std::min(max, ready_slots(head, max));
+  size_type done = 0;
+  try {
+    for (; done < n; ++done, ++out) {
+      T &slot = slots_[(head + done) & kMask];
+      *out = std::move(slot);
+      slot.~T();
+    }
+  } catch (...) {
+    head_.store(head + done, std::memory_order_release);
+    throw;
+  }
+  head_.store(head + n, std::memory_order_release);
+  return n;
+}
+
+// private
+
+// producer: room left, reloading head_ only when the cached copy shows
+// less room than wanted
+template <typename T, size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type
+spsc_queue<T, Capacity>::free_slots(size_type tail, size_type wanted) noexcept {
+  size_type free = Capacity - (tail - cached_head_);
+  if (free < wanted) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    free = Capacity - (tail - cached_head_);
+  }
+  return free;
+}
+
+// consumer: elements left, reloading tail_ only when the cached copy shows
+// fewer than wanted
+template <typename T, size_t Capacity>
+typename spsc_queue<T, Capacity>::size_type
+spsc_queue<T, Capacity>::ready_slots(size_type head,
+                                     size_type wanted) noexcept {
+  size_type ready = cached_tail_ - head;
+  if (ready < wanted) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    ready = cached_tail_ - head;
+  }
+  return ready;
+}
+
+}  // namespace s21
+
+#endif
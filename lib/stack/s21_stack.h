@@ -2,6 +2,10 @@
 #define S21_STACK_H
 
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
 
 #include "../linked_list/s21_linked_list.h"
 
@@ -18,11 +22,29 @@ class stack {
   stack();
   stack(std::initializer_list<value_type> const &items);
   stack(const stack &s);
-  stack(stack &&s);
+  stack(stack &&s) noexcept(
+      std::is_nothrow_move_constructible<Container>::value);
+  // allocator-extended constructors, for containers that take an allocator
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  explicit stack(const Alloc &alloc);  // empty, allocating from alloc
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  stack(std::initializer_list<value_type> const &items, const Alloc &alloc);
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  stack(const stack &s, const Alloc &alloc);
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  stack(stack &&s, const Alloc &alloc);
   ~stack();
-  stack &operator=(stack &&s);
+  stack &operator=(stack &&s) noexcept(
+      std::is_nothrow_move_assignable<Container>::value);
 
   void push(const_reference value);
+  void push(value_type &&value);  // moves an element to the top
+  template <typename... Args>
+  void emplace(Args &&...args);  // constructs an element in place at the top
   void pop();
   void swap(stack &other);
 
@@ -37,8 +59,30 @@ class stack {
   Container container_;
 };
 
+// an adapter is relocatable exactly when its container is
+template <typename T, typename Container>
+struct is_trivially_relocatable<stack<T, Container>>
+    : is_trivially_relocatable<Container> {};
+
+namespace pmr {
+
+// stack over a linked_list whose nodes come from a std::pmr::memory_resource
+template <typename T>
+using stack = s21::stack<T, pmr::linked_list<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
+namespace std {
+
+// a stack takes an allocator exactly when its container does
+template <typename T, typename Container, typename Alloc>
+struct uses_allocator<s21::stack<T, Container>, Alloc>
+    : uses_allocator<Container, Alloc>::type {};
+
+}  // namespace std
+
 #include "s21_stack.tpp"
 
 #endif
\ No newline at end of file
@@ -13,17 +13,37 @@ template <typename T, typename Container>
 stack<T, Container>::stack(const stack &s) : container_(s.container_) {}
 
 template <typename T, typename Container>
-stack<T, Container>::stack(stack &&s) : container_(std::move(s.container_)) {}
+stack<T, Container>::stack(stack &&s) noexcept(
+    std::is_nothrow_move_constructible<Container>::value)
+    : container_(std::move(s.container_)) {}
+
+template <typename T, typename Container>
+template <typename Alloc, typename>
+stack<T, Container>::stack(const Alloc &alloc) : container_(alloc) {}
+
+template <typename T, typename Container>
+template <typename Alloc, typename>
+stack<T, Container>::stack(std::initializer_list<value_type> const &items,
+                           const Alloc &alloc)
+    : container_(items, alloc) {}
+
+template <typename T, typename Container>
+template <typename Alloc, typename>
+stack<T, Container>::stack(const stack &s, const Alloc &alloc)
+    : container_(s.container_, alloc) {}
+
+template <typename T, typename Container>
+template <typename Alloc, typename>
+stack<T, Container>::stack(stack &&s, const Alloc &alloc)
+    : container_(std::move(s.container_), alloc) {}
 
 template <typename T, typename Container>
 stack<T, Container>::~stack() {}
 
 template <typename T, typename Container>
-stack<T, Container> &stack<T, Container>::operator=(stack &&s) {
-  if (this != &s) {
-    container_ = std::move(s.container_);
-    while (!s.empty()) s.pop();
-  }
+stack<T, Container> &stack<T, Container>::operator=(stack &&s) noexcept(
+    std::is_nothrow_move_assignable<Container>::value) {
+  if (this != &s) container_ = std::move(s.container_);
   return *this;
 }
 
@@ -42,9 +62,20 @@ void stack<T, Container>::push(const_reference value) {
   container_.push_front(value);
 }
 
+template <typename T, typename Container>
+void stack<T, Container>::push(value_type &&value) {
+  container_.push_front(std::move(value));
+}
+
+template <typename T, typename Container>
+template <typename... Args>
+void stack<T, Container>::emplace(Args &&...args) {
+  container_.emplace_front(std::forward<Args>(args)...);
+}
+
 template <typename T, typename Container>
 void stack<T, Container>::pop() {
-  container_.pop();
+  container_.pop_front();
 }
 
 template <typename T, typename Container>
@@ -0,0 +1,244 @@
+#ifndef S21_STATIC_VECTOR_H
+#define S21_STATIC_VECTOR_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_memory.h"
+
+namespace s21 {
+
+// Overflow policies decide what a static_vector does when an insertion needs
+// more room than is left. check() gets the number of elements required and
+// the number available.
+
+// throws std::length_error and leaves the vector unchanged
+struct overflow_throw {
+  static constexpr void check(size_t required, size_t available) {
+    if (required > available)
+      throw std::length_error("Error! static_vector capacity exceeded");
+  }
+};
+
+// asserts in debug builds and checks nothing with NDEBUG: overflowing is then
+// undefined behaviour, in exchange for no branch on the hot path
+struct overflow_assert {
+  static constexpr void check(size_t required, size_t available) noexcept {
+    assert(required <= available);
+    (void)required;
+    (void)available;
+  }
+};
+
+// Inline storage of a static_vector, picked by the element type:
+//   small trivial T        - a real T[N], value-initialized once, so every
+//                            operation is plain assignment and the vector
+//                            works in constant expressions
+//   trivially copyable T   - raw bytes with implicit copies, so the vector
+//                            stays trivially copyable
+//   any other T            - raw bytes with copy, move and destructor that
+//                            touch only the live elements
+// The array is only used up to kStaticVectorArrayBytes: zero-filling a large
+// scratch buffer on every construction would cost more than it saves.
+inline constexpr size_t kStaticVectorArrayBytes = 64;
+
+template <typename T, size_t N>
+inline constexpr bool static_vector_in_array_v =
+    std::is_trivial<T>::value && N * sizeof(T) <= kStaticVectorArrayBytes;
+template <typename T, size_t N>
+struct static_vector_buffer {
+  T *elems() noexcept { return reinterpret_cast<T *>(bytes_); }
+  const T *elems() const noexcept {
+    return reinterpret_cast<const T *>(bytes_);
+  }
+
+  size_t size_ = 0;
+  alignas(T) unsigned char bytes_[N * sizeof(T)];
+};
+
+template <typename T, size_t N, bool InArray = static_vector_in_array_v<T, N>,
+          bool TriviallyCopyable = std::is_trivially_copyable<T>::value>
+struct static_vector_storage : static_vector_buffer<T, N> {};
+
+template <typename T, size_t N>
+struct static_vector_storage<T, N, true, true> {
+  constexpr T *elems() noexcept { return elems_; }
+  constexpr const T *elems() const noexcept { return elems_; }
+
+  size_t size_ = 0;
+  T elems_[N] = {};
+};
+
+template <typename T, size_t N>
+struct static_vector_storage<T, N, false, false> : static_vector_buffer<T, N> {
+  static_vector_storage() = default;
+  static_vector_storage(const static_vector_storage &other);
+  static_vector_storage(static_vector_storage &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value);
+  ~static_vector_storage();
+
+  static_vector_storage &operator=(const static_vector_storage &other);
+  static_vector_storage &operator=(static_vector_storage &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value &&
+      std::is_nothrow_move_assignable<T>::value);
+};
+
+// static_vector<T, N> is a vector with room for N elements inside the object
+// itself: it never allocates, and an insertion past N is handled by the
+// Overflow policy. Copies, moves and the destructor are trivial when they
+// are trivial for T, and for trivial T of up to kStaticVectorArrayBytes the
+// whole interface is constexpr:
+//
+//   constexpr s21::static_vector<int, 4> v{1, 2, 3};
+//   static_assert(v.size() == 3 && v.back() == 3);
+template <typename T, size_t N, typename Overflow = overflow_throw>
+class static_vector : private static_vector_storage<T, N> {
+  static_assert(N > 0, "static_vector needs room for at least one element");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  constexpr static_vector() = default;  // default constructor
+  constexpr explicit static_vector(size_type n);  // parameterized constructor
+  constexpr explicit static_vector(std::initializer_list<value_type> const
+                                       &items);  // initializer list
+                                                 // constructor
+
+  constexpr reference operator[](size_type pos);  // access specified element
+  constexpr const_reference operator[](size_type pos) const;
+
+  constexpr reference at(
+      size_type pos);  // access specified element with bounds checking
+  constexpr const_reference at(size_type pos) const;
+
+  constexpr iterator data() noexcept;  // direct access to the underlying array
+  constexpr const_iterator data() const noexcept;
+  constexpr void swap(static_vector &other);  // swaps the contents
+  static constexpr size_type capacity() noexcept;  // returns N
+  constexpr void reserve(size_type size);  // checks that size elements fit
+  constexpr void shrink_to_fit() noexcept;  // does nothing, the storage is
+                                            // inline
+  constexpr reference back();  // access the last element
+  constexpr const_reference back() const;
+  constexpr reference front();  // access the first element
+  constexpr const_reference front() const;
+  static constexpr size_type max_size() noexcept;  // returns N
+  constexpr size_type size() const noexcept;  // returns the number of elements
+  constexpr void pop_back();                  // removes the last element
+
+  constexpr void clear() noexcept;  // clears the contents
+  constexpr iterator begin() noexcept;  // returns an iterator to the beginning
+  constexpr iterator end() noexcept;    // returns an iterator to the end
+  constexpr iterator insert(
+      iterator pos,
+      const_reference value);  // inserts elements into concrete pos and returns
+                               // the iterator that points to the new element
+  constexpr iterator insert(iterator pos,
+                            value_type &&value);  // moves value into
+                                                  // concrete pos
+  constexpr iterator insert(
+      const_iterator pos, size_type count,
+      const_reference value);  // inserts count copies of value before pos
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  constexpr iterator insert(
+      const_iterator pos, InputIt first,
+      InputIt last);  // inserts elements from range [first, last) before pos
+  template <typename Range>
+  constexpr void append_range(
+      Range &&range);  // appends elements of range to the end
+  constexpr void assign(size_type count,
+                        const_reference value);  // replaces the contents with
+                                                 // count copies of value
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  constexpr void assign(InputIt first,
+                        InputIt last);  // replaces the contents with elements
+                                        // from [first, last)
+  constexpr void resize(size_type count);  // changes the number of elements
+                                           // stored
+  constexpr void resize(
+      size_type count,
+      const_reference value);  // changes the number of elements stored,
+                               // appending copies of value
+  constexpr void erase(iterator pos);  // erases element at pos
+  constexpr void push_back(
+      const_reference value);  // adds an element to the end
+  constexpr void push_back(value_type &&value);  // moves an element to the end
+  constexpr bool empty() const noexcept;  // checks whether the container is
+                                          // empty
+
+  template <typename... Args>
+  constexpr iterator emplace(
+      const_iterator pos,
+      Args &&...args);  // constructs an element in place directly before pos
+  template <typename... Args>
+  constexpr reference emplace_back(
+      Args &&...args);  // constructs an element in place at the end
+
+  // additional
+  constexpr const_iterator begin()
+      const noexcept;  // returns a const iterator to the beginning
+  constexpr const_iterator end()
+      const noexcept;  // returns a const iterator to the end
+
+  // bonus part
+  template <typename... Args>
+  constexpr iterator insert_many(
+      const_iterator pos,
+      Args &&...args);  // Inserts new elements into the container directly
+                        // before pos
+
+  template <typename... Args>
+  constexpr void insert_many_back(
+      Args &&...args);  // Appends new elements to the end of the container
+
+ private:
+  // elements of small trivial T live in a real array and are only ever
+  // assigned
+  static constexpr bool in_array = static_vector_in_array_v<T, N>;
+
+  template <typename... Args>
+  static constexpr void construct(
+      T *p, Args &&...args);  // builds an element in the free slot p
+  static constexpr void destroy(T *first,
+                                T *last) noexcept;  // ends the lifetime of
+                                                    // [first, last)
+  constexpr T *open_gap(size_type index,
+                        size_type count);  // turns [index, index + count)
+                                           // into free slots by shifting the
+                                           // tail
+  void fill_gap(size_type index, size_type count,
+                const_reference value);  // opens a gap and fills it with
+                                         // copies of value
+  template <typename ForwardIt>
+  void fill_gap(size_type index, size_type count, ForwardIt first,
+                ForwardIt last);  // opens a gap and copies [first, last)
+                                  // into it
+  void close_gap(size_type index, size_type count) noexcept;  // undoes
+                                                              // open_gap
+};
+
+template <typename T, size_t N, typename Overflow>
+struct is_trivially_relocatable<static_vector<T, N, Overflow>>
+    : is_trivially_relocatable<T> {};
+
+}  // namespace s21
+
+#include "s21_static_vector.tpp"
+
+#endif
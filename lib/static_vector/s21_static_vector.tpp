@@ -0,0 +1,572 @@
+#ifndef S21_STATIC_VECTOR_TPP
+#define S21_STATIC_VECTOR_TPP
+
+#include "s21_static_vector.h"
+
+namespace s21 {
+
+// storage of non-trivially copyable T
+
+// copy constructor
+template <typename T, size_t N>
+static_vector_storage<T, N, false, false>::static_vector_storage(
+    const static_vector_storage &other) {
+  this->size_ = s21::uninitialized_copy(other.elems(),
+                                        other.elems() + other.size_,
+                                        this->elems()) -
+                this->elems();
+}
+
+// move constructor, moves the elements one by one
+template <typename T, size_t N>
+static_vector_storage<T, N, false, false>::static_vector_storage(
+    static_vector_storage &&other) noexcept(
+    std::is_nothrow_move_constructible<T>::value) {
+  this->size_ = std::uninitialized_move(other.elems(),
+                                        other.elems() + other.size_,
+                                        this->elems()) -
+                this->elems();
+}
+
+// destructor
+template <typename T, size_t N>
+static_vector_storage<T, N, false, false>::~static_vector_storage() {
+  s21::destroy(this->elems(), this->elems() + this->size_);
+}
+
+// copy assignment: assigns over the common prefix, then constructs or
+// destroys the difference
+template <typename T, size_t N>
+static_vector_storage<T, N, false, false> &
+static_vector_storage<T, N, false, false>::operator=(
+    const static_vector_storage &other) {
+  if (this != &other) {
+    T *elems = this->elems();
+    const T *source = other.elems();
+    size_t common = std::min(this->size_, other.size_);
+    std::copy(source, source + common, elems);
+    if (other.size_ > common) {
+      s21::uninitialized_copy(source + common, source + other.size_,
+                              elems + common);
+    } else {
+      s21::destroy(elems + common, elems + this->size_);
+    }
+    this->size_ = other.size_;
+  }
+  return *this;
+}
+
+// move assignment, element by element like the copy
+template <typename T, size_t N>
+static_vector_storage<T, N, false, false> &
+static_vector_storage<T, N, false, false>::operator=(
+    static_vector_storage &&other) noexcept(
+    std::is_nothrow_move_constructible<T>::value &&
+    std::is_nothrow_move_assignable<T>::value) {
+  if (this != &other) {
+    T *elems = this->elems();
+    T *source = other.elems();
+    size_t common = std::min(this->size_, other.size_);
+    std::move(source, source + common, elems);
+    if (other.size_ > common) {
+      std::uninitialized_move(source + common, source + other.size_,
+                              elems + common);
+    } else {
+      s21::destroy(elems + common, elems + this->size_);
+    }
+    this->size_ = other.size_;
+  }
+  return *this;
+}
+
+// static_vector
+
+// parameterized constructor
+template <typename T, size_t N, typename Overflow>
+constexpr static_vector<T, N, Overflow>::static_vector(size_type n)
+    : static_vector() {
+  resize(n);
+}
+
+// initializer list constructor
+template <typename T, size_t N, typename Overflow>
+constexpr static_vector<T, N, Overflow>::static_vector(
+    std::initializer_list<value_type> const &items)
+    : static_vector() {
+  insert(end(), items.begin(), items.end());
+}
+
+// access specified element
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::reference
+static_vector<T, N, Overflow>::operator[](size_type pos) {
+  return this->elems()[pos];
+}
+
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::const_reference
+static_vector<T, N, Overflow>::operator[](size_type pos) const {
+  return this->elems()[pos];
+}
+
+// access specified element with bounds checking
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::reference
+static_vector<T, N, Overflow>::at(size_type pos) {
+  if (pos >= this->size_)
+    throw std::out_of_range("Error! Position of value is out of range");
+  return this->elems()[pos];
+}
+
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::const_reference
+static_vector<T, N, Overflow>::at(size_type pos) const {
+  if (pos >= this->size_)
+    throw std::out_of_range("Error! Position of value is out of range");
+  return this->elems()[pos];
+}
+
+// direct access to the underlying array
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::iterator
+static_vector<T, N, Overflow>::data() noexcept {
+  return (size() == 0) ? nullptr : this->elems();
+}
+
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::const_iterator
+static_vector<T, N, Overflow>::data() const noexcept {
+  return (size() == 0) ? nullptr : this->elems();
+}
+
+// swaps the contents: the common prefix element by element, then the longer
+// tail moves over to the shorter vector
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::swap(static_vector &other) {
+  if (this == &other) return;
+  static_vector &shorter = size() < other.size() ? *this : other;
+  static_vector &longer = size() < other.size() ? other : *this;
+  T *a = shorter.elems(), *b = longer.elems();
+  size_type common = shorter.size_, total = longer.size_;
+  for (size_type i = 0; i < common; i++) {
+    if constexpr (in_array) {
+      T tmp = a[i];
+      a[i] = b[i];
+      b[i] = tmp;
+    } else {
+      using std::swap;
+      swap(a[i], b[i]);
+    }
+  }
+  for (size_type i = common; i < total; i++) construct(a + i, std::move(b[i]));
+  destroy(b + common, b + total);
+  shorter.size_ = total;
+  longer.size_ = common;
+}
+
+// returns the number of elements that fit in the inline storage
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::size_type
+static_vector<T, N, Overflow>::capacity() noexcept {
+  return N;
+}
+
+// the storage never grows: only checks that size elements fit
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::reserve(size_type size) {
+  Overflow::check(size, N);
+}
+
+// does nothing, the storage is inline
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::shrink_to_fit() noexcept {}
+
+// access the last element
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::reference
+static_vector<T, N, Overflow>::back() {
+  return *(end() - 1);
+}
+
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::const_reference
+static_vector<T, N, Overflow>::back() const {
+  return *(end() - 1);
+}
+
+// access the first element
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::reference
+static_vector<T, N, Overflow>::front() {
+  return *begin();
+}
+
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::const_reference
+static_vector<T, N, Overflow>::front() const {
+  return *begin();
+}
+
+// returns the maximum possible number of elements
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::size_type
+static_vector<T, N, Overflow>::max_size() noexcept {
+  return N;
+}
+
+// returns the number of elements
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::size_type
+static_vector<T, N, Overflow>::size() const noexcept {
+  return this->size_;
+}
+
+// removes the last element
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::pop_back() {
+  this->size_--;
+  destroy(end(), end() + 1);
+}
+
+// clears the contents
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::clear() noexcept {
+  destroy(begin(), end());
+  this->size_ = 0;
+}
+
+// returns an iterator to the beginning
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::iterator
+static_vector<T, N, Overflow>::begin() noexcept {
+  return this->elems();
+}
+
+// returns a const iterator to the beginning
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::const_iterator
+static_vector<T, N, Overflow>::begin() const noexcept {
+  return this->elems();
+}
+
+// returns an iterator to the end
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::iterator
+static_vector<T, N, Overflow>::end() noexcept {
+  return this->elems() + this->size_;
+}
+
+// returns a const iterator to the end
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::const_iterator
+static_vector<T, N, Overflow>::end() const noexcept {
+  return this->elems() + this->size_;
+}
+
+// inserts elements into concrete pos and returns the iterator that points to
+// the new element
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::iterator
+static_vector<T, N, Overflow>::insert(iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+// moves value into concrete pos and returns the iterator that points to the
+// new element
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::iterator
+static_vector<T, N, Overflow>::insert(iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+// inserts count copies of value before pos and returns the iterator that
+// points to the first inserted element
+template <typename T, size_t N, typename Overflow>
+constexpr typename static_vector<T, N, Overflow>::iterator
+static_vector<T, N, Overflow>::insert(const_iterator pos, size_type count,
+                                      const_reference value) {
+  size_type index = pos - begin();
+  Overflow::check(count, N - this->size_);
+  if (count == 0) return begin() + index;
+  if constexpr (in_array) {
+    // value may live in this vector and move together with the tail
+    value_type copy = value;
+    T *gap = open_gap(index, count);
+    for (size_type i = 0; i < count; i++) gap[i] = copy;
+  } else {
+    if (&value >= begin() && &value < end()) {
+      value_type copy(value);
+      return insert(pos, count, copy);
+    }
+    fill_gap(index, count, value);
+  }
+  this->size_ += count;
+  return begin() + index;
+}
+
+// inserts elements from range [first, last) before pos and returns the
+// iterator that points to the first inserted element; the range must not
+// point into this vector
+template <typename T, size_t N, typename Overflow>
+template <typename InputIt, typename>
+constexpr typename static_vector<T, N, Overflow>::iterator
+static_vector<T, N, Overflow>::insert(const_iterator pos, InputIt first,
+                                      InputIt last) {
+  size_type index = pos - begin();
+  if constexpr (is_forward_iterator<InputIt>::value) {
+    size_type count = std::distance(first, last);
+    Overflow::check(count, N - this->size_);
+    if (count > 0) {
+      if constexpr (in_array) {
+        T *gap = open_gap(index, count);
+        for (; first != last; ++first, ++gap) *gap = *first;
+      } else {
+        fill_gap(index, count, first, last);
+      }
+      this->size_ += count;
+    }
+  } else {
+    // a single-pass range can't be measured: append it, then rotate in place
+    size_type old_size = this->size_;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(begin() + index, begin() + old_size, end());
+  }
+  return begin() + index;
+}
+
+// appends elements of range to the end
+template <typename T, size_t N, typename Overflow>
+template <typename Range>
+constexpr void static_vector<T, N, Overflow>::append_range(Range &&range) {
+  insert(end(), std::begin(range), std::end(range));
+}
+
+// replaces the contents with count copies of value
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::assign(size_type count,
+                                                     const_reference value) {
+  Overflow::check(count, N);
+  T *elems = this->elems();
+  size_type common = std::min(count, this->size_);
+  for (size_type i = 0; i < common; i++) elems[i] = value;
+  for (; this->size_ < count; this->size_++) {
+    construct(elems + this->size_, value);
+  }
+  destroy(elems + count, elems + this->size_);
+  this->size_ = count;
+}
+
+// replaces the contents with elements from [first, last)
+template <typename T, size_t N, typename Overflow>
+template <typename InputIt, typename>
+constexpr void static_vector<T, N, Overflow>::assign(InputIt first,
+                                                     InputIt last) {
+  clear();
+  insert(end(), first, last);
+}
+
+// changes the number of elements stored, value-initializing new elements
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::resize(size_type count) {
+  Overflow::check(count, N);
+  T *elems = this->elems();
+  for (; this->size_ < count; this->size_++) construct(elems + this->size_);
+  destroy(elems + count, elems + this->size_);
+  this->size_ = count;
+}
+
+// changes the number of elements stored, appending copies of value
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::resize(size_type count,
+                                                     const_reference value) {
+  if (count > this->size_) {
+    insert(end(), count - this->size_, value);
+  } else {
+    destroy(begin() + count, end());
+    this->size_ = count;
+  }
+}
+
+// erases element at pos
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::erase(iterator pos) {
+  size_type index = pos - begin();
+  T *elems = this->elems();
+  if constexpr (in_array) {
+    for (size_type i = index + 1; i < this->size_; i++) {
+      elems[i - 1] = elems[i];
+    }
+  } else if constexpr (is_trivially_relocatable<T>::value) {
+    elems[index].~T();
+    s21::relocate_forward(elems + index + 1, elems + this->size_,
+                          elems + index);
+  } else {
+    std::move(elems + index + 1, elems + this->size_, elems + index);
+    elems[this->size_ - 1].~T();
+  }
+  this->size_--;
+}
+
+// adds an element to the end
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::push_back(
+    const_reference value) {
+  emplace_back(value);
+}
+
+// moves an element to the end
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+// checks whether the container is empty
+template <typename T, size_t N, typename Overflow>
+constexpr bool static_vector<T, N, Overflow>::empty() const noexcept {
+  return this->size_ == 0;
+}
+
+// constructs an element in place directly before pos and returns the iterator
+// that points to the new element
+template <typename T, size_t N, typename Overflow>
+template <typename... Args>
+constexpr typename static_vector<T, N, Overflow>::iterator
+static_vector<T, N, Overflow>::emplace(const_iterator pos, Args &&...args) {
+  size_type index = pos - begin();
+  Overflow::check(1, N - this->size_);
+  T *elems = this->elems();
+  if (index == this->size_) {
+    construct(elems + index, std::forward<Args>(args)...);
+  } else if constexpr (in_array) {
+    T value(std::forward<Args>(args)...);
+    for (size_type i = this->size_; i > index; i--) elems[i] = elems[i - 1];
+    elems[index] = value;
+  } else if constexpr (is_trivially_relocatable<T>::value) {
+    // args may refer to an element that the shift is about to move
+    alignas(T) unsigned char value[sizeof(T)];
+    ::new (static_cast<void *>(value)) T(std::forward<Args>(args)...);
+    s21::relocate_backward(elems + index, elems + this->size_,
+                           elems + this->size_ + 1);
+    std::memcpy(static_cast<void *>(elems + index), value, sizeof(T));
+  } else {
+    T value(std::forward<Args>(args)...);
+    ::new (static_cast<void *>(elems + this->size_))
+        T(std::move(elems[this->size_ - 1]));
+    std::move_backward(elems + index, elems + this->size_ - 1,
+                       elems + this->size_);
+    elems[index] = std::move(value);
+  }
+  this->size_++;
+  return elems + index;
+}
+
+// constructs an element in place at the end
+template <typename T, size_t N, typename Overflow>
+template <typename... Args>
+constexpr typename static_vector<T, N, Overflow>::reference
+static_vector<T, N, Overflow>::emplace_back(Args &&...args) {
+  return *emplace(end(), std::forward<Args>(args)...);
+}
+
+// bonus part
+
+// Inserts new elements into the container directly before pos
+template <typename T, size_t N, typename Overflow>
+template <typename... Args>
+constexpr typename static_vector<T, N, Overflow>::iterator
+static_vector<T, N, Overflow>::insert_many(const_iterator pos,
+                                           Args &&...args) {
+  size_type index = pos - begin();
+  Overflow::check(sizeof...(Args), N - this->size_);
+  ((emplace(begin() + index, std::forward<Args>(args)), index++), ...);
+  return begin() + index;
+}
+
+// Appends new elements to the end of the container
+template <typename T, size_t N, typename Overflow>
+template <typename... Args>
+constexpr void static_vector<T, N, Overflow>::insert_many_back(
+    Args &&...args) {
+  Overflow::check(sizeof...(Args), N - this->size_);
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+// private
+
+// builds an element in the free slot p: assignment when the slots are a real
+// array, placement new otherwise
+template <typename T, size_t N, typename Overflow>
+template <typename... Args>
+constexpr void static_vector<T, N, Overflow>::construct(T *p, Args &&...args) {
+  if constexpr (in_array) {
+    *p = T(std::forward<Args>(args)...);
+  } else {
+    ::new (static_cast<void *>(p)) T(std::forward<Args>(args)...);
+  }
+}
+
+// ends the lifetime of [first, last); the slots of a real array stay as they
+// are
+template <typename T, size_t N, typename Overflow>
+constexpr void static_vector<T, N, Overflow>::destroy(T *first,
+                                                      T *last) noexcept {
+  if constexpr (!in_array) s21::destroy(first, last);
+}
+
+// turns [index, index + count) into free slots by shifting the tail once;
+// the caller checked that count more elements fit
+template <typename T, size_t N, typename Overflow>
+constexpr T *static_vector<T, N, Overflow>::open_gap(size_type index,
+                                                     size_type count) {
+  T *elems = this->elems();
+  if constexpr (in_array) {
+    for (size_type i = this->size_; i > index; i--) {
+      elems[i - 1 + count] = elems[i - 1];
+    }
+  } else {
+    s21::relocate_backward(elems + index, elems + this->size_,
+                           elems + this->size_ + count);
+  }
+  return elems + index;
+}
+
+// opens a gap of count slots and fills it with copies of value; on exception
+// the gap is closed again. Not constexpr: only used for raw storage
+template <typename T, size_t N, typename Overflow>
+void static_vector<T, N, Overflow>::fill_gap(size_type index, size_type count,
+                                             const_reference value) {
+  T *gap = open_gap(index, count);
+  try {
+    std::uninitialized_fill_n(gap, count, value);
+  } catch (...) {
+    close_gap(index, count);
+    throw;
+  }
+}
+
+// opens a gap of count slots and copies [first, last) into it
+template <typename T, size_t N, typename Overflow>
+template <typename ForwardIt>
+void static_vector<T, N, Overflow>::fill_gap(size_type index, size_type count,
+                                             ForwardIt first, ForwardIt last) {
+  T *gap = open_gap(index, count);
+  try {
+    std::uninitialized_copy(first, last, gap);
+  } catch (...) {
+    close_gap(index, count);
+    throw;
+  }
+}
+
+// undoes open_gap when filling the gap failed
+template <typename T, size_t N, typename Overflow>
+void static_vector<T, N, Overflow>::close_gap(size_type index,
+                                              size_type count) noexcept {
+  T *elems = this->elems();
+  s21::relocate_forward(elems + index + count, elems + this->size_ + count,
+                        elems + index);
+}
+
+}  // namespace s21
+
+#endif
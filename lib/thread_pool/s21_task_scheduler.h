@@ -0,0 +1,190 @@
+#ifndef S21_TASK_SCHEDULER_H
+#define S21_TASK_SCHEDULER_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "../deque/s21_deque.h"
+#include "../s21_memory.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+class task_scheduler;
+
+// task_group collects tasks spawned on a task_scheduler so that they can be
+// waited for together. Tasks may spawn into their own group or into new
+// ones, which makes fork-join recursion straightforward:
+//
+//   s21::task_group group(scheduler);
+//   group.spawn([&] { sort(left); });
+//   sort(right);
+//   group.wait();
+//
+// wait() does not block while tasks are pending: the waiting thread runs
+// tasks itself, its group's or any other.
+class task_group {
+ public:
+  explicit task_group(task_scheduler &scheduler);
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+  ~task_group();  // waits for the tasks; their exceptions are dropped
+
+  template <typename F>
+  void spawn(F &&fn);  // runs fn() as a task of this group
+  void wait();         // returns when every spawned task has finished;
+                       // rethrows the first exception thrown by a task
+
+ private:
+  friend class task_scheduler;
+
+  void fail(std::exception_ptr error) noexcept;  // keeps the first error
+
+  task_scheduler &scheduler_;
+  std::atomic<size_t> pending_{0};  // spawned tasks that have not finished
+  std::atomic<bool> failed_{false};  // tasks that start later are skipped
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+// task_scheduler runs small tasks on a fixed set of threads by work
+// stealing. Every thread owns a Chase-Lev deque: it pushes and pops the
+// newest tasks at the bottom without locks, and when it runs out it steals
+// the oldest task from the top of a randomly chosen other deque. A task
+// spawned by a task lands on its own thread's deque, so recursion stays
+// local and only idle threads touch shared cache lines.
+//
+// Like thread_pool, a scheduler of size() threads starts size() - 1
+// workers; the last deque belongs to one outside thread at a time while it
+// waits for a task_group. Other outside threads hand their tasks over
+// through a locked queue. Workers with nothing to steal sleep until new
+// tasks are spawned.
+class task_scheduler {
+ public:
+  explicit task_scheduler(
+      size_t threads = 0);  // creates a scheduler of threads threads, one
+                            // per hardware thread when threads is 0
+  task_scheduler(const task_scheduler &) = delete;
+  task_scheduler &operator=(const task_scheduler &) = delete;
+  ~task_scheduler();  // joins the workers; every task_group must be done
+
+  size_t size() const noexcept;  // returns the number of threads that run
+                                 // tasks, the caller included
+
+  template <typename F>
+  void parallel_for(size_t first, size_t last, F &&fn,
+                    size_t grain = 0);  // calls fn(i) for i in [first, last)
+                                        // and waits; the range is halved
+                                        // down to grain indices per task,
+                                        // chosen from size() when 0
+  template <typename F>
+  void run(size_t tasks,
+           F &&fn);  // calls fn(i) for i in [0, tasks) and waits, as
+                     // thread_pool::run does; rethrows the first exception
+
+ private:
+  friend class task_group;
+
+  struct task {
+    void (*execute)(task *self) noexcept;  // runs the task and frees it
+    task_group *group;
+  };
+
+  template <typename F>
+  struct closure : task {
+    static void execute(task *self) noexcept;
+
+    F fn;
+  };
+
+  // Chase-Lev work-stealing deque of tasks. The owner thread pushes and
+  // pops at the bottom, other threads steal at the top; only the last
+  // element and steals need a compare-and-swap.
+  class work_deque {
+   public:
+    work_deque();
+    work_deque(const work_deque &) = delete;
+    work_deque &operator=(const work_deque &) = delete;
+    ~work_deque();
+
+    void push(task *t);      // owner only; grows the ring when it is full
+    task *pop() noexcept;    // owner only; the newest task or null
+    task *steal() noexcept;  // any thread; the oldest task or null
+    bool empty() const noexcept;
+
+   private:
+    struct ring {
+      explicit ring(size_t capacity);
+      ring(const ring &) = delete;
+      ring &operator=(const ring &) = delete;
+      ~ring();
+
+      size_t mask;
+      std::atomic<task *> *slots;
+    };
+
+    ring *grow(ring *old, int64_t top, int64_t bottom);
+
+    alignas(cache_line_size) std::atomic<int64_t> top_{0};
+    alignas(cache_line_size) std::atomic<int64_t> bottom_{0};
+    std::atomic<ring *> ring_;
+    vector<ring *> retired_;  // outgrown rings; a thief may still read one,
+                              // so they live as long as the deque
+  };
+
+  // the scheduler and deque a thread currently works for
+  struct context {
+    task_scheduler *scheduler;
+    size_t index;
+  };
+
+  template <typename F>
+  static void split(task_group &group, size_t first, size_t last,
+                    size_t grain, F &fn);  // spawns the upper halves and
+                                           // runs the rest
+
+  void submit(task *t);  // queues a task from the current thread
+  void notify();         // wakes a sleeping worker if there is one
+  task *find_task();     // own deque, then handed-over tasks, then steals
+  bool has_work() const noexcept;
+  void worker_loop(size_t index);
+  void stop() noexcept;  // wakes and joins the workers
+  size_t outside_index() const noexcept;  // the deque of outside threads
+
+  work_deque *deques_ = nullptr;  // one per thread that runs tasks
+  size_t deque_count_ = 0;
+  std::atomic<bool> outside_taken_{false};  // an outside thread owns the
+                                            // last deque
+  vector<std::thread> workers_;
+
+  std::mutex handover_mutex_;
+  deque<task *> handover_;  // tasks spawned from outside threads
+  std::atomic<size_t> handover_size_{0};
+
+  std::mutex sleep_mutex_;
+  std::condition_variable sleep_;
+  std::atomic<size_t> sleepers_{0};
+  size_t wakeups_ = 0;
+  bool stop_ = false;
+
+  static inline thread_local context current_{nullptr, 0};
+  static inline thread_local unsigned steal_seed_ = 0;
+};
+
+task_scheduler &default_task_scheduler();  // process-wide scheduler with one
+                                           // thread per hardware thread
+
+}  // namespace s21
+
+#include "s21_task_scheduler.tpp"
+
+#endif
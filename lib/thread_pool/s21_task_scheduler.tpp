@@ -0,0 +1,349 @@
+namespace s21 {
+
+// task_group
+
+inline task_group::task_group(task_scheduler &scheduler)
+    : scheduler_(scheduler) {}
+
+inline task_group::~task_group() {
+  try {
+    wait();
+  } catch (...) {
+  }
+}
+
+// the counter goes up before the task is visible, so wait() cannot miss it
+template <typename F>
+void task_group::spawn(F &&fn) {
+  using Fn = std::decay_t<F>;
+  using closure = task_scheduler::closure<Fn>;
+  closure *t = new closure{{&closure::execute, this}, std::forward<F>(fn)};
+  pending_.fetch_add(1, std::memory_order_relaxed);
+  try {
+    scheduler_.submit(t);
+  } catch (...) {
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    delete t;
+    throw;
+  }
+}
+
+// an outside thread borrows the spare deque while it waits, so that the
+// tasks it runs spawn without locking
+inline void task_group::wait() {
+  task_scheduler::context saved = task_scheduler::current_;
+  bool borrowed = saved.scheduler != &scheduler_ &&
+                  !scheduler_.outside_taken_.exchange(
+                      true, std::memory_order_acquire);
+  if (borrowed) {
+    task_scheduler::current_ = {&scheduler_, scheduler_.outside_index()};
+  }
+  while (pending_.load(std::memory_order_acquire) != 0) {
+    if (task_scheduler::task *t = scheduler_.find_task()) {
+      t->execute(t);
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  if (borrowed) {
+    task_scheduler::current_ = saved;
+    scheduler_.outside_taken_.store(false, std::memory_order_release);
+  }
+
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    std::swap(error, error_);
+  }
+  failed_.store(false, std::memory_order_relaxed);
+  if (error) std::rethrow_exception(error);
+}
+
+inline void task_group::fail(std::exception_ptr error) noexcept {
+  failed_.store(true, std::memory_order_relaxed);
+  std::lock_guard<std::mutex> lock(error_mutex_);
+  if (!error_) error_ = std::move(error);
+}
+
+// task_scheduler
+
+inline task_scheduler::task_scheduler(size_t threads) {
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  deques_ = new work_deque[threads];
+  deque_count_ = threads;
+  try {
+    workers_.reserve(threads - 1);
+    for (size_t i = 0; i + 1 < threads; i++) {
+      workers_.emplace_back([this, i] { worker_loop(i); });
+    }
+  } catch (...) {
+    stop();
+    delete[] deques_;
+    throw;
+  }
+}
+
+inline task_scheduler::~task_scheduler() {
+  stop();
+  delete[] deques_;
+}
+
+inline size_t task_scheduler::size() const noexcept { return deque_count_; }
+
+template <typename F>
+void task_scheduler::parallel_for(size_t first, size_t last, F &&fn,
+                                  size_t grain) {
+  if (first >= last) return;
+  size_t n = last - first;
+  if (grain == 0) grain = std::max<size_t>(1, n / (size() * 8));
+  if (n <= grain || size() == 1) {
+    for (; first < last; first++) fn(first);
+    return;
+  }
+  task_group group(*this);
+  group.spawn([&] { split(group, first, last, grain, fn); });
+  group.wait();
+}
+
+template <typename F>
+void task_scheduler::run(size_t tasks, F &&fn) {
+  parallel_for(0, tasks, std::forward<F>(fn), 1);
+}
+
+// private
+
+template <typename F>
+void task_scheduler::closure<F>::execute(task *self) noexcept {
+  closure *c = static_cast<closure *>(self);
+  task_group *group = c->group;
+  if (!group->failed_.load(std::memory_order_relaxed)) {
+    try {
+      c->fn();
+    } catch (...) {
+      group->fail(std::current_exception());
+    }
+  }
+  delete c;
+  group->pending_.fetch_sub(1, std::memory_order_release);
+}
+
+// the upper half goes to the deque where a thief can take it, and the lower
+// half is split again, so the biggest pieces are stolen first
+template <typename F>
+void task_scheduler::split(task_group &group, size_t first, size_t last,
+                           size_t grain, F &fn) {
+  while (last - first > grain) {
+    size_t middle = first + (last - first) / 2;
+    group.spawn([&group, middle, last, grain, &fn] {
+      split(group, middle, last, grain, fn);
+    });
+    last = middle;
+  }
+  for (; first < last; first++) fn(first);
+}
+
+inline void task_scheduler::submit(task *t) {
+  if (current_.scheduler == this) {
+    deques_[current_.index].push(t);
+  } else {
+    std::lock_guard<std::mutex> lock(handover_mutex_);
+    handover_.push_back(t);
+    handover_size_.fetch_add(1, std::memory_order_relaxed);
+  }
+  notify();
+}
+
+// the fence orders the push before the sleepers_ check; a worker that goes
+// to sleep counts itself before it checks the deques, so one of the two
+// sees the other
+inline void task_scheduler::notify() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (sleepers_.load(std::memory_order_seq_cst) == 0) return;
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    if (wakeups_ < sleepers_.load(std::memory_order_relaxed)) wakeups_++;
+  }
+  sleep_.notify_one();
+}
+
+inline typename task_scheduler::task *task_scheduler::find_task() {
+  const context ctx = current_;
+  bool owner = ctx.scheduler == this;
+  if (owner) {
+    if (task *t = deques_[ctx.index].pop()) return t;
+  }
+  if (handover_size_.load(std::memory_order_relaxed) > 0) {
+    std::lock_guard<std::mutex> lock(handover_mutex_);
+    if (!handover_.empty()) {
+      task *t = handover_.front();
+      handover_.pop_front();
+      handover_size_.fetch_sub(1, std::memory_order_relaxed);
+      return t;
+    }
+  }
+
+  // xorshift picks where the round of steals starts
+  unsigned seed = steal_seed_;
+  if (seed == 0) {
+    seed = static_cast<unsigned>(
+               std::hash<std::thread::id>()(std::this_thread::get_id())) |
+           1;
+  }
+  seed ^= seed << 13;
+  seed ^= seed >> 17;
+  seed ^= seed << 5;
+  steal_seed_ = seed;
+  for (size_t i = 0, start = seed % deque_count_; i < deque_count_; i++) {
+    size_t victim = (start + i) % deque_count_;
+    if (owner && victim == ctx.index) continue;
+    if (task *t = deques_[victim].steal()) return t;
+  }
+  return nullptr;
+}
+
+inline bool task_scheduler::has_work() const noexcept {
+  if (handover_size_.load(std::memory_order_seq_cst) > 0) return true;
+  for (size_t i = 0; i < deque_count_; i++) {
+    if (!deques_[i].empty()) return true;
+  }
+  return false;
+}
+
+// a worker spins for a while before it sleeps, since fork-join work tends
+// to come in bursts
+inline void task_scheduler::worker_loop(size_t index) {
+  constexpr int kIdleRounds = 64;
+  current_ = {this, index};
+  int idle = 0;
+  for (;;) {
+    if (task *t = find_task()) {
+      t->execute(t);
+      idle = 0;
+      continue;
+    }
+    if (++idle < kIdleRounds) {
+      std::this_thread::yield();
+      continue;
+    }
+    idle = 0;
+    sleepers_.fetch_add(1, std::memory_order_seq_cst);
+    if (has_work()) {
+      sleepers_.fetch_sub(1, std::memory_order_relaxed);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(sleep_mutex_);
+    sleep_.wait(lock, [this] { return stop_ || wakeups_ > 0; });
+    sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    if (stop_) return;
+    wakeups_--;
+  }
+}
+
+inline void task_scheduler::stop() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(sleep_mutex_);
+    stop_ = true;
+  }
+  sleep_.notify_all();
+  for (std::thread &worker : workers_) worker.join();
+  workers_.clear();
+}
+
+inline size_t task_scheduler::outside_index() const noexcept {
+  return deque_count_ - 1;
+}
+
+// work_deque
+
+inline task_scheduler::work_deque::ring::ring(size_t capacity)
+    : mask(capacity - 1), slots(new std::atomic<task *>[capacity]) {}
+
+inline task_scheduler::work_deque::ring::~ring() { delete[] slots; }
+
+inline task_scheduler::work_deque::work_deque() : ring_(new ring(256)) {}
+
+inline task_scheduler::work_deque::~work_deque() {
+  delete ring_.load(std::memory_order_relaxed);
+  for (ring *r : retired_) delete r;
+}
+
+// the release store of bottom_ publishes both the task and, after a grow,
+// the new ring to thieves
+inline void task_scheduler::work_deque::push(task *t) {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  int64_t top = top_.load(std::memory_order_acquire);
+  ring *r = ring_.load(std::memory_order_relaxed);
+  if (bottom - top > static_cast<int64_t>(r->mask)) r = grow(r, top, bottom);
+  r->slots[bottom & r->mask].store(t, std::memory_order_relaxed);
+  bottom_.store(bottom + 1, std::memory_order_release);
+}
+
+// bottom_ moves first so that thieves stop short of the last task; only
+// when one task is left do the owner and the thieves race for it on top_
+inline typename task_scheduler::task *
+task_scheduler::work_deque::pop() noexcept {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  ring *r = ring_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  int64_t top = top_.load(std::memory_order_seq_cst);
+  if (top > bottom) {
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  task *t = r->slots[bottom & r->mask].load(std::memory_order_relaxed);
+  if (top == bottom) {
+    if (!top_.compare_exchange_strong(top, top + 1,
+                                      std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      t = nullptr;
+    }
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+  return t;
+}
+
+inline typename task_scheduler::task *
+task_scheduler::work_deque::steal() noexcept {
+  int64_t top = top_.load(std::memory_order_seq_cst);
+  int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+  if (top >= bottom) return nullptr;
+  ring *r = ring_.load(std::memory_order_acquire);
+  task *t = r->slots[top & r->mask].load(std::memory_order_relaxed);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  return t;
+}
+
+inline bool task_scheduler::work_deque::empty() const noexcept {
+  return top_.load(std::memory_order_seq_cst) >=
+         bottom_.load(std::memory_order_seq_cst);
+}
+
+inline task_scheduler::work_deque::ring *task_scheduler::work_deque::grow(
+    ring *old, int64_t top, int64_t bottom) {
+  ring *bigger = new ring(2 * (old->mask + 1));
+  try {
+    retired_.push_back(old);
+  } catch (...) {
+    delete bigger;
+    throw;
+  }
+  for (int64_t i = top; i < bottom; i++) {
+    bigger->slots[i & bigger->mask].store(
+        old->slots[i & old->mask].load(std::memory_order_relaxed),
+        std::memory_order_relaxed);
+  }
+  ring_.store(bigger, std::memory_order_release);
+  return bigger;
+}
+
+inline task_scheduler &default_task_scheduler() {
+  static task_scheduler scheduler;
+  return scheduler;
+}
+
+}  // namespace s21
@@ -0,0 +1,78 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// thread_pool runs batches of independent tasks on a fixed set of threads.
+//
+// run(tasks, fn) calls fn(i) for every i in [0, tasks) and returns when all
+// calls have finished. The calling thread takes tasks too, so a pool of
+// size() threads starts size() - 1 workers. Tasks are handed out one at a
+// time from a shared counter, which balances uneven tasks.
+//
+// A run() issued from inside a task runs its tasks inline on that thread
+// instead of waiting for workers that are busy with the outer batch.
+class thread_pool {
+ public:
+  explicit thread_pool(
+      size_t threads = 0);  // creates a pool of threads threads, one per
+                            // hardware thread when threads is 0
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+  ~thread_pool();  // joins the workers
+
+  size_t size() const noexcept;  // returns the number of threads that run
+                                 // tasks, the caller included
+
+  template <typename F>
+  void run(size_t tasks,
+           F &&fn);  // calls fn(i) for i in [0, tasks) and waits for all of
+                     // them; rethrows the first exception thrown by fn
+
+ private:
+  // one batch of tasks shared by the caller and the workers
+  struct batch {
+    void (*call)(void *fn, size_t task);
+    void *fn;
+    size_t tasks;
+    std::atomic<size_t> next{0};
+    std::mutex error_mutex;
+    std::exception_ptr error;
+  };
+
+  void stop() noexcept;  // wakes and joins the workers
+  void worker_loop();
+  static void work(batch &b) noexcept;  // takes tasks until none are left
+
+  vector<std::thread> workers_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable idle_;
+  batch *batch_ = nullptr;
+  size_t generation_ = 0;
+  size_t active_ = 0;  // workers inside the current batch
+  bool stop_ = false;
+  std::mutex run_mutex_;  // one batch at a time
+
+  static inline thread_local bool in_task_ = false;
+};
+
+thread_pool &default_thread_pool();  // process-wide pool with one thread per
+                                     // hardware thread
+
+}  // namespace s21
+
+#include "s21_thread_pool.tpp"
+
+#endif
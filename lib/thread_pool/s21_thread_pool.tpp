@@ -0,0 +1,103 @@
+namespace s21 {
+
+inline thread_pool::thread_pool(size_t threads) {
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  workers_.reserve(threads - 1);
+  try {
+    for (size_t i = 1; i < threads; i++) {
+      workers_.emplace_back([this] { worker_loop(); });
+    }
+  } catch (...) {
+    stop();
+    throw;
+  }
+}
+
+inline thread_pool::~thread_pool() { stop(); }
+
+inline size_t thread_pool::size() const noexcept {
+  return workers_.size() + 1;
+}
+
+template <typename F>
+void thread_pool::run(size_t tasks, F &&fn) {
+  if (tasks == 0) return;
+  if (tasks == 1 || workers_.empty() || in_task_) {
+    for (size_t i = 0; i < tasks; i++) fn(i);
+    return;
+  }
+
+  std::lock_guard<std::mutex> serial(run_mutex_);
+  using Fn = std::remove_reference_t<F>;
+  batch b;
+  b.call = [](void *f, size_t task) { (*static_cast<Fn *>(f))(task); };
+  b.fn = const_cast<void *>(static_cast<const void *>(std::addressof(fn)));
+  b.tasks = tasks;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    batch_ = &b;
+    generation_++;
+  }
+  wake_.notify_all();
+
+  work(b);
+
+  {
+    // workers that took the batch finish their task before it goes away
+    std::unique_lock<std::mutex> lock(mutex_);
+    batch_ = nullptr;
+    idle_.wait(lock, [this] { return active_ == 0; });
+  }
+  if (b.error) std::rethrow_exception(b.error);
+}
+
+inline void thread_pool::stop() noexcept {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (std::thread &worker : workers_) worker.join();
+  workers_.clear();
+}
+
+inline void thread_pool::worker_loop() {
+  size_t seen = 0;
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (;;) {
+    wake_.wait(lock, [&] {
+      return stop_ || (batch_ != nullptr && generation_ != seen);
+    });
+    if (stop_) return;
+    seen = generation_;
+    batch *b = batch_;
+    active_++;
+    lock.unlock();
+    work(*b);
+    lock.lock();
+    if (--active_ == 0) idle_.notify_all();
+  }
+}
+
+inline void thread_pool::work(batch &b) noexcept {
+  in_task_ = true;
+  for (size_t task; (task = b.next.fetch_add(1)) < b.tasks;) {
+    try {
+      b.call(b.fn, task);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(b.error_mutex);
+      if (!b.error) b.error = std::current_exception();
+      b.next.store(b.tasks);
+    }
+  }
+  in_task_ = false;
+}
+
+inline thread_pool &default_thread_pool() {
+  static thread_pool pool;
+  return pool;
+}
+
+}  // namespace s21
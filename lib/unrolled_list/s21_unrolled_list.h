@@ -0,0 +1,180 @@
+#ifndef S21_UNROLLED_LIST_H
+#define S21_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_memory.h"
+
+namespace s21 {
+
+// unrolled_list<T, N> is a doubly linked list of nodes that each hold up to
+// N elements in a small array. Walking it touches one node per N elements
+// instead of one node per element, and small payloads do not pay two
+// pointers each. The default N fills a 64-byte cache line with elements.
+//
+// Inserting into a full node splits it in half and erasing merges a node
+// into its neighbour when both fit into half a node, so insert and erase
+// move at most N elements. They invalidate iterators to the elements of the
+// nodes they touch; iterators to other elements stay valid. splice moves
+// whole nodes, so iterators into other keep pointing to the same elements.
+template <typename T, size_t N = std::max<size_t>(4, 64 / sizeof(T))>
+class unrolled_list {
+  static_assert(N >= 2, "unrolled_list needs room for two elements per node");
+
+  struct Node_;
+
+ public:
+  template <bool Const>
+  class basic_iterator;
+
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using iterator = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  static constexpr size_type node_capacity = N;  // elements per node
+
+  unrolled_list();                      // default constructor
+  explicit unrolled_list(size_type n);  // creates the list of n elements
+  unrolled_list(std::initializer_list<value_type> const
+                    &items);            // initializer list constructor
+  unrolled_list(const unrolled_list &l);      // copy constructor
+  unrolled_list(unrolled_list &&l) noexcept;  // move constructor
+  ~unrolled_list();                           // destructor
+
+  unrolled_list &operator=(const unrolled_list &l);  // copy assignment
+  unrolled_list &operator=(unrolled_list &&l) noexcept;  // move assignment
+
+  iterator begin() noexcept;  // returns an iterator to the beginning
+  iterator end() noexcept;    // returns an iterator to the end
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+
+  reference front();  // access the first element
+  reference back();   // access the last element
+  const_reference front() const;
+  const_reference back() const;
+  size_type size() const noexcept;  // returns the number of elements
+  size_type max_size() const noexcept;
+  bool empty() const noexcept;  // checks whether the container is empty
+
+  void push_back(const_reference value);   // adds an element to the end
+  void push_back(value_type &&value);      // moves an element to the end
+  void push_front(const_reference value);  // adds an element to the beginning
+  void push_front(value_type &&value);  // moves an element to the beginning
+  template <typename... Args>
+  reference emplace_back(Args &&...args);  // constructs an element at the end
+  template <typename... Args>
+  reference emplace_front(
+      Args &&...args);  // constructs an element at the beginning
+  template <typename... Args>
+  iterator emplace(const_iterator pos,
+                   Args &&...args);  // constructs an element before pos
+  iterator insert(const_iterator pos,
+                  const_reference value);  // inserts value before pos and
+                                           // returns an iterator to it
+  iterator insert(const_iterator pos,
+                  value_type &&value);  // moves value into place before pos
+  iterator erase(const_iterator pos);   // erases the element at pos and
+                                        // returns an iterator to the next one
+  void pop_back();                      // removes the last element
+  void pop_front();                     // removes the first element
+  void clear() noexcept;                // clears the contents
+  void swap(unrolled_list &other) noexcept;  // swaps the contents
+  void splice(const_iterator pos,
+              unrolled_list &other);  // moves the nodes of other before pos
+
+  bool operator==(const unrolled_list &other) const;
+  bool operator!=(const unrolled_list &other) const;
+
+  // bidirectional iterator over the elements; it keeps the node, the index
+  // inside the node and the list, which end() needs to step back to the tail
+  template <bool Const>
+  class basic_iterator {
+    friend unrolled_list;
+    template <bool>
+    friend class basic_iterator;
+
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+    using list_pointer =
+        std::conditional_t<Const, const unrolled_list *, unrolled_list *>;
+
+    basic_iterator() = default;
+    template <bool Other, typename = std::enable_if_t<Const && !Other>>
+    basic_iterator(const basic_iterator<Other> &other) noexcept
+        : node_(other.node_), index_(other.index_), list_(other.list_) {}
+
+    reference operator*() const { return node_->data()[index_]; }
+    pointer operator->() const { return node_->data() + index_; }
+    basic_iterator &operator++() noexcept;    // prefix
+    basic_iterator operator++(int) noexcept;  // postfix
+    basic_iterator &operator--() noexcept;    // prefix
+    basic_iterator operator--(int) noexcept;  // postfix
+    bool operator==(const basic_iterator &other) const noexcept {
+      return node_ == other.node_ && index_ == other.index_;
+    }
+    bool operator!=(const basic_iterator &other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    basic_iterator(Node_ *node, size_type index, list_pointer list) noexcept
+        : node_(node), index_(index), list_(list) {}
+
+    Node_ *node_ = nullptr;  // nullptr for end()
+    size_type index_ = 0;
+    list_pointer list_ = nullptr;
+  };
+
+ private:
+  struct Node_ {
+    Node_ *next_ = nullptr;
+    Node_ *prev_ = nullptr;
+    size_type count_ = 0;
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+
+    T *data() noexcept { return reinterpret_cast<T *>(storage_); }
+  };
+
+  static void destroy_node(Node_ *node) noexcept;  // destroys the elements
+                                                   // and frees the node
+  template <typename... Args>
+  void emplace_new_node(Node_ *prev, Args &&...args);  // links a node holding
+                                                       // one element after
+                                                       // prev
+  template <typename... Args>
+  static void emplace_in_node(Node_ *node, size_type index,
+                              Args &&...args);  // constructs an element at
+                                                // index of a node with room
+  Node_ *split(Node_ *node, size_type index);  // moves the elements from index
+                                               // on into a new node after node
+  void link_after(Node_ *prev, Node_ *first,
+                  Node_ *last) noexcept;  // inserts the chain [first, last]
+                                          // after prev, at the front for
+                                          // nullptr
+  void unlink(Node_ *node) noexcept;      // takes node out of the chain
+
+  Node_ *head_;
+  Node_ *tail_;
+  size_type size_;
+};
+
+}  // namespace s21
+
+#include "s21_unrolled_list.tpp"
+
+#endif
@@ -0,0 +1,486 @@
+#ifndef S21_UNROLLED_LIST_TPP
+#define S21_UNROLLED_LIST_TPP
+
+#include "s21_unrolled_list.h"
+
+namespace s21 {
+
+// default constructor
+template <typename T, size_t N>
+unrolled_list<T, N>::unrolled_list()
+    : head_(nullptr), tail_(nullptr), size_(0) {}
+
+// creates the list of n value-initialized elements
+template <typename T, size_t N>
+unrolled_list<T, N>::unrolled_list(size_type n) : unrolled_list() {
+  try {
+    for (size_type i = 0; i < n; i++) emplace_back();
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+// initializer list constructor
+template <typename T, size_t N>
+unrolled_list<T, N>::unrolled_list(
+    std::initializer_list<value_type> const &items)
+    : unrolled_list() {
+  try {
+    for (const_reference item : items) emplace_back(item);
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+// copy constructor; the copy packs the elements into full nodes
+template <typename T, size_t N>
+unrolled_list<T, N>::unrolled_list(const unrolled_list &l) : unrolled_list() {
+  try {
+    for (const_reference item : l) emplace_back(item);
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
+
+// move constructor
+template <typename T, size_t N>
+unrolled_list<T, N>::unrolled_list(unrolled_list &&l) noexcept
+    : head_(l.head_), tail_(l.tail_), size_(l.size_) {
+  l.head_ = nullptr;
+  l.tail_ = nullptr;
+  l.size_ = 0;
+}
+
+// destructor
+template <typename T, size_t N>
+unrolled_list<T, N>::~unrolled_list() {
+  clear();
+}
+
+// copy assignment
+template <typename T, size_t N>
+unrolled_list<T, N> &unrolled_list<T, N>::operator=(const unrolled_list &l) {
+  if (this != &l) {
+    unrolled_list copy(l);
+    swap(copy);
+  }
+  return *this;
+}
+
+// move assignment
+template <typename T, size_t N>
+unrolled_list<T, N> &unrolled_list<T, N>::operator=(
+    unrolled_list &&l) noexcept {
+  if (this != &l) {
+    clear();
+    swap(l);
+  }
+  return *this;
+}
+
+// returns an iterator to the beginning
+template <typename T, size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::begin() noexcept {
+  return iterator(head_, 0, this);
+}
+
+// returns an iterator to the end
+template <typename T, size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::end() noexcept {
+  return iterator(nullptr, 0, this);
+}
+
+template <typename T, size_t N>
+typename unrolled_list<T, N>::const_iterator unrolled_list<T, N>::begin()
+    const noexcept {
+  return const_iterator(head_, 0, this);
+}
+
+template <typename T, size_t N>
+typename unrolled_list<T, N>::const_iterator unrolled_list<T, N>::end()
+    const noexcept {
+  return const_iterator(nullptr, 0, this);
+}
+
+// access the first element
+template <typename T, size_t N>
+typename unrolled_list<T, N>::reference unrolled_list<T, N>::front() {
+  if (empty()) throw std::out_of_range("Error! unrolled_list is empty");
+  return head_->data()[0];
+}
+
+// access the last element
+template <typename T, size_t N>
+typename unrolled_list<T, N>::reference unrolled_list<T, N>::back() {
+  if (empty()) throw std::out_of_range("Error! unrolled_list is empty");
+  return tail_->data()[tail_->count_ - 1];
+}
+
+template <typename T, size_t N>
+typename unrolled_list<T, N>::const_reference unrolled_list<T, N>::front()
+    const {
+  return const_cast<unrolled_list *>(this)->front();
+}
+
+template <typename T, size_t N>
+typename unrolled_list<T, N>::const_reference unrolled_list<T, N>::back()
+    const {
+  return const_cast<unrolled_list *>(this)->back();
+}
+
+// returns the number of elements
+template <typename T, size_t N>
+typename unrolled_list<T, N>::size_type unrolled_list<T, N>::size()
+    const noexcept {
+  return size_;
+}
+
+// returns the maximum possible number of elements
+template <typename T, size_t N>
+typename unrolled_list<T, N>::size_type unrolled_list<T, N>::max_size()
+    const noexcept {
+  size_type bits = (sizeof(void *) == 4) ? 31 : 63;
+  return (static_cast<size_type>(1) << bits) / sizeof(Node_) * N;
+}
+
+// checks whether the container is empty
+template <typename T, size_t N>
+bool unrolled_list<T, N>::empty() const noexcept {
+  return size_ == 0;
+}
+
+// adds an element to the end
+template <typename T, size_t N>
+void unrolled_list<T, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+// moves an element to the end
+template <typename T, size_t N>
+void unrolled_list<T, N>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+// adds an element to the beginning
+template <typename T, size_t N>
+void unrolled_list<T, N>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+// moves an element to the beginning
+template <typename T, size_t N>
+void unrolled_list<T, N>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+// constructs an element at the end
+template <typename T, size_t N>
+template <typename... Args>
+typename unrolled_list<T, N>::reference unrolled_list<T, N>::emplace_back(
+    Args &&...args) {
+  if (tail_ && tail_->count_ < N) {
+    ::new (static_cast<void *>(tail_->data() + tail_->count_))
+        T(std::forward<Args>(args)...);
+    tail_->count_++;
+    size_++;
+  } else {
+    emplace_new_node(tail_, std::forward<Args>(args)...);
+  }
+  return tail_->data()[tail_->count_ - 1];
+}
+
+// constructs an element at the beginning
+template <typename T, size_t N>
+template <typename... Args>
+typename unrolled_list<T, N>::reference unrolled_list<T, N>::emplace_front(
+    Args &&...args) {
+  return *emplace(begin(), std::forward<Args>(args)...);
+}
+
+// constructs an element before pos; a full node gets a new neighbour when pos
+// is at one of its ends and is split in half otherwise
+template <typename T, size_t N>
+template <typename... Args>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::emplace(
+    const_iterator pos, Args &&...args) {
+  Node_ *node = pos.node_;
+  size_type index = pos.index_;
+  if (node == nullptr) {
+    node = tail_;
+    index = node ? node->count_ : 0;
+  } else if (index == 0 && node->prev_ && node->prev_->count_ < N) {
+    node = node->prev_;
+    index = node->count_;
+  }
+  if (node == nullptr || node->count_ == N) {
+    if (node == nullptr || index == N) {
+      emplace_new_node(node, std::forward<Args>(args)...);
+      return iterator(node ? node->next_ : head_, 0, this);
+    }
+    if (index == 0) {
+      emplace_new_node(node->prev_, std::forward<Args>(args)...);
+      return iterator(node->prev_, 0, this);
+    }
+    split(node, N / 2);
+    if (index > N / 2) {
+      node = node->next_;
+      index -= N / 2;
+    }
+  }
+  emplace_in_node(node, index, std::forward<Args>(args)...);
+  size_++;
+  return iterator(node, index, this);
+}
+
+// inserts value before pos and returns an iterator to it
+template <typename T, size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::insert(
+    const_iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+// moves value into place before pos
+template <typename T, size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::insert(
+    const_iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+// erases the element at pos and returns an iterator to the next one; a node
+// that shrinks to fit into half a node together with its successor absorbs
+// it
+template <typename T, size_t N>
+typename unrolled_list<T, N>::iterator unrolled_list<T, N>::erase(
+    const_iterator pos) {
+  if (empty() || pos == end()) {
+    throw std::out_of_range("Error! You can't erase this element");
+  }
+  Node_ *node = pos.node_;
+  size_type index = pos.index_;
+  T *data = node->data();
+  data[index].~T();
+  relocate_forward(data + index + 1, data + node->count_, data + index);
+  node->count_--;
+  size_--;
+  if (node->count_ == 0) {
+    Node_ *next = node->next_;
+    unlink(node);
+    destroy_node(node);
+    return iterator(next, 0, this);
+  }
+  Node_ *next = node->next_;
+  if (next && node->count_ + next->count_ <= N / 2) {
+    uninitialized_relocate(next->data(), next->data() + next->count_,
+                           data + node->count_);
+    node->count_ += next->count_;
+    next->count_ = 0;
+    unlink(next);
+    destroy_node(next);
+  }
+  if (index < node->count_) return iterator(node, index, this);
+  return iterator(node->next_, 0, this);
+}
+
+// removes the last element
+template <typename T, size_t N>
+void unrolled_list<T, N>::pop_back() {
+  if (empty()) throw std::out_of_range("Error! unrolled_list is empty");
+  erase(const_iterator(tail_, tail_->count_ - 1, this));
+}
+
+// removes the first element
+template <typename T, size_t N>
+void unrolled_list<T, N>::pop_front() {
+  erase(begin());
+}
+
+// clears the contents
+template <typename T, size_t N>
+void unrolled_list<T, N>::clear() noexcept {
+  while (head_) {
+    Node_ *next = head_->next_;
+    destroy_node(head_);
+    head_ = next;
+  }
+  tail_ = nullptr;
+  size_ = 0;
+}
+
+// swaps the contents
+template <typename T, size_t N>
+void unrolled_list<T, N>::swap(unrolled_list &other) noexcept {
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+  std::swap(size_, other.size_);
+}
+
+// moves the nodes of other before pos; only the node that pos points into
+// is split, so this costs O(N) element moves whatever the size of other
+template <typename T, size_t N>
+void unrolled_list<T, N>::splice(const_iterator pos, unrolled_list &other) {
+  if (this == &other || other.empty()) return;
+  Node_ *prev = tail_;
+  if (pos.node_) {
+    prev = pos.node_->prev_;
+    if (pos.index_ > 0) {
+      split(pos.node_, pos.index_);
+      prev = pos.node_;
+    }
+  }
+  link_after(prev, other.head_, other.tail_);
+  size_ += other.size_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.size_ = 0;
+}
+
+template <typename T, size_t N>
+bool unrolled_list<T, N>::operator==(const unrolled_list &other) const {
+  return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+}
+
+template <typename T, size_t N>
+bool unrolled_list<T, N>::operator!=(const unrolled_list &other) const {
+  return !(*this == other);
+}
+
+// destroys the elements and frees the node
+template <typename T, size_t N>
+void unrolled_list<T, N>::destroy_node(Node_ *node) noexcept {
+  destroy(node->data(), node->data() + node->count_);
+  delete node;
+}
+
+// links a node holding one element after prev
+template <typename T, size_t N>
+template <typename... Args>
+void unrolled_list<T, N>::emplace_new_node(Node_ *prev, Args &&...args) {
+  Node_ *node = new Node_;
+  try {
+    ::new (static_cast<void *>(node->data())) T(std::forward<Args>(args)...);
+  } catch (...) {
+    delete node;
+    throw;
+  }
+  node->count_ = 1;
+  link_after(prev, node, node);
+  size_++;
+}
+
+// constructs an element at index of a node with room, shifting the elements
+// from index on by one; the element is built first so that a throwing
+// constructor leaves the node untouched
+template <typename T, size_t N>
+template <typename... Args>
+void unrolled_list<T, N>::emplace_in_node(Node_ *node, size_type index,
+                                          Args &&...args) {
+  T *data = node->data();
+  if (index == node->count_) {
+    ::new (static_cast<void *>(data + index)) T(std::forward<Args>(args)...);
+  } else {
+    T value(std::forward<Args>(args)...);
+    relocate_backward(data + index, data + node->count_,
+                      data + node->count_ + 1);
+    ::new (static_cast<void *>(data + index)) T(std::move(value));
+  }
+  node->count_++;
+}
+
+// moves the elements from index on into a new node linked after node
+template <typename T, size_t N>
+typename unrolled_list<T, N>::Node_ *unrolled_list<T, N>::split(
+    Node_ *node, size_type index) {
+  Node_ *rest = new Node_;
+  uninitialized_relocate(node->data() + index, node->data() + node->count_,
+                         rest->data());
+  rest->count_ = node->count_ - index;
+  node->count_ = index;
+  link_after(node, rest, rest);
+  return rest;
+}
+
+// inserts the chain [first, last] after prev, at the front for nullptr
+template <typename T, size_t N>
+void unrolled_list<T, N>::link_after(Node_ *prev, Node_ *first,
+                                     Node_ *last) noexcept {
+  Node_ *next = prev ? prev->next_ : head_;
+  first->prev_ = prev;
+  last->next_ = next;
+  if (prev) {
+    prev->next_ = first;
+  } else {
+    head_ = first;
+  }
+  if (next) {
+    next->prev_ = last;
+  } else {
+    tail_ = last;
+  }
+}
+
+// takes node out of the chain
+template <typename T, size_t N>
+void unrolled_list<T, N>::unlink(Node_ *node) noexcept {
+  if (node->prev_) {
+    node->prev_->next_ = node->next_;
+  } else {
+    head_ = node->next_;
+  }
+  if (node->next_) {
+    node->next_->prev_ = node->prev_;
+  } else {
+    tail_ = node->prev_;
+  }
+}
+
+template <typename T, size_t N>
+template <bool Const>
+typename unrolled_list<T, N>::template basic_iterator<Const>
+    &unrolled_list<T, N>::basic_iterator<Const>::operator++() noexcept {
+  if (++index_ == node_->count_) {
+    node_ = node_->next_;
+    index_ = 0;
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+template <bool Const>
+typename unrolled_list<T, N>::template basic_iterator<Const>
+unrolled_list<T, N>::basic_iterator<Const>::operator++(int) noexcept {
+  basic_iterator copy = *this;
+  ++*this;
+  return copy;
+}
+
+template <typename T, size_t N>
+template <bool Const>
+typename unrolled_list<T, N>::template basic_iterator<Const>
+    &unrolled_list<T, N>::basic_iterator<Const>::operator--() noexcept {
+  if (node_ == nullptr) {
+    node_ = list_->tail_;
+    index_ = node_->count_ - 1;
+  } else if (index_ == 0) {
+    node_ = node_->prev_;
+    index_ = node_->count_ - 1;
+  } else {
+    index_--;
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+template <bool Const>
+typename unrolled_list<T, N>::template basic_iterator<Const>
+unrolled_list<T, N>::basic_iterator<Const>::operator--(int) noexcept {
+  basic_iterator copy = *this;
+  --*this;
+  return copy;
+}
+
+}  // namespace s21
+
+#endif
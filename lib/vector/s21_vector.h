@@ -1,10 +1,33 @@
 #ifndef S21_VECTOR_H
 #define S21_VECTOR_H
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_memory.h"
+#include "s21_vector_growth.h"
+
 namespace s21 {
 
-template <typename T>
-class vector {
+// Storage comes from Allocator, any std::allocator-compatible allocator of T
+// whose pointer type is a plain T *. Large buffers are mapped pages only with
+// the default std::allocator; any other allocator sees every buffer.
+template <typename T, typename Growth = growth_double,
+          typename Allocator = std::allocator<T>>
+class vector : private vector_stats_counter<Growth::track_stats>,
+               private allocator_holder<Allocator> {
+  static_assert(std::is_same<typename Allocator::value_type, T>::value,
+                "Error! vector needs an allocator of its value_type");
+
  public:
   using value_type = T;
   using reference = T &;
@@ -12,18 +35,33 @@ class vector {
   using size_type = size_t;
   using iterator = T *;
   using const_iterator = const T *;
+  using allocator_type = Allocator;
+
+  vector();  // default constructor
+  explicit vector(
+      const Allocator &alloc) noexcept;  // empty vector that allocates
+                                         // from alloc
+  explicit vector(size_type n, const Allocator &alloc =
+                                   Allocator());  // parameterized constructor
+  explicit vector(std::initializer_list<value_type> const &items,
+                  const Allocator &alloc =
+                      Allocator());  // initializer list constructor
+  vector(const vector &v);           // copy constructor
+  vector(const vector &v,
+         const Allocator &alloc);  // copy constructor allocating from alloc
+  vector(vector &&v) noexcept;     // move constructor
+  vector(vector &&v,
+         const Allocator &alloc);  // takes the buffer of v when alloc can
+                                   // free it, moves the elements otherwise
+  ~vector();                       // destructor
 
-  vector();                      // default constructor
-  explicit vector(size_type n);  // parameterized constructor
-  explicit vector(std::initializer_list<value_type> const
-                      &items);  // initializer list constructor
-  vector(const vector &v);      // copy constructor
-  vector(vector &&v) noexcept;  // move constructor
-  ~vector();                    // destructor
+  vector &operator=(vector &&v) noexcept(
+      allocator_moves_storage_v<Allocator>);  // assignment operator overload
+                                              // for moving object
 
-  vector &operator=(
-      vector &&v) noexcept;  // assignment operator overload for moving object
+  allocator_type get_allocator() const noexcept;  // returns the allocator
   reference operator[](size_type pos);  // access specified element
+  const_reference operator[](size_type pos) const;
 
   reference at(size_type pos);  // access specified element with bounds checking
 
@@ -50,10 +88,46 @@ class vector {
       iterator pos,
       const_reference value);  // inserts elements into concrete pos and returns
                                // the iterator that points to the new element
-  void erase(iterator pos);    // erases element at pos
+  iterator insert(iterator pos,
+                  value_type &&value);  // moves value into concrete pos
+  iterator insert(const_iterator pos, size_type count,
+                  const_reference value);  // inserts count copies of value
+                                           // before pos
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  iterator insert(const_iterator pos, InputIt first,
+                  InputIt last);  // inserts elements from range [first, last)
+                                  // before pos
+  template <typename Range>
+  void append_range(Range &&range);  // appends elements of range to the end
+  void assign(size_type count,
+              const_reference value);  // replaces the contents with count
+                                       // copies of value
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+  void assign(InputIt first, InputIt last);  // replaces the contents with
+                                             // elements from [first, last)
+  void resize(size_type count);  // changes the number of elements stored
+  void resize(size_type count,
+              const_reference value);  // changes the number of elements
+                                       // stored, appending copies of value
+  void erase(iterator pos);             // erases element at pos
   void push_back(const_reference value);  // adds an element to the end
+  void push_back(value_type &&value);     // moves an element to the end
   bool empty() const noexcept;  // checks whether the container is empty
 
+  template <typename... Args>
+  iterator emplace(const_iterator pos,
+                   Args &&...args);  // constructs an element in place directly
+                                     // before pos
+  template <typename... Args>
+  reference emplace_back(
+      Args &&...args);  // constructs an element in place at the end
+
+  // reallocation counters of this vector object when the growth policy
+  // tracks them, zeros otherwise
+  using vector_stats_counter<Growth::track_stats>::stats;
+
   // additional
   const_iterator begin()
       const noexcept;  // returns a const iterator to the beginning
@@ -63,18 +137,58 @@ class vector {
   template <typename... Args>
   iterator insert_many(const_iterator pos,
                        Args &&...args);  // Inserts new elements into the
-                                         // container directly before pos
+                                         // container directly before pos
 
   template <typename... Args>
   void insert_many_back(
       Args &&...args);  // Appends new elements to the end of the container
 
  private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  using allocator_holder<Allocator>::allocator;
+
+  static constexpr bool uses_large_buffers() noexcept {
+    return Growth::large_buffers && is_trivially_relocatable<T>::value &&
+           std::is_same<Allocator, std::allocator<T>>::value;
+  }
+  T *allocate(size_type n);  // raw storage for n elements
+  void deallocate(T *ptr,
+                  size_type n) noexcept;  // frees raw storage
+  void swap_storage(vector &other) noexcept;  // swaps the buffers, keeping
+                                              // the allocators
+  void take_storage(vector &v) noexcept;  // frees the buffer and takes the
+                                          // one of v, whose allocator can
+                                          // free it
+  static constexpr bool is_large(
+      size_type n) noexcept;  // checks whether storage of n elements is a
+                              // mapped large buffer
+  bool can_remap(size_type new_capacity)
+      const noexcept;  // checks whether the buffer can grow in place
+  void reallocate(size_type new_capacity);  // moves the elements to storage
+                                            // of new_capacity elements
+  size_type next_capacity(
+      size_type required) const;  // capacity for growing to hold required
+                                  // elements
+  T *open_gap(size_type index,
+              size_type count);  // turns [index, index + count) into raw
+                                 // storage with one tail shift
+  void close_gap(size_type index,
+                 size_type count) noexcept;  // undoes open_gap
+
   T *data_;
   size_type capacity_;
   size_type size_;
 };
 
+namespace pmr {
+
+// vector whose buffer comes from a std::pmr::memory_resource picked per
+// instance
+template <typename T, typename Growth = growth_double>
+using vector = s21::vector<T, Growth, std::pmr::polymorphic_allocator<T>>;
+
+}  // namespace pmr
+
 }  // namespace s21
 
 #include "s21_vector.tpp"
@@ -84,4 +198,4 @@ class vector {
 //   T& reference;
 //   const T& const_reference;
 //   T* iterator;
-//   const T* const_iterator;
\ No newline at end of file
+//   const T* const_iterator;
@@ -6,253 +6,642 @@
 namespace s21 {
 
 // default constructor
-template <typename T>
-vector<T>::vector() : data_(nullptr), capacity_(0), size_(0) {}
+template <typename T, typename Growth, typename Allocator>
+vector<T, Growth, Allocator>::vector() : vector(Allocator()) {}
+
+// empty vector that allocates from alloc
+template <typename T, typename Growth, typename Allocator>
+vector<T, Growth, Allocator>::vector(const Allocator &alloc) noexcept
+    : allocator_holder<Allocator>(alloc),
+      data_(nullptr),
+      capacity_(0),
+      size_(0) {}
 
 // parameterized constructor
-template <typename T>
-vector<T>::vector(size_type n) {
-  data_ = new T[n]();
-  size_ = n;
+template <typename T, typename Growth, typename Allocator>
+vector<T, Growth, Allocator>::vector(size_type n, const Allocator &alloc)
+    : vector(alloc) {
+  data_ = allocate(n);
   capacity_ = n;
+  for (; size_ < n; size_++) ::new (static_cast<void *>(data_ + size_)) T();
 }
 
 // initializer list constructor
-template <typename T>
-vector<T>::vector(std::initializer_list<value_type> const &items) {
-  data_ = new value_type[items.size()]();
-  size_ = items.size();
+template <typename T, typename Growth, typename Allocator>
+vector<T, Growth, Allocator>::vector(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : vector(alloc) {
+  data_ = allocate(items.size());
   capacity_ = items.size();
-  std::copy(items.begin(), items.end(), data_);
+  size_ = s21::uninitialized_copy(items.begin(), items.end(), data_) - data_;
 }
 
-// copy constructor
-template <typename T>
-vector<T>::vector(const vector &v) : capacity_(v.capacity_) {
-  size_ = v.size_;
-  data_ = new value_type[v.size_]();
-  for (size_type i = 0; i < v.size_; i++) {
-    data_[i] = v.data_[i];
-  }
+// copy constructor; the allocator is the one the allocator of v picks for
+// copies
+template <typename T, typename Growth, typename Allocator>
+vector<T, Growth, Allocator>::vector(const vector &v)
+    : vector(v, alloc_traits::select_on_container_copy_construction(
+                    v.allocator())) {}
+
+// copy constructor allocating from alloc
+template <typename T, typename Growth, typename Allocator>
+vector<T, Growth, Allocator>::vector(const vector &v, const Allocator &alloc)
+    : vector(alloc) {
+  data_ = allocate(v.size_);
+  capacity_ = v.size_;
+  size_ = s21::uninitialized_copy(v.data_, v.data_ + v.size_, data_) - data_;
 }
 
 // move constructor
-template <typename T>
-vector<T>::vector(vector &&v) noexcept : capacity_(v.capacity_) {
-  size_ = v.size_;
-  data_ = std::move(v.data_);
-  v.size_ = 0;
-  v.capacity_ = 0;
-  v.data_ = nullptr;
+template <typename T, typename Growth, typename Allocator>
+vector<T, Growth, Allocator>::vector(vector &&v) noexcept
+    : vector(v.allocator()) {
+  swap_storage(v);
+}
+
+// takes the buffer of v when alloc can free it, moves the elements into a
+// buffer from alloc otherwise
+template <typename T, typename Growth, typename Allocator>
+vector<T, Growth, Allocator>::vector(vector &&v, const Allocator &alloc)
+    : vector(alloc) {
+  if (allocators_equal(allocator(), v.allocator())) {
+    swap_storage(v);
+  } else {
+    data_ = allocate(v.size_);
+    capacity_ = v.size_;
+    std::uninitialized_move(v.data_, v.data_ + v.size_, data_);
+    size_ = v.size_;
+  }
 }
 
 // destructor
-template <typename T>
-vector<T>::~vector() {
-  delete[] data_;
+template <typename T, typename Growth, typename Allocator>
+vector<T, Growth, Allocator>::~vector() {
+  s21::destroy(data_, data_ + size_);
+  deallocate(data_, capacity_);
   size_ = 0;
   capacity_ = 0;
   data_ = nullptr;
 }
 
-// assignment operator overload for moving object
-template <typename T>
-vector<T> &vector<T>::operator=(vector &&v) noexcept {
-  this->swap(v);
-  delete[] v.data_;
-  v.size_ = 0;
-  v.capacity_ = 0;
-  v.data_ = nullptr;
+// assignment operator overload for moving object; with unequal allocators
+// that stay put the elements are moved one by one into this buffer
+template <typename T, typename Growth, typename Allocator>
+vector<T, Growth, Allocator> &
+vector<T, Growth, Allocator>::operator=(
+    vector &&v) noexcept(allocator_moves_storage_v<Allocator>) {
+  if (this == &v) return *this;
+  if constexpr (allocator_moves_storage_v<Allocator>) {
+    take_storage(v);
+  } else if (allocators_equal(allocator(), v.allocator())) {
+    take_storage(v);
+  } else {
+    assign(std::make_move_iterator(v.data_),
+           std::make_move_iterator(v.data_ + v.size_));
+  }
   return *this;
 }
 
+// returns the allocator
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::allocator_type
+vector<T, Growth, Allocator>::get_allocator() const noexcept {
+  return allocator();
+}
+
 // access specified element
-template <typename T>
-typename vector<T>::reference vector<T>::operator[](size_type pos) {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::reference
+vector<T, Growth, Allocator>::operator[](size_type pos) {
+  return data_[pos];
+}
+
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::const_reference
+vector<T, Growth, Allocator>::operator[](size_type pos) const {
   return data_[pos];
 }
 
 // access specified element with bounds checking
-template <typename T>
-typename vector<T>::reference vector<T>::at(size_type pos) {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::reference
+vector<T, Growth, Allocator>::at(size_type pos) {
   if (pos >= size_)
     throw std::out_of_range("Error! Position of value is out of range");
   return data_[pos];
 }
 
 // direct access to the underlying array
-template <typename T>
-typename vector<T>::iterator vector<T>::data() noexcept {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::iterator
+vector<T, Growth, Allocator>::data() noexcept {
   return (size() == 0) ? nullptr : data_;
 }
 
 // swaps the contents
-template <typename T>
-void vector<T>::swap(vector &other) noexcept {
-  std::swap(data_, other.data_);
-  std::swap(size_, other.size_);
-  std::swap(capacity_, other.capacity_);
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::swap(vector &other) noexcept {
+  if constexpr (alloc_traits::propagate_on_container_swap::value) {
+    using std::swap;
+    swap(allocator(), other.allocator());
+  }
+  swap_storage(other);
 }
 
 // returns the number of elements that can be held in currently allocated
 // storage
-template <typename T>
-typename vector<T>::size_type vector<T>::capacity() const noexcept {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::size_type
+vector<T, Growth, Allocator>::capacity() const noexcept {
   return capacity_;
 }
 
 // clears the contents
-template <typename T>
-void vector<T>::clear() {
-  delete[] data_;
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::clear() {
+  s21::destroy(data_, data_ + size_);
   size_ = 0;
-  data_ = nullptr;
 }
 
 // returns an iterator to the beginning
-template <typename T>
-typename vector<T>::iterator vector<T>::begin() noexcept {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::iterator
+vector<T, Growth, Allocator>::begin() noexcept {
   return empty() ? end() : data_;
 }
 
 // returns a const iterator to the beginning
-template <typename T>
-typename vector<T>::const_iterator vector<T>::begin() const noexcept {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::const_iterator
+vector<T, Growth, Allocator>::begin() const noexcept {
   return empty() ? end() : data_;
 }
 
 // returns an iterator to the end
-template <typename T>
-typename vector<T>::iterator vector<T>::end() noexcept {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::iterator
+vector<T, Growth, Allocator>::end() noexcept {
   return data_ + size();
 }
 
 // returns a const iterator to the end
-template <typename T>
-typename vector<T>::const_iterator vector<T>::end() const noexcept {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::const_iterator
+vector<T, Growth, Allocator>::end() const noexcept {
   return data_ + size();
 }
 
 // allocate storage of size elements and copies current array elements to a
 // newely allocated array
-template <typename T>
-void vector<T>::reserve(size_type size) {
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::reserve(size_type size) {
   if (size > max_size())
     throw std::length_error("Size of reserving storage is unavailable");
-  if (size > capacity_) {
-    T *data_tmp = new T[size]();
-    std::move(data_, data_ + this->size_, data_tmp);
-    delete[] data_;
-    data_ = data_tmp;
-    capacity_ = size;
-  }
+  if (size > capacity_) reallocate(size);
 }
 
 // reduces memory usage by freeing unused memory
-template <typename T>
-void vector<T>::shrink_to_fit() {
-  if (capacity_ > size_) {
-    T *data_tmp = new T[size_];
-    std::move(data_, data_ + size_, data_tmp);
-    delete[] data_;
-    data_ = data_tmp;
-    capacity_ = size_;
-  }
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::shrink_to_fit() {
+  if (capacity_ > size_) reallocate(size_);
 }
 
 // inserts elements into concrete pos and returns the iterator that points to
 // the new element
-template <typename T>
-typename vector<T>::iterator vector<T>::insert(iterator pos,
-                                               const_reference value) {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::iterator
+vector<T, Growth, Allocator>::insert(iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+// moves value into concrete pos and returns the iterator that points to the
+// new element
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::iterator
+vector<T, Growth, Allocator>::insert(iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+// inserts count copies of value before pos and returns the iterator that
+// points to the first inserted element
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::iterator
+vector<T, Growth, Allocator>::insert(const_iterator pos, size_type count,
+                                     const_reference value) {
+  size_type index = pos - begin();
+  if (count > 0) {
+    if (&value >= data_ && &value < data_ + size_) {
+      // value lives in this vector and would move together with the tail
+      value_type copy(value);
+      return insert(pos, count, copy);
+    }
+    T *gap = open_gap(index, count);
+    try {
+      std::uninitialized_fill_n(gap, count, value);
+    } catch (...) {
+      close_gap(index, count);
+      throw;
+    }
+    size_ += count;
+  }
+  return begin() + index;
+}
+
+// inserts elements from range [first, last) before pos and returns the
+// iterator that points to the first inserted element; the range must not
+// point into this vector
+template <typename T, typename Growth, typename Allocator>
+template <typename InputIt, typename>
+typename vector<T, Growth, Allocator>::iterator
+vector<T, Growth, Allocator>::insert(const_iterator pos, InputIt first,
+                                     InputIt last) {
   size_type index = pos - begin();
-  if (this->size_ == capacity_) {
-    reserve(capacity_ == 0                               ? 1
-            : (this->max_size() - capacity_) > capacity_ ? capacity_ * 2
-                                                         : this->max_size());
+  if constexpr (is_forward_iterator<InputIt>::value) {
+    size_type count = std::distance(first, last);
+    if (count > 0) {
+      T *gap = open_gap(index, count);
+      try {
+        std::uninitialized_copy(first, last, gap);
+      } catch (...) {
+        close_gap(index, count);
+        throw;
+      }
+      size_ += count;
+    }
+  } else {
+    // a single-pass range can't be measured: append it, then rotate in place
+    size_type old_size = size_;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(data_ + index, data_ + old_size, data_ + size_);
+  }
+  return begin() + index;
+}
+
+// appends elements of range to the end
+template <typename T, typename Growth, typename Allocator>
+template <typename Range>
+void vector<T, Growth, Allocator>::append_range(Range &&range) {
+  insert(end(), std::begin(range), std::end(range));
+}
+
+// replaces the contents with count copies of value
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::assign(size_type count,
+                                          const_reference value) {
+  if (count > capacity_) {
+    vector tmp(allocator());
+    tmp.reserve(count);
+    std::uninitialized_fill_n(tmp.data_, count, value);
+    tmp.size_ = count;
+    swap_storage(tmp);
+  } else {
+    std::fill_n(data_, std::min(count, size_), value);
+    if (count > size_) {
+      std::uninitialized_fill_n(data_ + size_, count - size_, value);
+    } else {
+      s21::destroy(data_ + count, data_ + size_);
+    }
+    size_ = count;
+  }
+}
+
+// replaces the contents with elements from [first, last)
+template <typename T, typename Growth, typename Allocator>
+template <typename InputIt, typename>
+void vector<T, Growth, Allocator>::assign(InputIt first, InputIt last) {
+  if constexpr (is_forward_iterator<InputIt>::value) {
+    size_type count = std::distance(first, last);
+    if (count > capacity_) {
+      vector tmp(allocator());
+      tmp.reserve(count);
+      tmp.size_ = std::uninitialized_copy(first, last, tmp.data_) - tmp.data_;
+      swap_storage(tmp);
+    } else if (count > size_) {
+      InputIt middle = std::next(first, size_);
+      std::copy(first, middle, data_);
+      std::uninitialized_copy(middle, last, data_ + size_);
+      size_ = count;
+    } else {
+      std::copy(first, last, data_);
+      s21::destroy(data_ + count, data_ + size_);
+      size_ = count;
+    }
+  } else {
+    clear();
+    for (; first != last; ++first) emplace_back(*first);
   }
-  iterator new_pos = begin() + index;
-  for (size_type i = size_; i > index; i--) {
-    data_[i] = data_[i - 1];
+}
+
+// changes the number of elements stored, value-initializing new elements
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::resize(size_type count) {
+  if (count > capacity_) reserve(next_capacity(count));
+  for (; size_ < count; size_++) ::new (static_cast<void *>(data_ + size_)) T();
+  if (count < size_) {
+    s21::destroy(data_ + count, data_ + size_);
+    size_ = count;
+  }
+}
+
+// changes the number of elements stored, appending copies of value
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::resize(size_type count,
+                                          const_reference value) {
+  if (count > size_) {
+    insert(end(), count - size_, value);
+  } else {
+    s21::destroy(data_ + count, data_ + size_);
+    size_ = count;
+  }
+}
+
+// constructs an element in place directly before pos and returns the iterator
+// that points to the new element
+template <typename T, typename Growth, typename Allocator>
+template <typename... Args>
+typename vector<T, Growth, Allocator>::iterator
+vector<T, Growth, Allocator>::emplace(const_iterator pos, Args &&...args) {
+  size_type index = pos - begin();
+  if constexpr (is_trivially_relocatable<T>::value) {
+    // build the value aside, so args may refer to elements of this vector,
+    // then open the gap and drop the value's bytes into it
+    alignas(T) unsigned char value[sizeof(T)];
+    ::new (static_cast<void *>(value)) T(std::forward<Args>(args)...);
+    try {
+      open_gap(index, 1);
+    } catch (...) {
+      reinterpret_cast<T *>(value)->~T();
+      throw;
+    }
+    std::memcpy(static_cast<void *>(data_ + index), value, sizeof(T));
+  } else if (size_ == capacity_) {
+    // the new element is built before the old buffer is released, so args
+    // may safely refer to elements of this vector
+    size_type new_capacity = next_capacity(size_ + 1);
+    T *data_tmp = allocate(new_capacity);
+    try {
+      ::new (static_cast<void *>(data_tmp + index))
+          T(std::forward<Args>(args)...);
+    } catch (...) {
+      deallocate(data_tmp, new_capacity);
+      throw;
+    }
+    s21::uninitialized_relocate(data_, data_ + index, data_tmp);
+    s21::uninitialized_relocate(data_ + index, data_ + size_,
+                                data_tmp + index + 1);
+    deallocate(data_, capacity_);
+    if (capacity_ != 0) this->count_reallocation(size_ * sizeof(T));
+    data_ = data_tmp;
+    capacity_ = new_capacity;
+  } else if (index == size_) {
+    ::new (static_cast<void *>(data_ + size_)) T(std::forward<Args>(args)...);
+  } else {
+    T value(std::forward<Args>(args)...);
+    ::new (static_cast<void *>(data_ + size_)) T(std::move(data_[size_ - 1]));
+    std::move_backward(data_ + index, data_ + size_ - 1, data_ + size_);
+    data_[index] = std::move(value);
   }
-  *new_pos = value;
   size_++;
-  return new_pos;
+  return data_ + index;
 }
 
 // erases element at pos
-template <typename T>
-void vector<T>::erase(iterator pos) {
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::erase(iterator pos) {
   size_type index = pos - begin();
-  for (size_t i = index; i < size_ - 1; i++) {
-    data_[i] = data_[i + 1];
+  if constexpr (is_trivially_relocatable<T>::value) {
+    data_[index].~T();
+    s21::relocate_forward(data_ + index + 1, data_ + size_, data_ + index);
+  } else {
+    std::move(data_ + index + 1, data_ + size_, data_ + index);
+    data_[size_ - 1].~T();
   }
   size_--;
 }
 
 // access the last element
-template <typename T>
-typename vector<T>::const_reference vector<T>::back() const {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::const_reference
+vector<T, Growth, Allocator>::back() const {
   return *(end() - 1);
 }
 
 // returns the maximum possible number of elements
-template <typename T>
-typename vector<T>::size_type vector<T>::max_size() const noexcept {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::size_type
+vector<T, Growth, Allocator>::max_size() const noexcept {
   size_type bits = (sizeof(void *) == 4) ? 31 : 63;
   return (static_cast<size_type>(1) << bits) / sizeof(value_type) - 1;
 }
 
 // removes the last element
-template <typename T>
-void vector<T>::pop_back() {
-  erase(end() - 1);
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::pop_back() {
+  data_[size_ - 1].~T();
+  size_--;
 }
 
 // returns the number of elements
-template <typename T>
-typename vector<T>::size_type vector<T>::size() const noexcept {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::size_type
+vector<T, Growth, Allocator>::size() const noexcept {
   return size_;
 }
 
 // access the first element
-template <typename T>
-typename vector<T>::const_reference vector<T>::front() const {
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::const_reference
+vector<T, Growth, Allocator>::front() const {
   return *begin();
 }
 
 // checks whether the container is empty
-template <typename T>
-bool vector<T>::empty() const noexcept {
+template <typename T, typename Growth, typename Allocator>
+bool vector<T, Growth, Allocator>::empty() const noexcept {
   return !static_cast<bool>(size());
 }
 
 // adds an element to the end
-template <typename T>
-void vector<T>::push_back(const_reference value) {
-  insert(end(), value);
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+// moves an element to the end
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+// constructs an element in place at the end
+template <typename T, typename Growth, typename Allocator>
+template <typename... Args>
+typename vector<T, Growth, Allocator>::reference
+vector<T, Growth, Allocator>::emplace_back(Args &&...args) {
+  return *emplace(end(), std::forward<Args>(args)...);
 }
 
 // bonus part
 
 // Inserts new elements into the container directly before pos
-template <typename T>
+template <typename T, typename Growth, typename Allocator>
 template <typename... Args>
-typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
-                                                    Args &&...args) {
-  iterator it = (iterator)pos;
-  for (const auto &elem : {args...}) {
-    it = insert(it, elem);
-    ++it;
+typename vector<T, Growth, Allocator>::iterator
+vector<T, Growth, Allocator>::insert_many(const_iterator pos, Args &&...args) {
+  size_type index = pos - begin();
+  if constexpr (sizeof...(Args) > 0) {
+    // args may refer to elements of this vector, so the new values are built
+    // aside before the tail moves, then moved in by one range insert
+    alignas(T) unsigned char buffer[sizeof...(Args) * sizeof(T)];
+    T *values = reinterpret_cast<T *>(buffer);
+    size_type built = 0;
+    try {
+      ((::new (static_cast<void *>(values + built))
+            T(std::forward<Args>(args)),
+        built++),
+       ...);
+      insert(begin() + index, std::make_move_iterator(values),
+             std::make_move_iterator(values + built));
+    } catch (...) {
+      s21::destroy(values, values + built);
+      throw;
+    }
+    s21::destroy(values, values + built);
   }
-  return it;
+  return begin() + index + sizeof...(Args);
 }
 
 // Inserts new elements into the container directly before pos
-template <typename T>
+template <typename T, typename Growth, typename Allocator>
 template <typename... Args>
-void vector<T>::insert_many_back(Args &&...args) {
-  insert_many(end(), std::forward<T>(args)...);
+void vector<T, Growth, Allocator>::insert_many_back(Args &&...args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
+
+// private
+
+// raw storage for n elements: mapped pages for large buffers, the
+// allocator otherwise
+template <typename T, typename Growth, typename Allocator>
+T *vector<T, Growth, Allocator>::allocate(size_type n) {
+  if (n == 0) return nullptr;
+  if (is_large(n)) {
+    return static_cast<T *>(large_buffer::allocate(n * sizeof(T)));
+  }
+  return alloc_traits::allocate(allocator(), n);
+}
+
+// frees raw storage of n elements
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::deallocate(T *ptr, size_type n) noexcept {
+  if (is_large(n)) {
+    large_buffer::deallocate(ptr, n * sizeof(T));
+  } else if (ptr != nullptr) {
+    alloc_traits::deallocate(allocator(), ptr, n);
+  }
+}
+
+// swaps the buffers, keeping the allocators
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::swap_storage(vector &other) noexcept {
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+// frees the buffer and takes the one of v, along with the allocator of v
+// when it propagates on move assignment
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::take_storage(vector &v) noexcept {
+  s21::destroy(data_, data_ + size_);
+  deallocate(data_, capacity_);
+  data_ = nullptr;
+  size_ = 0;
+  capacity_ = 0;
+  if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+    allocator() = std::move(v.allocator());
+  }
+  swap_storage(v);
+}
+
+// checks whether storage of n elements is a mapped large buffer
+template <typename T, typename Growth, typename Allocator>
+constexpr bool vector<T, Growth, Allocator>::is_large(size_type n) noexcept {
+  if constexpr (uses_large_buffers()) {
+    return n * sizeof(T) >= Growth::large_buffer_threshold;
+  } else {
+    (void)n;
+    return false;
+  }
+}
+
+// checks whether the buffer can be resized in place by the kernel
+template <typename T, typename Growth, typename Allocator>
+bool vector<T, Growth, Allocator>::can_remap(
+    size_type new_capacity) const noexcept {
+  return S21_HAS_MREMAP && is_large(capacity_) && is_large(new_capacity);
+}
+
+// moves the elements to storage of new_capacity elements
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::reallocate(size_type new_capacity) {
+  if (can_remap(new_capacity)) {
+    data_ = static_cast<T *>(large_buffer::reallocate(
+        data_, capacity_ * sizeof(T), new_capacity * sizeof(T)));
+    this->count_remap();
+  } else {
+    T *data_tmp = allocate(new_capacity);
+    s21::uninitialized_relocate(data_, data_ + size_, data_tmp);
+    deallocate(data_, capacity_);
+    if (capacity_ != 0) this->count_reallocation(size_ * sizeof(T));
+    data_ = data_tmp;
+  }
+  capacity_ = new_capacity;
+}
+
+// capacity for growing to hold required elements as the growth policy
+// suggests, but never less than required
+template <typename T, typename Growth, typename Allocator>
+typename vector<T, Growth, Allocator>::size_type
+vector<T, Growth, Allocator>::next_capacity(size_type required) const {
+  if (required > max_size())
+    throw std::length_error("Size of reserving storage is unavailable");
+  return std::max<size_type>(Growth::next(capacity_, max_size()), required);
+}
+
+// turns [index, index + count) into raw storage, reallocating at most once
+// and shifting the tail once; returns the start of the gap
+template <typename T, typename Growth, typename Allocator>
+T *vector<T, Growth, Allocator>::open_gap(size_type index, size_type count) {
+  if (count > capacity_ - size_) {
+    size_type new_capacity = next_capacity(size_ + count);
+    if (can_remap(new_capacity)) {
+      reallocate(new_capacity);
+      s21::relocate_backward(data_ + index, data_ + size_,
+                             data_ + size_ + count);
+    } else {
+      T *data_tmp = allocate(new_capacity);
+      s21::uninitialized_relocate(data_, data_ + index, data_tmp);
+      s21::uninitialized_relocate(data_ + index, data_ + size_,
+                                  data_tmp + index + count);
+      deallocate(data_, capacity_);
+      if (capacity_ != 0) this->count_reallocation(size_ * sizeof(T));
+      data_ = data_tmp;
+      capacity_ = new_capacity;
+    }
+  } else {
+    s21::relocate_backward(data_ + index, data_ + size_,
+                           data_ + size_ + count);
+  }
+  return data_ + index;
+}
+
+// undoes open_gap when filling the gap failed
+template <typename T, typename Growth, typename Allocator>
+void vector<T, Growth, Allocator>::close_gap(size_type index,
+                                             size_type count) noexcept {
+  s21::relocate_forward(data_ + index + count, data_ + size_ + count,
+                        data_ + index);
 }
 
 }  // namespace s21
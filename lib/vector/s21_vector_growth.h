@@ -0,0 +1,174 @@
+#ifndef S21_VECTOR_GROWTH_H
+#define S21_VECTOR_GROWTH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define S21_HAS_MMAP 1
+#else
+#define S21_HAS_MMAP 0
+#endif
+
+#if S21_HAS_MMAP && defined(__linux__) && defined(MREMAP_MAYMOVE)
+#define S21_HAS_MREMAP 1
+#else
+#define S21_HAS_MREMAP 0
+#endif
+
+namespace s21 {
+
+// Growth policies decide the capacity of the next buffer when a vector is
+// full. next() gets the current capacity and max_size() and may return less
+// than the vector needs: the vector always grows to at least the required
+// size.
+//
+// Two flags switch on optional behaviour:
+//   large_buffers - buffers of at least large_buffer_threshold bytes are
+//                   mapped with mmap and grown in place with mremap (Linux)
+//                   when the element type is trivially relocatable
+//   track_stats   - the vector counts reallocations and copied bytes, see
+//                   vector_stats
+
+// doubles the capacity
+struct growth_double {
+  static constexpr bool large_buffers = false;
+  static constexpr bool track_stats = false;
+
+  static size_t next(size_t capacity, size_t max_size) noexcept {
+    return capacity == 0                  ? 1
+           : max_size - capacity > capacity ? capacity * 2
+                                            : max_size;
+  }
+};
+
+// grows the capacity by half, which wastes at most a third of the buffer
+struct growth_one_and_half {
+  static constexpr bool large_buffers = false;
+  static constexpr bool track_stats = false;
+
+  static size_t next(size_t capacity, size_t max_size) noexcept {
+    size_t step = std::max<size_t>(capacity / 2, 1);
+    return max_size - capacity > step ? capacity + step : max_size;
+  }
+};
+
+// grows the capacity by a fixed number of elements
+template <size_t Increment>
+struct growth_fixed {
+  static_assert(Increment > 0, "growth_fixed needs a positive increment");
+
+  static constexpr bool large_buffers = false;
+  static constexpr bool track_stats = false;
+
+  static size_t next(size_t capacity, size_t max_size) noexcept {
+    return max_size - capacity > Increment ? capacity + Increment : max_size;
+  }
+};
+
+// Growth with buffers of at least Threshold bytes mapped directly from the
+// kernel. On Linux such buffers grow with mremap, which moves page table
+// entries instead of copying the elements.
+template <typename Growth = growth_double, size_t Threshold = (size_t{1} << 21)>
+struct growth_large_buffers : Growth {
+  static constexpr bool large_buffers = S21_HAS_MMAP;
+  static constexpr size_t large_buffer_threshold = Threshold;
+};
+
+// Growth that also makes the vector record vector_stats
+template <typename Growth = growth_double>
+struct growth_with_stats : Growth {
+  static constexpr bool track_stats = true;
+};
+
+// vector_stats counts what happened to a vector's storage
+struct vector_stats {
+  size_t reallocations = 0;  // elements moved to a newly allocated buffer
+  size_t remaps = 0;         // buffers resized in place by mremap
+  size_t bytes_copied = 0;   // bytes moved from an old buffer to a new one
+};
+
+// vector_stats_counter is an empty base of vector unless the growth policy
+// asks for stats
+template <bool Enabled>
+class vector_stats_counter {
+ public:
+  vector_stats stats() const noexcept { return {}; }
+
+ protected:
+  void count_reallocation(size_t) noexcept {}
+  void count_remap() noexcept {}
+};
+
+template <>
+class vector_stats_counter<true> {
+ public:
+  vector_stats stats() const noexcept { return stats_; }
+
+ protected:
+  void count_reallocation(size_t bytes) noexcept {
+    stats_.reallocations++;
+    stats_.bytes_copied += bytes;
+  }
+  void count_remap() noexcept { stats_.remaps++; }
+
+ private:
+  vector_stats stats_;
+};
+
+// page-granular buffers mapped with mmap, used by growth_large_buffers
+struct large_buffer {
+  // rounds bytes up to a whole number of pages
+  static size_t page_round(size_t bytes) noexcept {
+#if S21_HAS_MMAP
+    static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return (bytes + page - 1) / page * page;
+#else
+    return bytes;
+#endif
+  }
+
+  // maps a zero-filled buffer of at least bytes
+  static void *allocate(size_t bytes) {
+#if S21_HAS_MMAP
+    void *ptr = mmap(nullptr, page_round(bytes), PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED) throw std::bad_alloc();
+    return ptr;
+#else
+    return ::operator new(bytes);
+#endif
+  }
+
+  // resizes a mapped buffer, possibly moving it; only used on Linux
+  static void *reallocate(void *ptr, size_t old_bytes, size_t new_bytes) {
+#if S21_HAS_MREMAP
+    void *moved = mremap(ptr, page_round(old_bytes), page_round(new_bytes),
+                         MREMAP_MAYMOVE);
+    if (moved == MAP_FAILED) throw std::bad_alloc();
+    return moved;
+#else
+    (void)ptr;
+    (void)old_bytes;
+    (void)new_bytes;
+    throw std::bad_alloc();
+#endif
+  }
+
+  // unmaps a buffer of bytes
+  static void deallocate(void *ptr, size_t bytes) noexcept {
+#if S21_HAS_MMAP
+    munmap(ptr, page_round(bytes));
+#else
+    (void)bytes;
+    ::operator delete(ptr);
+#endif
+  }
+};
+
+}  // namespace s21
+
+#endif
@@ -3,7 +3,25 @@
 
 #include <iostream>
 
+#include "lib/algorithm/s21_parallel.h"
+#include "lib/algorithm/s21_radix_sort.h"
+#include "lib/algorithm/s21_simd.h"
 #include "lib/array/s21_array.h"
+#include "lib/concurrent_stack/s21_concurrent_stack.h"
+#include "lib/deque/s21_deque.h"
+#include "lib/frozen_map/s21_frozen_map.h"
+#include "lib/frozen_set/s21_frozen_set.h"
+#include "lib/intrusive_list/s21_intrusive_list.h"
+#include "lib/mpmc_queue/s21_mpmc_queue.h"
 #include "lib/multiset/s21_multiset.h"
+#include "lib/priority_queue/s21_indexed_priority_queue.h"
+#include "lib/priority_queue/s21_priority_queue.h"
+#include "lib/ring_buffer/s21_ring_buffer.h"
+#include "lib/small_vector/s21_small_vector.h"
+#include "lib/spsc_queue/s21_spsc_queue.h"
+#include "lib/static_vector/s21_static_vector.h"
+#include "lib/thread_pool/s21_task_scheduler.h"
+#include "lib/thread_pool/s21_thread_pool.h"
+#include "lib/unrolled_list/s21_unrolled_list.h"
 
 #endif
@@ -26,7 +26,8 @@ TEST(Constructor_array, move_array) {
   s21::array<int, 4> a{1, 2, 3};
   s21::array<int, 4> moved(std::move(a));
   ASSERT_EQ(moved.size(), 4);
-  ASSERT_EQ(a.size(), 0);
+  ASSERT_EQ(moved[2], 3);
+  ASSERT_EQ(a.size(), 4);
 }
 
 TEST(Iterators_array, begin_end_empy) {
@@ -101,4 +102,77 @@ TEST(Methods_array, fill) {
   ASSERT_EQ(a.front(), b.front());
   ASSERT_EQ(a.back(), b.back());
   ASSERT_EQ(*a.data(), *b.data());
-}
\ No newline at end of file
+}
+
+TEST(Constructor_array, copy_move_non_trivial) {
+  s21::array<std::string, 3> a{"one", "two", "three"};
+  s21::array<std::string, 3> b(a);
+  s21::array<std::string, 3> c(std::move(a));
+  ASSERT_EQ(b[2], "three");
+  ASSERT_EQ(c[0], "one");
+}
+
+TEST(Methods_array, at_out_of_range) {
+  s21::array<int, 4> a{1, 2, 3, 4};
+  const s21::array<int, 4> &b = a;
+  EXPECT_THROW(a.at(4), std::out_of_range);
+  EXPECT_THROW(b.at(100), std::out_of_range);
+  ASSERT_EQ(b.at(3), 4);
+}
+
+TEST(Layout_array, no_overhead) {
+  static_assert(sizeof(s21::array<int, 4>) == sizeof(int[4]));
+  static_assert(sizeof(s21::array<char, 3>) == sizeof(char[3]));
+  static_assert(alignof(s21::array<double, 2>) == alignof(double));
+  static_assert(std::is_aggregate<s21::array<int, 4>>::value);
+  static_assert(std::is_trivially_copyable<s21::array<int, 4>>::value);
+  static_assert(std::is_trivially_default_constructible<
+                s21::array<int, 4>>::value);
+  static_assert(std::is_trivially_destructible<s21::array<int, 4>>::value);
+  static_assert(std::is_standard_layout<s21::array<int, 4>>::value);
+  static_assert(!std::is_trivially_copyable<
+                s21::array<std::string, 2>>::value);
+  static_assert(s21::is_trivially_relocatable<s21::array<int, 4>>::value);
+}
+
+namespace {
+
+constexpr s21::array<int, 5> squares() {
+  s21::array<int, 5> a{};
+  for (size_t i = 0; i < a.size(); i++) a[i] = static_cast<int>(i * i);
+  return a;
+}
+
+constexpr int sum(const s21::array<int, 5> &a) {
+  int total = 0;
+  for (int x : a) total += x;
+  return total;
+}
+
+}  // namespace
+
+TEST(Constexpr_array, compile_time_use) {
+  constexpr s21::array<int, 3> primes{2, 3, 5};
+  static_assert(primes.size() == 3 && !primes.empty());
+  static_assert(primes[1] == 3 && primes.at(2) == 5);
+  static_assert(primes.front() == 2 && primes.back() == 5);
+  static_assert(*primes.begin() == 2 && primes.end() - primes.begin() == 3);
+  static_assert(sum(squares()) == 30);
+  constexpr s21::array<int, 5> filled = [] {
+    s21::array<int, 5> a{};
+    a.fill(7);
+    return a;
+  }();
+  static_assert(filled[4] == 7);
+  ASSERT_EQ(sum(filled), 35);
+}
+
+TEST(Constexpr_array, zero_size) {
+  constexpr s21::array<int, 0> a{};
+  static_assert(a.empty() && a.size() == 0 && a.max_size() == 0);
+  static_assert(a.begin() == a.end());
+  static_assert(std::is_trivially_copyable<s21::array<int, 0>>::value);
+  s21::array<std::string, 0> b, c;
+  b.swap(c);
+  ASSERT_EQ(b.data(), nullptr);
+}
@@ -0,0 +1,87 @@
+#include "s21_test.h"
+
+namespace {
+
+int reclaimed = 0;
+
+void count_reclaim(void *p) {
+  delete static_cast<int *>(p);
+  reclaimed++;
+}
+
+}  // namespace
+
+TEST(HazardPointer, protected_pointer_outlives_collect) {
+  reclaimed = 0;
+  int *guarded = new int(1);
+  {
+    s21::hazard_pointer hazard;
+    hazard.protect(guarded);
+    s21::hazard_pointer::retire(guarded, &count_reclaim);
+    s21::hazard_pointer::retire(new int(2), &count_reclaim);
+    s21::hazard_pointer::collect();
+    ASSERT_EQ(reclaimed, 1);
+    ASSERT_EQ(*guarded, 1);
+  }
+  s21::hazard_pointer::collect();
+  ASSERT_EQ(reclaimed, 2);
+}
+
+TEST(Method_concurrent_stack, lifo_order) {
+  s21::concurrent_stack<std::string> stack;
+  ASSERT_TRUE(stack.empty());
+  std::string out;
+  ASSERT_FALSE(stack.try_pop(out));
+  std::string first = "first";
+  stack.push(first);
+  stack.push(std::string(40, 'x'));
+  stack.emplace(3, 'y');
+  ASSERT_FALSE(stack.empty());
+  for (std::string expected : {std::string("yyy"), std::string(40, 'x'),
+                               std::string("first")}) {
+    ASSERT_TRUE(stack.try_pop(out));
+    ASSERT_EQ(out, expected);
+  }
+  ASSERT_FALSE(stack.try_pop(out));
+  ASSERT_TRUE(stack.empty());
+}
+
+TEST(Method_concurrent_stack, move_only_and_leftovers) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::concurrent_stack<std::shared_ptr<int>> stack;
+    for (int i = 0; i < 10; i++) stack.push(counter);
+    std::shared_ptr<int> out;
+    ASSERT_TRUE(stack.try_pop(out));
+  }
+  // the destructor released the nine elements still on the stack
+  ASSERT_EQ(counter.use_count(), 1);
+
+  s21::concurrent_stack<std::unique_ptr<int>> owners;
+  owners.emplace(new int(7));
+  std::unique_ptr<int> owner;
+  ASSERT_TRUE(owners.try_pop(owner));
+  ASSERT_EQ(*owner, 7);
+}
+
+TEST(Method_concurrent_stack, threads_pop_every_element_once) {
+  const int kThreads = 4;
+  const int kPerThread = 50000;
+  s21::concurrent_stack<int> stack;
+  std::vector<std::atomic<int>> seen(kThreads * kPerThread);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&, t] {
+      int value;
+      for (int i = 0; i < kPerThread; i++) {
+        stack.push(t * kPerThread + i);
+        // pop about every second element while the others push
+        if (i % 2 == 1 && stack.try_pop(value)) seen[value]++;
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  int value;
+  while (stack.try_pop(value)) seen[value]++;
+  for (auto &count : seen) ASSERT_EQ(count.load(), 1);
+}
@@ -0,0 +1,177 @@
+#include "s21_test.h"
+
+namespace {
+
+// four elements per block, so a handful of pushes crosses block boundaries
+template <typename T>
+using small_deque = s21::deque<T, 4>;
+
+template <typename Deque>
+std::vector<typename Deque::value_type> contents(const Deque &d) {
+  return std::vector<typename Deque::value_type>(d.begin(), d.end());
+}
+
+}  // namespace
+
+TEST(Constructor_deque, default_and_init_list) {
+  s21::deque<int> empty;
+  ASSERT_TRUE(empty.empty());
+  ASSERT_TRUE(empty.begin() == empty.end());
+  ASSERT_EQ(s21::deque<int>::block_size, 1024);
+  ASSERT_EQ((s21::deque<std::array<char, 1000>>::block_size), 16);
+
+  small_deque<int> d{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  ASSERT_EQ(contents(d), (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  ASSERT_EQ(d.end() - d.begin(), 9);
+
+  small_deque<std::string> sized(10);
+  ASSERT_EQ(sized.size(), 10);
+  ASSERT_EQ(sized.back(), "");
+}
+
+TEST(Constructor_deque, copy_and_move) {
+  small_deque<std::string> d;
+  for (int i = 0; i < 7; i++) d.push_back(std::to_string(i));
+  for (int i = 0; i < 7; i++) d.push_front("-" + std::to_string(i));
+
+  small_deque<std::string> copy(d);
+  ASSERT_EQ(contents(copy), contents(d));
+  const std::string *front = &d.front();
+  small_deque<std::string> moved(std::move(d));
+  ASSERT_EQ(&moved.front(), front);
+  ASSERT_TRUE(d.empty());
+
+  d = copy;
+  ASSERT_EQ(contents(d), contents(moved));
+  copy = std::move(moved);
+  ASSERT_EQ(copy.size(), 14);
+  ASSERT_EQ(copy.front(), "-6");
+  ASSERT_TRUE(moved.empty());
+  moved.push_back("again");
+  ASSERT_EQ(moved.back(), "again");
+}
+
+TEST(Method_deque, both_ends_match_std_deque) {
+  small_deque<int> d;
+  std::deque<int> expected;
+  unsigned x = 5;
+  for (int step = 0; step < 20000; step++) {
+    x = x * 1103515245 + 12345;
+    unsigned op = (x >> 16) % 8;
+    if (op < 3 || expected.empty()) {
+      d.push_back(step);
+      expected.push_back(step);
+    } else if (op < 5) {
+      d.push_front(step);
+      expected.push_front(step);
+    } else if (op < 7) {
+      d.pop_front();
+      expected.pop_front();
+    } else {
+      d.pop_back();
+      expected.pop_back();
+    }
+    ASSERT_EQ(d.size(), expected.size());
+    if (!expected.empty()) {
+      ASSERT_EQ(d.front(), expected.front());
+      ASSERT_EQ(d.back(), expected.back());
+    }
+  }
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), d.begin()));
+  ASSERT_TRUE(std::equal(expected.rbegin(), expected.rend(),
+                         std::make_reverse_iterator(d.end())));
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(d[i], expected[i]);
+  }
+}
+
+TEST(Method_deque, references_stay_valid_while_growing) {
+  small_deque<std::string> d;
+  d.push_back("middle");
+  const std::string *middle = &d.front();
+  std::vector<const std::string *> pushed;
+  for (int i = 0; i < 1000; i++) {
+    pushed.push_back(&d.emplace_back(std::to_string(i)));
+    d.push_front(std::to_string(-i));
+  }
+  ASSERT_EQ(*middle, "middle");
+  ASSERT_EQ(&d[1000], middle);
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_EQ(*pushed[i], std::to_string(i));
+    ASSERT_EQ(&d[1001 + i], pushed[i]);
+  }
+  // popping the other elements leaves the survivor where it was
+  for (int i = 0; i < 1000; i++) d.pop_front();
+  for (int i = 0; i < 1000; i++) d.pop_back();
+  ASSERT_EQ(d.size(), 1);
+  ASSERT_EQ(&d.front(), middle);
+}
+
+TEST(Method_deque, steady_state_queue) {
+  small_deque<std::unique_ptr<int>> d;
+  for (int i = 0; i < 3; i++) d.emplace_back(new int(i));
+  for (int i = 3; i < 10000; i++) {
+    d.emplace_back(new int(i));
+    ASSERT_EQ(*d.front(), i - 3);
+    d.pop_front();
+  }
+  ASSERT_EQ(d.size(), 3);
+  ASSERT_EQ(*d.back(), 9999);
+  d.shrink_to_fit();
+  ASSERT_EQ(*d.front(), 9997);
+  ASSERT_EQ(*d.at(2), 9999);
+}
+
+TEST(Method_deque, clear_shrink_and_errors) {
+  small_deque<std::string> d{"a", "b", "c", "d", "e", "f"};
+  EXPECT_THROW(d.at(6), std::out_of_range);
+  d.clear();
+  ASSERT_TRUE(d.empty());
+  ASSERT_TRUE(d.begin() == d.end());
+  EXPECT_THROW(d.pop_back(), std::out_of_range);
+  EXPECT_THROW(d.pop_front(), std::out_of_range);
+  d.push_front("x");
+  ASSERT_EQ(contents(d), (std::vector<std::string>{"x"}));
+  d.pop_back();
+  d.shrink_to_fit();
+  ASSERT_TRUE(d.begin() == d.end());
+  d.push_back("y");
+  ASSERT_EQ(d.front(), "y");
+}
+
+TEST(Method_deque, random_access_iterators) {
+  small_deque<int> d;
+  for (int i = 0; i < 23; i++) d.push_front(i);
+  std::sort(d.begin(), d.end());
+  std::vector<int> sorted(23);
+  std::iota(sorted.begin(), sorted.end(), 0);
+  ASSERT_EQ(contents(d), sorted);
+
+  const auto &view = d;
+  for (int value = 0; value < 23; value++) {
+    auto it = std::lower_bound(view.begin(), view.end(), value);
+    ASSERT_EQ(it - view.begin(), value);
+    ASSERT_EQ(*it, value);
+  }
+  auto it = view.begin() + 9;
+  ASSERT_EQ(it[5], 14);
+  ASSERT_EQ(it[-7], 2);
+  ASSERT_EQ(*(it - 9), 0);
+  ASSERT_EQ(*(13 + it), 22);
+  ASSERT_TRUE(it + 14 == view.end());
+  ASSERT_TRUE(view.end() - 1 > it);
+  ASSERT_TRUE(view.begin() <= it);
+  s21::deque<int, 4>::iterator mutable_it = d.begin();
+  s21::deque<int, 4>::const_iterator converted = mutable_it;
+  ASSERT_TRUE(converted == view.begin());
+}
+
+TEST(Method_deque, over_aligned_elements) {
+  s21::deque<CacheLine, 3> deque;
+  for (int i = 0; i < 10; i++) deque.push_back(CacheLine{i});
+  for (int i = 0; i < 5; i++) deque.push_front(CacheLine{-i});
+  for (const CacheLine &line : deque) ASSERT_TRUE(is_aligned(&line));
+  ASSERT_EQ(deque.size(), 15);
+  ASSERT_EQ(deque.front().value, -4);
+  ASSERT_EQ(deque.back().value, 9);
+}
@@ -0,0 +1,133 @@
+#include <string_view>
+
+#include "s21_test.h"
+
+namespace {
+
+enum class opcode { nop = 0, load = 7, store = 9, jump = 200, halt = 255 };
+
+constexpr int add_one(int x) { return x + 1; }
+constexpr int twice(int x) { return x * 2; }
+
+constexpr auto kHandlers = s21::make_frozen_map<opcode, int (*)(int)>(
+    {{opcode::load, &add_one}, {opcode::jump, &twice}});
+
+constexpr auto kMethods = s21::make_frozen_map<std::string_view, int>(
+    {{"GET", 1}, {"PUT", 2}, {"POST", 3}, {"DELETE", 4}, {"HEAD", 5}});
+
+// keys that are multiples of 4096 share their low bits
+template <size_t N, typename Layout>
+constexpr s21::frozen_map<long, long, N, Layout> make_spread() {
+  s21::array<s21::frozen_entry<long, long>, N> items{};
+  for (size_t i = 0; i < N; i++) {
+    long key = static_cast<long>((N - i) * 4096) - 100000;
+    items[i] = {key, key * 3};
+  }
+  return s21::frozen_map<long, long, N, Layout>(items);
+}
+
+}  // namespace
+
+TEST(Frozen_map, compile_time_lookup) {
+  static_assert(kMethods.size() == 5);
+  static_assert(kMethods.at("PUT") == 2);
+  static_assert(kMethods.contains("HEAD") && !kMethods.contains("PATCH"));
+  static_assert(kMethods.find("GE") == kMethods.end());
+  static_assert(kMethods.find("GETS") == kMethods.end());
+  static_assert(kHandlers.at(opcode::jump)(21) == 42);
+  static_assert(kHandlers.count(opcode::halt) == 0);
+  static_assert(std::is_same<decltype(kHandlers.find(opcode::nop)),
+                             const s21::frozen_entry<opcode, int (*)(int)>
+                                 *>::value);
+  ASSERT_EQ(kHandlers.at(opcode::load)(1), 2);
+  EXPECT_THROW(kHandlers.at(opcode::store), std::out_of_range);
+}
+
+TEST(Frozen_map, every_key_found_at_runtime) {
+  std::string_view names[] = {"GET", "PUT", "POST", "DELETE", "HEAD"};
+  for (int i = 0; i < 5; i++) {
+    std::string name(names[i]);
+    ASSERT_EQ(kMethods.at(name), i + 1);
+  }
+  for (std::string_view missing : {"", "A", "ZZZ", "GETX", "POS"}) {
+    ASSERT_FALSE(kMethods.contains(missing));
+  }
+  int sum = 0;
+  for (const auto &[name, value] : kMethods) sum += value;
+  ASSERT_EQ(sum, 15);
+}
+
+TEST(Frozen_map, perfect_hash_and_eytzinger_agree) {
+  static constexpr auto hashed = make_spread<300, s21::frozen_perfect_hash>();
+  static constexpr auto sorted = make_spread<300, s21::frozen_eytzinger>();
+  static_assert(hashed.at(4096 - 100000) == 3 * (4096 - 100000));
+  for (long key = -110000; key < 1300000; key += 512) {
+    bool present = key % 4096 == (4096 - 100000) % 4096 && key > -100000 &&
+                   key <= 300 * 4096 - 100000;
+    ASSERT_EQ(hashed.contains(key), present) << key;
+    ASSERT_EQ(sorted.contains(key), present) << key;
+    if (present) {
+      ASSERT_EQ(hashed.find(key)->second, key * 3);
+      ASSERT_EQ(sorted.find(key)->second, key * 3);
+    }
+  }
+  // the perfect hash keeps the entries in key order
+  ASSERT_TRUE(std::is_sorted(hashed.begin(), hashed.end(),
+                             [](const auto &a, const auto &b) {
+                               return a.first < b.first;
+                             }));
+}
+
+TEST(Frozen_map, sizes_and_duplicates) {
+  constexpr auto one = s21::make_frozen_map<int, char>({{5, 'x'}});
+  static_assert(one.at(5) == 'x' && !one.contains(4) && !one.contains(6));
+  constexpr auto pair = s21::make_frozen_map<std::string_view, int>(
+      {{"b", 2}, {"a", 1}});
+  static_assert(pair.at("a") == 1 && pair.at("b") == 2 && !pair.contains("c"));
+  using empty_items = s21::array<s21::frozen_entry<int, int>, 0>;
+  constexpr s21::frozen_map<int, int, 0> none{empty_items{}};
+  static_assert(none.empty() && !none.contains(0));
+  EXPECT_THROW((s21::make_frozen_map<int, int>({{1, 1}, {2, 2}, {1, 3}})),
+               std::invalid_argument);
+  EXPECT_THROW((s21::make_frozen_map<std::string_view, int>(
+                   {{"x", 1}, {"x", 2}})),
+               std::invalid_argument);
+}
+
+TEST(Frozen_set, lookup) {
+  constexpr auto keywords = s21::make_frozen_set<std::string_view>(
+      {"if", "else", "while", "for", "return", "break", "continue"});
+  static_assert(keywords.contains("while") && !keywords.contains("do"));
+  static_assert(keywords.count("break") == 1);
+  constexpr auto ports = s21::make_frozen_set<unsigned short>(
+      {22, 80, 443, 8080, 5432, 6379});
+  static_assert(ports.contains(443) && !ports.contains(444));
+  static_assert(*ports.begin() == 22);
+  std::set<unsigned short> expected{22, 80, 443, 5432, 6379, 8080};
+  for (unsigned port = 0; port < 65536; port++) {
+    ASSERT_EQ(ports.contains(static_cast<unsigned short>(port)),
+              expected.count(static_cast<unsigned short>(port)) == 1);
+  }
+  constexpr auto negative = s21::make_frozen_set<int, s21::frozen_eytzinger>(
+      {-5, 3, -100, 0, 42});
+  static_assert(negative.contains(-100) && negative.contains(42));
+  static_assert(!negative.contains(-4) && !negative.contains(43));
+}
+
+// keys that agree on their first 8 bytes, and keys with zero bytes, order
+// by the full strings
+TEST(Frozen_set, long_common_prefixes) {
+  using namespace std::string_view_literals;
+  constexpr auto keys = s21::make_frozen_set<std::string_view>(
+      {"content-length", "content-type", "content-", "content",
+       "content-encoding", "a\0b"sv, "a"sv, "a\0"sv, "zzzzzzzzzz",
+       "zzzzzzzz"});
+  static_assert(keys.contains("content-") && keys.contains("content"));
+  static_assert(keys.contains("a\0"sv) && keys.contains("a\0b"sv));
+  static_assert(!keys.contains("content-typ") && !keys.contains("a\0c"sv));
+  for (std::string_view key : keys) ASSERT_TRUE(keys.contains(key)) << key;
+  for (std::string_view missing : {"content-x"sv, "contents"sv, "a\0\0"sv,
+                                   "zzzzzzzzz"sv, "zzzzzzzzzzz"sv, ""sv}) {
+    ASSERT_FALSE(keys.contains(missing)) << missing;
+  }
+}
@@ -0,0 +1,166 @@
+#include "s21_test.h"
+
+namespace {
+
+struct Connection {
+  explicit Connection(int id = 0) : id(id) {}
+  int id;
+  s21::intrusive_list_hook hook;
+  s21::intrusive_list_hook idle_hook;
+};
+
+using ConnectionList = s21::intrusive_list<Connection, &Connection::hook>;
+using IdleList = s21::intrusive_list<Connection, &Connection::idle_hook>;
+
+std::vector<int> ids(const ConnectionList &list) {
+  std::vector<int> result;
+  for (const Connection &c : list) result.push_back(c.id);
+  // walking back from end() checks the prev_ links
+  std::vector<int> backwards;
+  for (auto it = list.end(); it != list.begin();) {
+    backwards.push_back((--it)->id);
+  }
+  std::reverse(backwards.begin(), backwards.end());
+  EXPECT_EQ(result, backwards);
+  EXPECT_EQ(result.size(), list.size());
+  return result;
+}
+
+}  // namespace
+
+TEST(Method_intrusive_list, links_objects_in_place) {
+  std::vector<Connection> arena;
+  for (int i = 0; i < 5; i++) arena.emplace_back(i);
+  {
+    ConnectionList list;
+    ASSERT_TRUE(list.empty());
+    ASSERT_TRUE(list.begin() == list.end());
+    for (int i = 1; i < 5; i++) list.push_back(arena[i]);
+    list.push_front(arena[0]);
+    ASSERT_EQ(ids(list), (std::vector<int>{0, 1, 2, 3, 4}));
+    ASSERT_EQ(&list.front(), &arena[0]);
+    ASSERT_EQ(&list.back(), &arena[4]);
+    ASSERT_TRUE(arena[2].hook.is_linked());
+    ASSERT_FALSE(arena[2].idle_hook.is_linked());
+  }
+  // the destroyed list unlinked every element
+  for (Connection &c : arena) ASSERT_FALSE(c.hook.is_linked());
+}
+
+TEST(Method_intrusive_list, insert_erase_and_iterator_to) {
+  Connection c[6] = {Connection(0), Connection(1), Connection(2),
+                     Connection(3), Connection(4), Connection(5)};
+  ConnectionList list;
+  for (int i = 0; i < 4; i++) list.push_back(c[i]);
+  auto it = list.insert(list.iterator_to(c[2]), c[5]);
+  ASSERT_EQ(it->id, 5);
+  ASSERT_EQ(ids(list), (std::vector<int>{0, 1, 5, 2, 3}));
+
+  ASSERT_EQ(list.erase(list.iterator_to(c[1]))->id, 5);
+  ASSERT_FALSE(c[1].hook.is_linked());
+  list.pop_front();
+  list.pop_back();
+  ASSERT_EQ(ids(list), (std::vector<int>{5, 2}));
+
+  list.push_back(c[1]);
+  list.push_back(c[4]);
+  auto last = list.erase(list.iterator_to(c[2]), list.iterator_to(c[4]));
+  ASSERT_EQ(&*last, &c[4]);
+  ASSERT_EQ(ids(list), (std::vector<int>{5, 4}));
+  list.clear();
+  ASSERT_TRUE(list.empty());
+  for (Connection &conn : c) ASSERT_FALSE(conn.hook.is_linked());
+}
+
+TEST(Method_intrusive_list, two_hooks) {
+  Connection c[3] = {Connection(0), Connection(1), Connection(2)};
+  ConnectionList all;
+  IdleList idle;
+  for (Connection &conn : c) all.push_back(conn);
+  idle.push_back(c[2]);
+  idle.push_back(c[0]);
+  ASSERT_EQ(idle.front().id, 2);
+  ASSERT_EQ(idle.back().id, 0);
+  all.erase(all.iterator_to(c[2]));
+  ASSERT_TRUE(c[2].idle_hook.is_linked());
+  ASSERT_EQ(idle.size(), 2);
+  ASSERT_EQ(ids(all), (std::vector<int>{0, 1}));
+  idle.clear();
+}
+
+TEST(Method_intrusive_list, splice) {
+  Connection c[8];
+  for (int i = 0; i < 8; i++) c[i].id = i;
+  ConnectionList list, other;
+  for (int i = 0; i < 4; i++) list.push_back(c[i]);
+  for (int i = 4; i < 8; i++) other.push_back(c[i]);
+
+  list.splice(list.iterator_to(c[1]), other, other.iterator_to(c[6]));
+  ASSERT_EQ(ids(list), (std::vector<int>{0, 6, 1, 2, 3}));
+  ASSERT_EQ(ids(other), (std::vector<int>{4, 5, 7}));
+
+  list.splice(list.end(), other, other.begin(), other.iterator_to(c[7]));
+  ASSERT_EQ(ids(list), (std::vector<int>{0, 6, 1, 2, 3, 4, 5}));
+  ASSERT_EQ(ids(other), (std::vector<int>{7}));
+
+  // inside one list: rotate the first two elements to the end
+  list.splice(list.end(), list, list.begin(), list.iterator_to(c[1]));
+  list.splice(list.begin(), list, list.begin());
+  ASSERT_EQ(ids(list), (std::vector<int>{1, 2, 3, 4, 5, 0, 6}));
+
+  list.splice(list.iterator_to(c[3]), other);
+  ASSERT_EQ(ids(list), (std::vector<int>{1, 2, 7, 3, 4, 5, 0, 6}));
+  ASSERT_TRUE(other.empty());
+  list.clear();
+}
+
+TEST(Method_intrusive_list, move_and_swap) {
+  Connection c[4];
+  for (int i = 0; i < 4; i++) c[i].id = i;
+  ConnectionList list;
+  list.push_back(c[0]);
+  list.push_back(c[1]);
+  ConnectionList moved(std::move(list));
+  ASSERT_TRUE(list.empty());
+  ASSERT_EQ(ids(moved), (std::vector<int>{0, 1}));
+
+  list.push_back(c[2]);
+  list.swap(moved);
+  ASSERT_EQ(ids(list), (std::vector<int>{0, 1}));
+  ASSERT_EQ(ids(moved), (std::vector<int>{2}));
+
+  ConnectionList empty;
+  moved.swap(empty);
+  ASSERT_TRUE(moved.empty());
+  ASSERT_EQ(ids(empty), (std::vector<int>{2}));
+  moved = std::move(list);
+  ASSERT_EQ(ids(moved), (std::vector<int>{0, 1}));
+  moved.push_back(c[3]);
+  ASSERT_EQ(std::count_if(moved.begin(), moved.end(),
+                          [](const Connection &conn) { return conn.id > 0; }),
+            2);
+  moved.clear();
+  empty.clear();
+}
+
+TEST(Method_intrusive_list, copied_element_is_unlinked) {
+  Connection original(1);
+  ConnectionList list;
+  list.push_back(original);
+  Connection copy(original);
+  ASSERT_FALSE(copy.hook.is_linked());
+  copy = original;
+  ASSERT_FALSE(copy.hook.is_linked());
+  list.clear();
+}
+
+#ifndef NDEBUG
+TEST(Method_intrusive_list, debug_checks) {
+  Connection c(1);
+  ConnectionList list;
+  list.push_back(c);
+  EXPECT_DEATH(list.push_back(c), "already in a list");
+  list.clear();
+  EXPECT_DEATH(list.erase(list.end()), "erasing a missing element");
+}
+#endif
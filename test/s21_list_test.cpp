@@ -132,6 +132,20 @@ TEST(Method_list, reverse) {
   ASSERT_EQ(*(--list.end()), *(--list_2.end()));
 }
 
+TEST(Method_list, reverse_relinks_nodes) {
+  s21::list<int> list{1, 2, 3, 4, 5};
+  std::list<int> expected{5, 4, 3, 2, 1};
+  auto first = list.begin();
+
+  list.reverse();
+
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), list.begin()));
+  ASSERT_TRUE(first == --list.end());
+  size_t backwards = 0;
+  for (auto it = --list.end(); it != list.begin(); --it) backwards++;
+  ASSERT_EQ(backwards + 1, list.size());
+}
+
 TEST(Method_list, splice) {
   s21::list<int> list{1, 2, 3, 4};
   s21::list<int> list_2{40, 30, 20, 10};
@@ -142,6 +156,78 @@ TEST(Method_list, splice) {
   ASSERT_EQ(*(--list.end()), 4);
 }
 
+TEST(Method_list, splice_whole_list) {
+  s21::list<int> list{1, 2};
+  s21::list<int> list_2{3, 4};
+  s21::list<int> empty;
+
+  list.splice(list.end(), list_2);
+  empty.splice(empty.begin(), list);
+
+  ASSERT_TRUE(list.empty());
+  ASSERT_TRUE(list_2.empty());
+  ASSERT_TRUE(list_2.begin() == list_2.end());
+  ASSERT_EQ(empty.size(), 4);
+  std::list<int> expected{1, 2, 3, 4};
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), empty.begin()));
+}
+
+TEST(Method_list, splice_one_element) {
+  s21::list<int> list{1, 2, 3};
+  s21::list<int> list_2{10, 20, 30};
+
+  list.splice(++list.begin(), list_2, ++list_2.begin());
+  list.splice(list.begin(), list, --list.end());
+  list.splice(list.end(), list_2, list_2.begin());
+  list.splice(list.begin(), list, list.begin());
+
+  std::list<int> expected{3, 1, 20, 2, 10};
+  ASSERT_EQ(list.size(), 5);
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), list.begin()));
+  ASSERT_EQ(list_2.size(), 1);
+  ASSERT_EQ(list_2.front(), 30);
+  ASSERT_EQ(list_2.back(), 30);
+}
+
+TEST(Method_list, splice_last_element_to_end) {
+  s21::list<int> list{1, 2, 3};
+  s21::list<int> list_2{10, 20, 30};
+
+  list.splice(list.end(), list_2, --list_2.end());
+
+  std::list<int> expected{1, 2, 3, 30};
+  ASSERT_EQ(list.size(), 4);
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), list.begin()));
+  ASSERT_EQ(list.back(), 30);
+  ASSERT_EQ(list_2.size(), 2);
+  ASSERT_EQ(list_2.back(), 20);
+}
+
+TEST(Method_list, splice_range) {
+  s21::list<int> list{1, 2, 3};
+  s21::list<int> list_2{10, 20, 30, 40};
+  std::list<int> std_list{1, 2, 3};
+  std::list<int> std_list_2{10, 20, 30, 40};
+
+  list.splice(++list.begin(), list_2, ++list_2.begin(), list_2.end());
+  std_list.splice(++std_list.begin(), std_list_2, ++std_list_2.begin(),
+                  std_list_2.end());
+  // rotate inside one list: move the first two elements to the end
+  list.splice(list.end(), list, list.begin(), ++(++list.begin()));
+  std_list.splice(std_list.end(), std_list, std_list.begin(),
+                  std::next(std_list.begin(), 2));
+  list.splice(list.begin(), list_2, list_2.begin(), list_2.begin());
+
+  ASSERT_EQ(list.size(), std_list.size());
+  ASSERT_TRUE(std::equal(std_list.begin(), std_list.end(), list.begin()));
+  auto it = list.end();
+  for (auto std_it = std_list.rbegin(); std_it != std_list.rend(); ++std_it) {
+    ASSERT_EQ(*(--it), *std_it);
+  }
+  ASSERT_EQ(list_2.size(), 1);
+  ASSERT_EQ(list_2.back(), 10);
+}
+
 TEST(Method_list, sort) {
   s21::list<int> list{1, -5, 3, 3, 100, 10000, -8};
   std::list<int> list_2{1, -5, 3, 3, 100, 10000, -8};
@@ -153,6 +239,84 @@ TEST(Method_list, sort) {
   ASSERT_EQ(*(--list.end()), *(--list_2.end()));
 }
 
+TEST(Method_list, sort_comparator_is_stable) {
+  s21::list<std::pair<int, int>> list;
+  std::list<std::pair<int, int>> list_2;
+  for (int i = 0; i < 1000; i++) {
+    list.push_back({i * 7919 % 13, i});
+    list_2.push_back({i * 7919 % 13, i});
+  }
+  auto by_key_desc = [](const auto &a, const auto &b) {
+    return a.first > b.first;
+  };
+
+  list.sort(by_key_desc);
+  list_2.sort(by_key_desc);
+
+  ASSERT_TRUE(std::equal(list_2.begin(), list_2.end(), list.begin()));
+  ASSERT_EQ(*(--list.end()), list_2.back());
+}
+
+TEST(Method_list, sort_natural_runs) {
+  for (int pattern = 0; pattern < 3; pattern++) {
+    s21::list<int> list;
+    std::list<int> list_2;
+    for (int i = 0; i < 300; i++) {
+      int value = pattern == 0   ? i
+                  : pattern == 1 ? 300 - i
+                                 : (i / 50) * 1000 - i;
+      list.push_back(value);
+      list_2.push_back(value);
+    }
+    auto first = list.begin();
+    int first_value = *first;
+
+    list.sort();
+    list_2.sort();
+
+    ASSERT_TRUE(std::equal(list_2.begin(), list_2.end(), list.begin()));
+    ASSERT_EQ(*first, first_value);  // nodes are relinked, not copied
+    size_t backwards = 0;
+    for (auto it = --list.end(); it != list.begin(); --it) backwards++;
+    ASSERT_EQ(backwards + 1, list.size());
+  }
+}
+
+TEST(Method_list, radix_sort) {
+  s21::list<long long> list;
+  std::list<long long> list_2;
+  for (long long i = 0; i < 500; i++) {
+    long long value = (i * 7919 % 1009 - 500) * 100003;
+    list.push_back(value);
+    list_2.push_back(value);
+  }
+  auto first = list.begin();
+  long long first_value = *first;
+
+  list.radix_sort();
+  list_2.sort();
+
+  ASSERT_EQ(list.size(), list_2.size());
+  ASSERT_TRUE(std::equal(list_2.begin(), list_2.end(), list.begin()));
+  ASSERT_EQ(*(--list.end()), list_2.back());
+  ASSERT_EQ(*first, first_value);  // nodes are relinked, not copied
+}
+
+TEST(Method_list, radix_sort_by_key) {
+  s21::list<std::pair<double, std::string>> list;
+  list.push_back({2.5, "c"});
+  list.push_back({-1.0, "a"});
+  list.push_back({2.5, "d"});
+  list.push_back({-0.5, "b"});
+  list.push_back({1e9, "e"});
+
+  list.radix_sort([](const auto &item) { return item.first; });
+
+  std::string order;
+  for (auto it = list.begin(); it != list.end(); ++it) order += (*it).second;
+  ASSERT_EQ(order, "abcde");
+}
+
 TEST(Method_list, merge) {
   s21::list<int> list{1, 2, 3, 4};
   s21::list<int> list_2{10, 20, 30};
@@ -167,6 +331,35 @@ TEST(Method_list, merge) {
   ASSERT_EQ(*(--list.end()), *(--list_3.end()));
 }
 
+TEST(Method_list, merge_interleaved) {
+  s21::list<int> list{1, 3, 5, 7, 9, 9};
+  s21::list<int> list_2{0, 2, 3, 8, 10, 11};
+  std::list<int> expected{0, 1, 2, 3, 3, 5, 7, 8, 9, 9, 10, 11};
+
+  list.merge(list_2);
+
+  ASSERT_TRUE(list_2.empty());
+  ASSERT_EQ(list.size(), expected.size());
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), list.begin()));
+  ASSERT_EQ(list.back(), 11);
+  ASSERT_EQ(*(--list.end()), 11);
+}
+
+TEST(Method_list, merge_comparator_is_stable) {
+  using Item = std::pair<int, char>;
+  auto by_key = [](const Item &a, const Item &b) { return a.first > b.first; };
+  s21::list<Item> list{{3, 'a'}, {2, 'b'}, {1, 'c'}};
+  s21::list<Item> list_2{{3, 'd'}, {1, 'e'}, {0, 'f'}};
+
+  list.merge(list_2, by_key);
+  list.merge(list);
+
+  std::string order;
+  for (auto it = list.begin(); it != list.end(); ++it) order += (*it).second;
+  ASSERT_EQ(order, "adbcef");
+  ASSERT_TRUE(list_2.empty());
+}
+
 TEST(Method_list, unique) {
   s21::list<int> list{1, 2, 2, 2, 3, 4, 5, 6, 6, 7};
   std::list<int> list_2{1, 2, 2, 2, 3, 4, 5, 6, 6, 7};
@@ -187,4 +380,90 @@ TEST(Method_list, insert_many) {
   ASSERT_EQ(*(list.begin()), 1);
   ASSERT_EQ(*(--list.end()), 100);
   ASSERT_EQ(list.size(), 5);
-}
\ No newline at end of file
+}
+TEST(Method_list, emplace_builds_in_place) {
+  Tracked::reset();
+  s21::list<Tracked> list;
+  list.emplace_back(2, "two");
+  list.emplace_front(1, "one");
+  auto it = list.emplace(list.end(), 4, "four");
+  list.emplace(it, 3, "three");
+  ASSERT_EQ(Tracked::copies, 0);
+  ASSERT_EQ(Tracked::moves, 0);
+  int expected = 1;
+  for (const Tracked &t : list) ASSERT_EQ(t.value, expected++);
+  ASSERT_EQ(list.emplace_back(5, "five").name, "five");
+}
+
+TEST(Method_list, rvalue_push_and_insert) {
+  Tracked::reset();
+  s21::list<Tracked> list;
+  list.push_back(Tracked(2, "b"));
+  list.push_front(Tracked(1, "a"));
+  list.insert(list.end(), Tracked(3, "c"));
+  ASSERT_EQ(Tracked::copies, 0);
+  ASSERT_EQ(Tracked::moves, 3);
+  ASSERT_EQ(list.front().name, "a");
+  ASSERT_EQ(list.back().name, "c");
+}
+
+TEST(Method_list, insert_many_forwards) {
+  Tracked::reset();
+  s21::list<Tracked> list;
+  Tracked kept(0, "kept");
+  list.insert_many_back(kept, Tracked(1, "x"));
+  list.insert_many_front(Tracked(-2, "y"), Tracked(-1, "z"));
+  auto it = list.begin();
+  ++it;
+  ++it;
+  list.insert_many(it, Tracked(5, "w"));
+  ASSERT_EQ(Tracked::copies, 1);
+  ASSERT_EQ(Tracked::moves, 4);
+  s21::vector<int> order;
+  for (const Tracked &t : list) order.push_back(t.value);
+  ASSERT_EQ(order.size(), 5);
+  ASSERT_EQ(order[0], -2);
+  ASSERT_EQ(order[1], -1);
+  ASSERT_EQ(order[2], 5);
+  ASSERT_EQ(order[3], 0);
+  ASSERT_EQ(order[4], 1);
+}
+
+TEST(Method_list, move_only_elements) {
+  s21::list<std::unique_ptr<int>> list;
+  list.push_back(std::make_unique<int>(1));
+  list.emplace_back(new int(2));
+  list.insert_many_back(std::make_unique<int>(3));
+  ASSERT_EQ(list.size(), 3);
+  ASSERT_EQ(*list.back(), 3);
+}
+
+TEST(Method_list, allocator_balances) {
+  {
+    using alloc = CountingAllocator<int>;
+    s21::list<int, alloc> list({3, 1, 2}, alloc(1));
+    ASSERT_EQ(CountingAllocator<char>::live, 3);
+    s21::list<int, alloc> copy(list);
+    copy.sort();
+    ASSERT_EQ(copy.front(), 1);
+    s21::list<int, alloc> other(std::move(list), alloc(2));
+    ASSERT_EQ(other.get_allocator().id, 2);
+    ASSERT_EQ(other.size(), 3);
+    copy.swap(list);
+    copy.pop_back();
+    // unequal allocators: list kept its nodes, other got three new ones
+    ASSERT_EQ(CountingAllocator<char>::live, 8);
+  }
+  ASSERT_EQ(CountingAllocator<char>::live, 0);
+}
+
+TEST(Method_list, pmr_resource) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::list<std::string> list(&arena);
+  list.push_back("a");
+  list.emplace_front(2, 'b');
+  ASSERT_EQ(list.get_allocator().resource(), &arena);
+  s21::pmr::list<std::string> copy(list, std::pmr::new_delete_resource());
+  ASSERT_EQ(copy.front(), "bb");
+  ASSERT_EQ(copy.back(), "a");
+}
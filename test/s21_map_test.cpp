@@ -542,3 +542,34 @@ TEST(Map, InsertMany) {
   EXPECT_TRUE(result3.empty());
   EXPECT_TRUE(m3.empty());
 }
+
+TEST(Map, AllocatorBalances) {
+  {
+    using alloc = CountingAllocator<std::pair<const int, std::string>>;
+    s21::map<int, std::string, alloc> m({{1, "one"}, {2, "two"}}, alloc(1));
+    m[3] = "three";
+    s21::map<int, std::string, alloc> copy(m);
+    EXPECT_EQ(copy.get_allocator().id, 1);
+    EXPECT_EQ(copy.at(3), "three");
+    s21::map<int, std::string, alloc> other{alloc(2)};
+    other = std::move(m);
+    EXPECT_EQ(other.size(), 3);
+    EXPECT_TRUE(m.empty());
+    other.erase(other.begin());
+    copy.merge(other);
+  }
+  EXPECT_EQ(CountingAllocator<char>::live, 0);
+}
+
+TEST(Map, PmrResource) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::map<int, int> m(&arena);
+  for (int i = 0; i < 100; i++) m.insert(i, i * i);
+  EXPECT_EQ(m.get_allocator().resource(), &arena);
+  s21::pmr::map<int, int> copy(m);
+  m.clear();
+  EXPECT_EQ(copy.size(), 100);
+  EXPECT_EQ(copy.at(9), 81);
+  copy.insert(100, 0);
+  EXPECT_EQ(copy.size(), 101);
+}
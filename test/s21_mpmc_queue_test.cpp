@@ -0,0 +1,123 @@
+#include "s21_test.h"
+
+TEST(Method_mpmc_queue, push_pop_until_full_and_empty) {
+  s21::mpmc_queue<std::string> queue(3);
+  ASSERT_EQ(queue.capacity(), 4);
+  ASSERT_TRUE(queue.empty());
+  std::string out;
+  ASSERT_FALSE(queue.try_pop(out));
+
+  std::string first = "first";
+  ASSERT_TRUE(queue.try_push(first));
+  ASSERT_TRUE(queue.try_push(std::string(40, 'x')));
+  ASSERT_TRUE(queue.try_emplace(3, 'y'));
+  ASSERT_TRUE(queue.try_emplace("last"));
+  ASSERT_FALSE(queue.try_push("overflow"));
+  ASSERT_EQ(queue.size(), 4);
+
+  ASSERT_TRUE(queue.try_pop(out));
+  ASSERT_EQ(out, "first");
+  ASSERT_TRUE(queue.try_push("wrapped"));
+  for (std::string expected :
+       {std::string(40, 'x'), std::string("yyy"), std::string("last"),
+        std::string("wrapped")}) {
+    ASSERT_TRUE(queue.try_pop(out));
+    ASSERT_EQ(out, expected);
+  }
+  ASSERT_FALSE(queue.try_pop(out));
+}
+
+TEST(Method_mpmc_queue, pop_bulk_and_leftovers) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::mpmc_queue<std::shared_ptr<int>> queue(8);
+    for (int i = 0; i < 8; i++) ASSERT_TRUE(queue.try_push(counter));
+    std::vector<std::shared_ptr<int>> out;
+    ASSERT_EQ(queue.pop_bulk(std::back_inserter(out), 5), 5);
+    ASSERT_EQ(queue.pop_bulk(std::back_inserter(out), 0), 0);
+    out.clear();
+    ASSERT_EQ(counter.use_count(), 4);
+    for (int i = 0; i < 5; i++) ASSERT_TRUE(queue.try_push(counter));
+    ASSERT_FALSE(queue.try_push(counter));
+  }
+  // the destructor released the eight elements still queued
+  ASSERT_EQ(counter.use_count(), 1);
+
+  s21::mpmc_queue<int> queue(4);
+  for (int i = 0; i < 3; i++) queue.push(i);
+  int out[8];
+  ASSERT_EQ(queue.pop_bulk(out, 8), 3);
+  ASSERT_EQ(out[2], 2);
+  ASSERT_EQ(queue.pop_bulk(out, 8), 0);
+}
+
+TEST(Method_mpmc_queue, timeouts) {
+  s21::mpmc_queue<std::unique_ptr<int>> queue(2);
+  std::unique_ptr<int> out;
+  auto start = std::chrono::steady_clock::now();
+  ASSERT_FALSE(queue.try_pop_for(out, std::chrono::milliseconds(20)));
+  ASSERT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(20));
+
+  queue.push(std::make_unique<int>(1));
+  queue.push(std::make_unique<int>(2));
+  auto value = std::make_unique<int>(3);
+  ASSERT_FALSE(
+      queue.try_push_for(std::move(value), std::chrono::milliseconds(5)));
+  // a push that times out leaves the value with the caller
+  ASSERT_EQ(*value, 3);
+
+  std::thread consumer([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    std::unique_ptr<int> taken;
+    queue.pop(taken);
+  });
+  ASSERT_TRUE(queue.try_push_for(std::move(value), std::chrono::seconds(10)));
+  consumer.join();
+  ASSERT_TRUE(queue.try_pop_for(out, std::chrono::milliseconds(1)));
+  ASSERT_EQ(*out, 2);
+  queue.pop(out);
+  ASSERT_EQ(*out, 3);
+}
+
+TEST(Method_mpmc_queue, producers_and_consumers_deliver_everything_once) {
+  const int kProducers = 4;
+  const int kConsumers = 4;
+  const int kPerProducer = 50000;
+  s21::mpmc_queue<int> queue(64);
+  std::vector<std::atomic<int>> seen(kProducers * kPerProducer);
+  std::atomic<int> received{0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; p++) {
+    threads.emplace_back([&, p] {
+      for (int i = 0; i < kPerProducer; i++) {
+        int value = p * kPerProducer + i;
+        if (i % 2 == 0) {
+          queue.push(value);
+        } else {
+          while (!queue.try_push(value)) std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; c++) {
+    threads.emplace_back([&, c] {
+      int batch[16];
+      while (received.load() < kProducers * kPerProducer) {
+        size_t n = 0;
+        if (c % 2 == 0) {
+          n = queue.pop_bulk(batch, 16);
+        } else if (queue.try_pop_for(batch[0], std::chrono::milliseconds(1))) {
+          n = 1;
+        }
+        for (size_t i = 0; i < n; i++) seen[batch[i]]++;
+        received += static_cast<int>(n);
+        if (n == 0) std::this_thread::yield();
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  ASSERT_EQ(received.load(), kProducers * kPerProducer);
+  for (auto &count : seen) ASSERT_EQ(count.load(), 1);
+  ASSERT_TRUE(queue.empty());
+}
@@ -599,4 +599,25 @@ TEST(Multiset, InsertMany) {
 
   EXPECT_TRUE(result3.empty());
   EXPECT_TRUE(ms3.empty());
-}
\ No newline at end of file
+}
+
+TEST(Multiset, AllocatorBalances) {
+  {
+    using alloc = CountingAllocator<int>;
+    s21::multiset<int, alloc> ms({1, 1, 2}, alloc(1));
+    s21::multiset<int, alloc> copy(ms);
+    ms.erase(ms.begin());
+    copy.merge(ms);
+    EXPECT_EQ(copy.count(1), 3);
+    EXPECT_EQ(copy.get_allocator().id, 1);
+  }
+  EXPECT_EQ(CountingAllocator<char>::live, 0);
+}
+
+TEST(Multiset, PmrResource) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::multiset<int> ms({2, 2, 1}, &arena);
+  EXPECT_EQ(ms.get_allocator().resource(), &arena);
+  EXPECT_EQ(ms.count(2), 2);
+  EXPECT_EQ(*ms.begin(), 1);
+}
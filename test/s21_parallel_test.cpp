@@ -0,0 +1,131 @@
+#include "s21_test.h"
+
+namespace {
+
+// small grains force many tasks even on short inputs
+s21::thread_pool &test_pool() {
+  static s21::thread_pool pool(4);
+  return pool;
+}
+
+s21::vector<int> make_data(size_t n) {
+  s21::vector<int> data;
+  unsigned x = 12345;
+  for (size_t i = 0; i < n; i++) {
+    x = x * 1103515245 + 12345;
+    data.push_back(static_cast<int>((x >> 8) % 1000) - 500);
+  }
+  return data;
+}
+
+}  // namespace
+
+TEST(ThreadPool, runs_every_task_once) {
+  s21::thread_pool pool(4);
+  ASSERT_EQ(pool.size(), 4);
+  s21::vector<std::atomic<int>> hits(1000);
+  for (int round = 0; round < 20; round++) {
+    pool.run(hits.size(), [&](size_t i) { hits[i]++; });
+  }
+  for (auto &hit : hits) ASSERT_EQ(hit.load(), 20);
+}
+
+TEST(ThreadPool, single_thread_runs_inline) {
+  s21::thread_pool pool(1);
+  ASSERT_EQ(pool.size(), 1);
+  std::thread::id caller = std::this_thread::get_id();
+  pool.run(8, [&](size_t) { ASSERT_EQ(std::this_thread::get_id(), caller); });
+}
+
+TEST(ThreadPool, rethrows_task_exception) {
+  s21::thread_pool pool(3);
+  EXPECT_THROW(pool.run(100,
+                        [](size_t i) {
+                          if (i == 42) throw std::runtime_error("task");
+                        }),
+               std::runtime_error);
+  std::atomic<int> done{0};
+  pool.run(10, [&](size_t) { done++; });
+  ASSERT_EQ(done.load(), 10);
+}
+
+TEST(ThreadPool, nested_run) {
+  s21::thread_pool pool(4);
+  std::atomic<int> done{0};
+  pool.run(8, [&](size_t) { pool.run(8, [&](size_t) { done++; }); });
+  ASSERT_EQ(done.load(), 64);
+}
+
+TEST(Parallel, for_each_and_transform) {
+  s21::parallel::policy policy{&test_pool(), 7};
+  s21::vector<int> data = make_data(1001);
+  s21::vector<int> expected = data;
+  for (int &x : expected) x *= 3;
+  s21::parallel::for_each(policy, data, [](int &x) { x *= 3; });
+  ASSERT_TRUE(std::equal(data.begin(), data.end(), expected.begin()));
+
+  s21::vector<long> out(1001);
+  s21::parallel::transform(policy, data, out, [](int x) { return x + 1L; });
+  for (size_t i = 0; i < data.size(); i++) ASSERT_EQ(out[i], data[i] + 1L);
+
+  s21::vector<long> short_out(10);
+  auto copy = [](int x) { return x; };
+  EXPECT_THROW(s21::parallel::transform(data, short_out, copy),
+               std::out_of_range);
+}
+
+TEST(Parallel, reduce) {
+  s21::parallel::policy policy{&test_pool(), 5};
+  for (size_t n : {0, 1, 4, 5, 6, 99, 1000}) {
+    s21::vector<int> data = make_data(n);
+    long expected = std::accumulate(data.begin(), data.end(), 10L);
+    ASSERT_EQ(s21::parallel::reduce(policy, data, 10L), expected);
+  }
+  s21::array<int, 5> small{1, 2, 3, 4, 5};
+  ASSERT_EQ(s21::parallel::reduce(small, 1,
+                                  [](int a, int b) { return a * b; }),
+            120);
+}
+
+TEST(Parallel, inclusive_scan) {
+  s21::parallel::policy policy{&test_pool(), 3};
+  for (size_t n : {0, 1, 2, 3, 4, 10, 257}) {
+    s21::vector<int> data = make_data(n);
+    std::vector<long> expected(n);
+    std::partial_sum(data.begin(), data.end(), expected.begin());
+    s21::vector<long> out(n);
+    s21::parallel::inclusive_scan(policy, data, out);
+    for (size_t i = 0; i < n; i++) ASSERT_EQ(out[i], expected[i]);
+
+    // in place
+    s21::parallel::inclusive_scan(policy, data, data);
+    for (size_t i = 0; i < n; i++) ASSERT_EQ(data[i], expected[i]);
+  }
+}
+
+TEST(Parallel, sort) {
+  for (size_t grain : {1, 3, 50, 0}) {
+    s21::parallel::policy policy{&test_pool(), grain};
+    for (size_t n : {0, 1, 2, 7, 100, 1000, 5003}) {
+      s21::vector<int> data = make_data(n);
+      std::vector<int> expected(data.begin(), data.end());
+      std::sort(expected.begin(), expected.end(), std::greater<>());
+      s21::parallel::sort(policy, data, std::greater<>());
+      ASSERT_TRUE(std::equal(data.begin(), data.end(), expected.begin()));
+    }
+  }
+}
+
+TEST(Parallel, stable_sort) {
+  s21::parallel::policy policy{&test_pool(), 10};
+  s21::vector<std::pair<int, std::string>> data;
+  s21::vector<int> keys = make_data(3000);
+  for (size_t i = 0; i < keys.size(); i++) {
+    data.push_back({keys[i] % 10, std::to_string(i)});
+  }
+  std::vector<std::pair<int, std::string>> expected(data.begin(), data.end());
+  auto by_key = [](const auto &a, const auto &b) { return a.first < b.first; };
+  std::stable_sort(expected.begin(), expected.end(), by_key);
+  s21::parallel::stable_sort(policy, data, by_key);
+  ASSERT_TRUE(std::equal(data.begin(), data.end(), expected.begin()));
+}
@@ -0,0 +1,260 @@
+#include <queue>
+
+#include "s21_test.h"
+
+using namespace std;
+
+TEST(Constructor_priority_queue, Default) {
+  s21::priority_queue<int> que;
+  ASSERT_EQ(que.size(), 0);
+  ASSERT_TRUE(que.empty());
+  ASSERT_EQ(que.arity, 4);
+}
+
+TEST(Constructor_priority_queue, init_list_builds_heap) {
+  s21::priority_queue<int> que = {5, 1, 9, 3, 7, 2, 8};
+  ASSERT_EQ(que.size(), 7);
+  ASSERT_EQ(que.top(), 9);
+}
+
+TEST(Constructor_priority_queue, range) {
+  std::vector<int> items = {4, 8, 15, 16, 23, 42};
+  s21::priority_queue<int> que(items.begin(), items.end());
+  for (auto it = items.rbegin(); it != items.rend(); ++it) {
+    ASSERT_EQ(que.top(), *it);
+    que.pop();
+  }
+  ASSERT_TRUE(que.empty());
+}
+
+TEST(Constructor_priority_queue, Copy) {
+  s21::priority_queue<int> que = {1, 2, 3, 4};
+  s21::priority_queue<int> que2(que);
+  que.pop();
+  ASSERT_EQ(que2.size(), 4);
+  ASSERT_EQ(que2.top(), 4);
+}
+
+TEST(Constructor_priority_queue, Move) {
+  s21::priority_queue<int> que = {1, 2, 3, 4};
+  s21::priority_queue<int> que2(std::move(que));
+  ASSERT_EQ(que2.size(), 4);
+  ASSERT_EQ(que2.top(), 4);
+}
+
+TEST(Constructor_priority_queue, is_trivially_relocatable) {
+  static_assert(s21::is_trivially_relocatable<
+                s21::priority_queue<int, s21::deque<int>>>::value);
+}
+
+TEST(Modifier_priority_queue, empty_throws) {
+  s21::priority_queue<int> que;
+  ASSERT_THROW(que.top(), std::out_of_range);
+  ASSERT_THROW(que.pop(), std::out_of_range);
+}
+
+TEST(Modifier_priority_queue, min_heap) {
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>> que;
+  que.insert_many_back(5, 3, 8, 1);
+  ASSERT_EQ(que.top(), 1);
+  que.pop();
+  ASSERT_EQ(que.top(), 3);
+}
+
+TEST(Modifier_priority_queue, emplace_and_move_only) {
+  auto less = [](const unique_ptr<int> &a, const unique_ptr<int> &b) {
+    return *a < *b;
+  };
+  s21::priority_queue<unique_ptr<int>, s21::vector<unique_ptr<int>>,
+                      decltype(less)>
+      que(less);
+  que.push(make_unique<int>(2));
+  que.emplace(new int(7));
+  que.emplace(new int(4));
+  ASSERT_EQ(*que.top(), 7);
+  que.pop();
+  ASSERT_EQ(*que.top(), 4);
+}
+
+TEST(Modifier_priority_queue, swap) {
+  s21::priority_queue<int> que = {1, 2};
+  s21::priority_queue<int> que2 = {7};
+  que.swap(que2);
+  ASSERT_EQ(que.size(), 1);
+  ASSERT_EQ(que.top(), 7);
+  ASSERT_EQ(que2.top(), 2);
+}
+
+// random pushes and pops against std::priority_queue
+template <size_t Arity>
+void compare_with_std() {
+  s21::priority_queue<int, s21::vector<int>, std::less<int>, Arity> que;
+  std::priority_queue<int> expected;
+  unsigned seed = 12345;
+  for (int i = 0; i < 5000; i++) {
+    seed = seed * 1103515245 + 12345;
+    if (seed % 3 != 0 || expected.empty()) {
+      int value = static_cast<int>(seed >> 16) % 1000;
+      que.push(value);
+      expected.push(value);
+    } else {
+      ASSERT_EQ(que.top(), expected.top());
+      que.pop();
+      expected.pop();
+    }
+    ASSERT_EQ(que.size(), expected.size());
+  }
+  while (!expected.empty()) {
+    ASSERT_EQ(que.top(), expected.top());
+    que.pop();
+    expected.pop();
+  }
+}
+
+TEST(Modifier_priority_queue, binary_matches_std) { compare_with_std<2>(); }
+
+TEST(Modifier_priority_queue, ternary_matches_std) { compare_with_std<3>(); }
+
+TEST(Modifier_priority_queue, quaternary_matches_std) {
+  compare_with_std<4>();
+}
+
+TEST(Modifier_priority_queue, deque_container) {
+  s21::priority_queue<int, s21::deque<int>> que = {3, 1, 4, 1, 5, 9, 2, 6};
+  ASSERT_EQ(que.top(), 9);
+  que.pop();
+  ASSERT_EQ(que.top(), 6);
+}
+
+TEST(Indexed_priority_queue, push_and_pop) {
+  s21::indexed_priority_queue<int> que;
+  auto a = que.push(3);
+  auto b = que.push(9);
+  auto c = que.push(5);
+  ASSERT_EQ(que.size(), 3);
+  ASSERT_EQ(que.top(), 9);
+  ASSERT_EQ(que.top_handle(), b);
+  ASSERT_EQ(que[a], 3);
+  ASSERT_EQ(que[c], 5);
+  que.pop();
+  ASSERT_FALSE(que.contains(b));
+  ASSERT_EQ(que.top_handle(), c);
+}
+
+TEST(Indexed_priority_queue, empty_throws) {
+  s21::indexed_priority_queue<int> que;
+  ASSERT_THROW(que.top(), std::out_of_range);
+  ASSERT_THROW(que.top_handle(), std::out_of_range);
+  ASSERT_THROW(que.pop(), std::out_of_range);
+  ASSERT_THROW(que.erase(0), std::out_of_range);
+  ASSERT_THROW(que[0], std::out_of_range);
+}
+
+TEST(Indexed_priority_queue, decrease_key) {
+  s21::indexed_priority_queue<int, std::greater<int>> que;
+  s21::vector<size_t> handles;
+  for (int i = 0; i < 100; i++) handles.push_back(que.push(1000 + i));
+  que.decrease_key(handles[77], 5);
+  ASSERT_EQ(que.top_handle(), handles[77]);
+  que.decrease_key(handles[40], 5);
+  ASSERT_EQ(que.top(), 5);
+  que.pop();
+  que.pop();
+  ASSERT_EQ(que.top(), 1000);
+}
+
+TEST(Indexed_priority_queue, update_both_ways) {
+  s21::indexed_priority_queue<int, std::less<int>, 2> que;
+  s21::vector<size_t> handles;
+  for (int i = 0; i < 50; i++) handles.push_back(que.push(i));
+  que.update(handles[49], -1);
+  ASSERT_EQ(que.top(), 48);
+  que.update(handles[0], 100);
+  ASSERT_EQ(que.top_handle(), handles[0]);
+  int previous = que.top();
+  while (!que.empty()) {
+    ASSERT_LE(que.top(), previous);
+    previous = que.top();
+    que.pop();
+  }
+  ASSERT_EQ(previous, -1);
+}
+
+TEST(Indexed_priority_queue, erase_and_reuse_handles) {
+  s21::indexed_priority_queue<std::string> que;
+  auto a = que.push("a");
+  auto b = que.push("b");
+  auto c = que.emplace(3, 'c');
+  que.erase(b);
+  ASSERT_FALSE(que.contains(b));
+  ASSERT_THROW(que.erase(b), std::out_of_range);
+  ASSERT_EQ(que.size(), 2);
+  ASSERT_EQ(que.top(), "ccc");
+  auto d = que.push("d");
+  ASSERT_EQ(d, b);
+  ASSERT_EQ(que.top(), "d");
+  ASSERT_EQ(que[a], "a");
+  ASSERT_EQ(que[c], "ccc");
+  que.clear();
+  ASSERT_TRUE(que.empty());
+  ASSERT_FALSE(que.contains(a));
+}
+
+// erases pseudo-random handles and checks the pop order against a multiset
+TEST(Indexed_priority_queue, random_erase_matches_multiset) {
+  s21::indexed_priority_queue<int> que;
+  std::multiset<int> expected;
+  s21::vector<size_t> live;
+  unsigned seed = 99;
+  for (int i = 0; i < 3000; i++) {
+    seed = seed * 1103515245 + 12345;
+    int value = static_cast<int>(seed >> 16) % 500;
+    if (seed % 4 != 0 || live.empty()) {
+      live.push_back(que.push(value));
+      expected.insert(value);
+    } else {
+      size_t index = (seed >> 8) % live.size();
+      size_t h = live[index];
+      expected.erase(expected.find(que[h]));
+      que.erase(h);
+      live[index] = live.back();
+      live.pop_back();
+    }
+  }
+  ASSERT_EQ(que.size(), expected.size());
+  for (auto it = expected.rbegin(); it != expected.rend(); ++it) {
+    ASSERT_EQ(que.top(), *it);
+    que.pop();
+  }
+}
+
+// shortest paths on a small graph, checked against the known distances
+TEST(Indexed_priority_queue, dijkstra) {
+  const int n = 6;
+  const int inf = 1 << 30;
+  int weight[n][n] = {{0, 7, 9, 0, 0, 14}, {7, 0, 10, 15, 0, 0},
+                      {9, 10, 0, 11, 0, 2}, {0, 15, 11, 0, 6, 0},
+                      {0, 0, 0, 6, 0, 9},  {14, 0, 2, 0, 9, 0}};
+  s21::indexed_priority_queue<std::pair<int, int>,
+                              std::greater<std::pair<int, int>>>
+      que;
+  s21::vector<size_t> handle(n);
+  s21::vector<int> dist(n);
+  for (int v = 0; v < n; v++) {
+    dist[v] = v == 0 ? 0 : inf;
+    handle[v] = que.push({dist[v], v});
+  }
+  while (!que.empty()) {
+    int u = que.top().second;
+    que.pop();
+    for (int v = 0; v < n; v++) {
+      if (weight[u][v] && que.contains(handle[v]) &&
+          dist[u] + weight[u][v] < dist[v]) {
+        dist[v] = dist[u] + weight[u][v];
+        que.decrease_key(handle[v], {dist[v], v});
+      }
+    }
+  }
+  int expected[n] = {0, 7, 9, 20, 20, 11};
+  for (int v = 0; v < n; v++) ASSERT_EQ(dist[v], expected[v]);
+}
@@ -33,6 +33,54 @@ TEST(Constructor_queue, assignment_operator_for_moving_object) {
   ASSERT_EQ(que.size(), 4);
 }
 
+TEST(Constructor_queue, move_takes_the_nodes) {
+  static_assert(std::is_nothrow_move_constructible<s21::queue<int>>::value);
+  static_assert(std::is_nothrow_move_assignable<s21::queue<int>>::value);
+  s21::queue<std::string> que = {"a", "b", "c"};
+  const std::string *front = &que.front();
+  s21::queue<std::string> que2(std::move(que));
+  ASSERT_EQ(&que2.front(), front);
+  ASSERT_TRUE(que.empty());
+
+  // assigning over a non-empty queue frees its nodes
+  s21::queue<std::string> que3 = {"x", "y"};
+  que3 = std::move(que2);
+  ASSERT_EQ(&que3.front(), front);
+  ASSERT_EQ(que3.size(), 3);
+  ASSERT_EQ(que3.back(), "c");
+  ASSERT_TRUE(que2.empty());
+  que2.push("d");
+  ASSERT_EQ(que2.front(), "d");
+}
+
+TEST(Constructor_queue, queues_in_vector) {
+  static_assert(s21::is_trivially_relocatable<s21::linked_list<int>>::value);
+  static_assert(s21::is_trivially_relocatable<s21::queue<int>>::value);
+  static_assert(s21::is_trivially_relocatable<s21::pmr::queue<int>>::value);
+  s21::vector<s21::queue<int>> queues;
+  for (int i = 0; i < 100; i++) {
+    s21::queue<int> que;
+    for (int j = 0; j <= i; j++) que.push(j);
+    queues.push_back(std::move(que));
+  }
+  for (int i = 0; i < 100; i++) {
+    ASSERT_EQ(queues[i].size(), static_cast<size_t>(i + 1));
+    ASSERT_EQ(queues[i].back(), i);
+  }
+}
+
+TEST(Method_queue, push_after_copy_and_drain) {
+  s21::queue<int> que = {1, 2};
+  s21::queue<int> copy(que);
+  copy.push(3);
+  ASSERT_EQ(copy.back(), 3);
+  ASSERT_EQ(copy.size(), 3);
+  while (!copy.empty()) copy.pop();
+  copy.push(4);
+  ASSERT_EQ(copy.front(), 4);
+  ASSERT_EQ(copy.back(), 4);
+}
+
 TEST(Method_queue, empty1) {
   s21::queue<int> que;
   que = s21::queue<int>{1, 2, 34, 5};
@@ -96,4 +144,78 @@ TEST(Method_queue, insert_many_back2) {
 
   ASSERT_EQ(que.front(), 15);
   ASSERT_EQ(que.back(), 234);
-}
\ No newline at end of file
+}
+TEST(Method_queue, ring_buffer_container) {
+  s21::queue<int, s21::ring_buffer<int>> que = {1, 2, 3};
+  for (int i = 4; i < 100; i++) {
+    que.push(i);
+    ASSERT_EQ(que.front(), i - 3);
+    que.pop();
+  }
+  ASSERT_EQ(que.size(), 3);
+  ASSERT_EQ(que.back(), 99);
+  s21::queue<int, s21::ring_buffer<int>> moved(std::move(que));
+  ASSERT_TRUE(que.empty());
+  ASSERT_EQ(moved.front(), 97);
+}
+TEST(Method_queue, deque_container) {
+  s21::queue<std::string, s21::deque<std::string, 4>> que;
+  for (int i = 0; i < 50; i++) que.push(std::to_string(i));
+  const std::string *last = &que.back();
+  for (int i = 0; i < 45; i++) {
+    ASSERT_EQ(que.front(), std::to_string(i));
+    que.pop();
+  }
+  ASSERT_EQ(&que.back(), last);
+  ASSERT_EQ(que.size(), 5);
+}
+
+TEST(Method_queue, emplace_builds_in_place) {
+  Tracked::reset();
+  s21::queue<Tracked> que;
+  que.emplace(1, "one");
+  que.push(Tracked(2, "two"));
+  ASSERT_EQ(Tracked::copies, 0);
+  ASSERT_EQ(Tracked::moves, 1);
+  ASSERT_EQ(que.front().name, "one");
+  ASSERT_EQ(que.back().name, "two");
+}
+
+TEST(Method_queue, insert_many_back_forwards) {
+  Tracked::reset();
+  s21::queue<Tracked> que;
+  Tracked kept(1, "kept");
+  que.insert_many_back(kept, Tracked(2, "moved"));
+  ASSERT_EQ(Tracked::copies, 1);
+  ASSERT_EQ(Tracked::moves, 1);
+  ASSERT_EQ(que.back().name, "moved");
+}
+
+TEST(Method_queue, push_move_only) {
+  s21::queue<std::unique_ptr<int>> que;
+  que.push(std::make_unique<int>(5));
+  que.emplace(new int(7));
+  ASSERT_EQ(*que.front(), 5);
+  que.pop();
+  ASSERT_EQ(*que.front(), 7);
+}
+
+TEST(Method_queue, allocator_extended_constructors) {
+  {
+    using alloc = CountingAllocator<int>;
+    using queue = s21::queue<int, s21::linked_list<int, alloc>>;
+    static_assert(std::uses_allocator<queue, alloc>::value);
+    queue que({1, 2}, alloc(1));
+    queue moved(std::move(que), alloc(2));
+    moved.push(3);
+    ASSERT_EQ(moved.front(), 1);
+    ASSERT_EQ(moved.back(), 3);
+    // unequal allocators: the moved-from queue keeps its two nodes
+    ASSERT_EQ(CountingAllocator<char>::live, 5);
+  }
+  ASSERT_EQ(CountingAllocator<char>::live, 0);
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::queue<std::string> que(&arena);
+  que.emplace(2, 'q');
+  ASSERT_EQ(que.front(), "qq");
+}
@@ -0,0 +1,91 @@
+#include "s21_test.h"
+
+namespace {
+
+template <typename T>
+s21::vector<T> make_keys(size_t n) {
+  s21::vector<T> keys;
+  uint64_t x = 88172645463325252ull;
+  for (size_t i = 0; i < n; i++) {
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    keys.push_back(static_cast<T>(x));
+  }
+  return keys;
+}
+
+template <typename T>
+void check_sorted_like_std(s21::vector<T> keys) {
+  std::vector<T> expected(keys.begin(), keys.end());
+  std::sort(expected.begin(), expected.end());
+  s21::radix_sort(keys);
+  ASSERT_TRUE(std::equal(keys.begin(), keys.end(), expected.begin()));
+}
+
+}  // namespace
+
+TEST(RadixSort, integers) {
+  for (size_t n : {0, 1, 2, 3, 100, 5000}) {
+    check_sorted_like_std(make_keys<uint64_t>(n));
+    check_sorted_like_std(make_keys<int64_t>(n));
+    check_sorted_like_std(make_keys<uint32_t>(n));
+    check_sorted_like_std(make_keys<int32_t>(n));
+    check_sorted_like_std(make_keys<int16_t>(n));
+    check_sorted_like_std(make_keys<int8_t>(n));
+  }
+}
+
+TEST(RadixSort, narrow_range_skips_digits) {
+  s21::vector<int64_t> keys = make_keys<int64_t>(1000);
+  for (int64_t &key : keys) key = key % 200 - 100;
+  check_sorted_like_std(keys);
+}
+
+TEST(RadixSort, floats) {
+  s21::vector<double> keys{3.5,   -0.0,  -1e300, 1e-300,
+                           0.0,   -2.25, 1e300,  -1e-300};
+  s21::radix_sort(keys);
+  ASSERT_EQ(keys[0], -1e300);
+  ASSERT_EQ(keys[1], -2.25);
+  ASSERT_EQ(keys[2], -1e-300);
+  ASSERT_TRUE(std::signbit(keys[3]));
+  ASSERT_FALSE(std::signbit(keys[4]));
+  ASSERT_EQ(keys[7], 1e300);
+
+  s21::vector<float> values;
+  for (int32_t key : make_keys<int32_t>(3000)) {
+    values.push_back(static_cast<float>(key) / 1024.0f);
+  }
+  check_sorted_like_std(values);
+}
+
+TEST(RadixSort, key_extractor_is_stable) {
+  struct Item {
+    uint64_t id;
+    std::string name;
+  };
+  s21::vector<Item> items;
+  s21::vector<uint64_t> ids = make_keys<uint64_t>(2000);
+  for (size_t i = 0; i < ids.size(); i++) {
+    items.push_back({ids[i] % 50, std::to_string(i)});
+  }
+  std::vector<Item> expected(items.begin(), items.end());
+  auto by_id = [](const Item &a, const Item &b) { return a.id < b.id; };
+  std::stable_sort(expected.begin(), expected.end(), by_id);
+
+  s21::radix_sort(items, [](const Item &item) { return item.id; });
+
+  for (size_t i = 0; i < items.size(); i++) {
+    ASSERT_EQ(items[i].id, expected[i].id);
+    ASSERT_EQ(items[i].name, expected[i].name);
+  }
+}
+
+TEST(RadixSort, array) {
+  s21::array<int, 6> keys{5, -3, 9, 0, -3, 2};
+  s21::radix_sort(keys);
+  ASSERT_EQ(keys[0], -3);
+  ASSERT_EQ(keys[1], -3);
+  ASSERT_EQ(keys[5], 9);
+}
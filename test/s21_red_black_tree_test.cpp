@@ -252,4 +252,25 @@ TEST(RedBlackTree, merge) {
   for (auto iter = tree.begin(); iter != tree.end(); iter++, it++) {
     EXPECT_EQ(*iter, *it);
   }
-}
\ No newline at end of file
+}
+TEST(RedBlackTree, CopyOwnsItsNodes) {
+  using alloc = CountingAllocator<std::pair<int, int>>;
+  {
+    s21::RedBlackTree<std::pair<int, int>, int, int, alloc> tree;
+    for (int i = 0; i < 10; i++) tree.insert({i, i});
+    s21::RedBlackTree<std::pair<int, int>, int, int, alloc> copy(tree);
+    tree.clear();
+    copy.insert({20, 20});
+    EXPECT_EQ(copy.size(), 11);
+    int expected = 0;
+    for (auto it = copy.begin(); it != copy.end(); ++it, ++expected) {
+      if (expected == 10) expected = 20;
+      EXPECT_EQ(it->first, expected);
+    }
+    s21::RedBlackTree<std::pair<int, int>, int, int, alloc> moved(
+        std::move(copy));
+    EXPECT_EQ(moved.size(), 11);
+    EXPECT_EQ(copy.size(), 0);
+  }
+  EXPECT_EQ(CountingAllocator<char>::live, 0);
+}
@@ -0,0 +1,147 @@
+#include "s21_test.h"
+
+namespace {
+
+template <typename T>
+std::vector<T> contents(const s21::ring_buffer<T> &ring) {
+  return std::vector<T>(ring.begin(), ring.end());
+}
+
+}  // namespace
+
+TEST(Constructor_ring_buffer, default_and_init_list) {
+  s21::ring_buffer<int> empty;
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.capacity(), 0);
+  ASSERT_TRUE(empty.begin() == empty.end());
+
+  s21::ring_buffer<int> ring{1, 2, 3};
+  ASSERT_EQ(contents(ring), (std::vector<int>{1, 2, 3}));
+  ASSERT_EQ(ring.capacity(), 8);
+
+  s21::ring_buffer<std::string> sized(20);
+  ASSERT_EQ(sized.size(), 20);
+  ASSERT_EQ(sized.capacity(), 32);
+  ASSERT_EQ(sized.back(), "");
+}
+
+TEST(Constructor_ring_buffer, copy_and_move_wrapped) {
+  s21::ring_buffer<std::string> ring;
+  for (int i = 0; i < 6; i++) ring.push_back(std::to_string(i));
+  for (int i = 0; i < 4; i++) ring.pop_front();
+  for (int i = 6; i < 11; i++) ring.push_back(std::to_string(i));
+  // the elements now wrap around the end of the array
+  ASSERT_EQ(ring.capacity(), 8);
+  ASSERT_EQ(contents(ring),
+            (std::vector<std::string>{"4", "5", "6", "7", "8", "9", "10"}));
+
+  s21::ring_buffer<std::string> copy(ring);
+  ASSERT_EQ(contents(copy), contents(ring));
+  const std::string *front = &ring.front();
+  s21::ring_buffer<std::string> moved(std::move(ring));
+  ASSERT_EQ(&moved.front(), front);
+  ASSERT_TRUE(ring.empty());
+
+  ring = copy;
+  ASSERT_EQ(contents(ring), contents(moved));
+  copy = std::move(moved);
+  ASSERT_EQ(copy.size(), 7);
+  ASSERT_TRUE(moved.empty());
+}
+
+TEST(Method_ring_buffer, both_ends_match_std_deque) {
+  s21::ring_buffer<int> ring;
+  std::deque<int> expected;
+  unsigned x = 3;
+  for (int step = 0; step < 20000; step++) {
+    x = x * 1103515245 + 12345;
+    unsigned op = (x >> 16) % 8;
+    if (op < 3 || expected.empty()) {
+      ring.push_back(step);
+      expected.push_back(step);
+    } else if (op < 5) {
+      ring.push_front(step);
+      expected.push_front(step);
+    } else if (op < 7) {
+      ring.pop_front();
+      expected.pop_front();
+    } else {
+      ring.pop_back();
+      expected.pop_back();
+    }
+    ASSERT_EQ(ring.size(), expected.size());
+    if (!expected.empty()) {
+      ASSERT_EQ(ring.front(), expected.front());
+      ASSERT_EQ(ring.back(), expected.back());
+    }
+  }
+  ASSERT_TRUE(std::equal(expected.begin(), expected.end(), ring.begin()));
+  for (size_t i = 0; i < expected.size(); i++) {
+    ASSERT_EQ(ring[i], expected[i]);
+  }
+}
+
+TEST(Method_ring_buffer, steady_state_does_not_grow) {
+  s21::ring_buffer<int> ring;
+  for (int i = 0; i < 5; i++) ring.push_back(i);
+  for (int i = 5; i < 10000; i++) {
+    ring.push_back(i);
+    ASSERT_EQ(ring.front(), i - 5);
+    ring.pop_front();
+  }
+  ASSERT_EQ(ring.capacity(), 8);
+}
+
+TEST(Method_ring_buffer, push_own_element_while_growing) {
+  s21::ring_buffer<std::string> ring;
+  for (int i = 0; i < 8; i++) ring.push_back(std::string(30, 'a' + i));
+  ring.push_back(ring.front());
+  ring.push_front(ring.back());
+  ASSERT_EQ(ring.size(), 10);
+  ASSERT_EQ(ring.capacity(), 16);
+  ASSERT_EQ(ring.front(), std::string(30, 'a'));
+  ASSERT_EQ(ring[1], std::string(30, 'a'));
+  ASSERT_EQ(ring.back(), std::string(30, 'a'));
+}
+
+TEST(Method_ring_buffer, reserve_shrink_and_errors) {
+  s21::ring_buffer<std::unique_ptr<int>> ring;
+  ring.reserve(100);
+  ASSERT_EQ(ring.capacity(), 128);
+  for (int i = 0; i < 10; i++) ring.emplace_front(new int(i));
+  ring.shrink_to_fit();
+  ASSERT_EQ(ring.capacity(), 16);
+  ASSERT_EQ(*ring.front(), 9);
+  ASSERT_EQ(*ring.at(9), 0);
+  EXPECT_THROW(ring.at(10), std::out_of_range);
+  ring.clear();
+  EXPECT_THROW(ring.pop_back(), std::out_of_range);
+  EXPECT_THROW(ring.pop_front(), std::out_of_range);
+  ring.shrink_to_fit();
+  ASSERT_EQ(ring.capacity(), 0);
+  EXPECT_THROW(ring.reserve(ring.max_size() + 1), std::length_error);
+}
+
+TEST(Method_ring_buffer, random_access_iterators) {
+  s21::ring_buffer<int> ring;
+  for (int i = 0; i < 6; i++) ring.push_front(i);
+  std::sort(ring.begin(), ring.end());
+  ASSERT_EQ(contents(ring), (std::vector<int>{0, 1, 2, 3, 4, 5}));
+  const auto &view = ring;
+  auto it = std::lower_bound(view.begin(), view.end(), 3);
+  ASSERT_EQ(it - view.begin(), 3);
+  ASSERT_EQ(it[1], 4);
+  ASSERT_EQ(*(2 + view.begin()), 2);
+  ASSERT_TRUE(view.end() - 1 > it);
+}
+
+TEST(Method_ring_buffer, over_aligned_elements) {
+  s21::ring_buffer<CacheLine> ring;
+  for (int i = 0; i < 9; i++) ring.push_back(CacheLine{i});
+  ring.push_front(CacheLine{-1});
+  for (const CacheLine &line : ring) ASSERT_TRUE(is_aligned(&line));
+  ASSERT_EQ(ring.front().value, -1);
+  s21::queue<CacheLine, s21::ring_buffer<CacheLine>> que;
+  que.push(CacheLine{7});
+  ASSERT_TRUE(is_aligned(&que.front()));
+}
@@ -463,4 +463,33 @@ TEST(Set, InsertMany) {
   EXPECT_TRUE(s4.contains("one"));
   EXPECT_TRUE(s4.contains("two"));
   EXPECT_TRUE(s4.contains("three"));
-}
\ No newline at end of file
+}
+
+TEST(Set, AllocatorBalances) {
+  {
+    using alloc = CountingAllocator<int>;
+    s21::set<int, alloc> s({5, 1, 3}, alloc(1));
+    s21::set<int, alloc> other{alloc(1)};
+    other.insert(7);
+    other.swap(s);
+    EXPECT_EQ(other.size(), 3);
+    s21::set<int, alloc> copy(other);
+    copy.insert(9);
+    EXPECT_EQ(copy.size(), 4);
+    EXPECT_EQ(copy.get_allocator().id, 1);
+    EXPECT_TRUE(other.contains(1));
+  }
+  EXPECT_EQ(CountingAllocator<char>::live, 0);
+}
+
+TEST(Set, PmrResource) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::set<std::string> s(&arena);
+  s.insert("b");
+  s.insert_many("a", "c");
+  EXPECT_EQ(s.get_allocator().resource(), &arena);
+  s21::pmr::set<std::string> moved(std::move(s));
+  EXPECT_EQ(moved.get_allocator().resource(), &arena);
+  EXPECT_EQ(*moved.begin(), "a");
+  EXPECT_EQ(moved.size(), 3);
+}
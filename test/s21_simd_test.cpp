@@ -0,0 +1,84 @@
+#include "s21_test.h"
+
+namespace {
+
+const s21::simd::isa kIsas[] = {s21::simd::isa::scalar, s21::simd::isa::sse2,
+                                s21::simd::isa::avx2};
+
+// small integers keep floating point sums exact in any order
+template <typename T>
+s21::vector<T> make_data(size_t n) {
+  s21::vector<T> data;
+  for (size_t i = 0; i < n; i++) {
+    data.push_back(static_cast<T>(static_cast<int>((i * 37 + 11) % 101) - 50));
+  }
+  return data;
+}
+
+// compares every kernel with the std:: algorithm for sizes around the
+// register widths and the unrolled loop
+template <typename T>
+void check_against_std() {
+  for (s21::simd::isa isa : kIsas) {
+    s21::simd::limit_isa(isa);
+    for (size_t n = 0; n < 80; n++) {
+      s21::vector<T> data = make_data<T>(n);
+      const T *first = data.begin(), *last = data.end();
+      for (T value : {T(-50), T(0), T(7), T(50), T(99)}) {
+        ASSERT_EQ(s21::simd::find(data, value), std::find(first, last, value));
+        ASSERT_EQ(s21::simd::count(data, value),
+                  static_cast<size_t>(std::count(first, last, value)));
+        ASSERT_EQ(s21::simd::any_greater(data, value),
+                  std::any_of(first, last, [&](T x) { return x > value; }));
+      }
+      s21::simd::sum_type<T> expected = 0;
+      for (T x : data) expected += x;
+      ASSERT_EQ(s21::simd::sum(data), expected);
+      if (n > 0) {
+        ASSERT_EQ(s21::simd::min(data), *std::min_element(first, last));
+        ASSERT_EQ(s21::simd::max(data), *std::max_element(first, last));
+      }
+    }
+  }
+  s21::simd::limit_isa(s21::simd::isa::avx2);
+}
+
+}  // namespace
+
+TEST(Simd, int32) { check_against_std<int32_t>(); }
+
+TEST(Simd, float) { check_against_std<float>(); }
+
+TEST(Simd, double) { check_against_std<double>(); }
+
+TEST(Simd, scalar_types) {
+  check_against_std<int16_t>();
+  check_against_std<int64_t>();
+}
+
+TEST(Simd, int32_sum_does_not_overflow) {
+  s21::vector<int32_t> data(1000);
+  std::fill(data.begin(), data.end(), std::numeric_limits<int32_t>::max());
+  ASSERT_EQ(s21::simd::sum(data),
+            int64_t{1000} * std::numeric_limits<int32_t>::max());
+}
+
+TEST(Simd, empty_range) {
+  s21::vector<float> data;
+  ASSERT_EQ(s21::simd::find(data, 1.0f), data.end());
+  ASSERT_EQ(s21::simd::count(data, 1.0f), 0);
+  ASSERT_EQ(s21::simd::sum(data), 0.0f);
+  ASSERT_FALSE(s21::simd::any_greater(data, 0.0f));
+  EXPECT_THROW(s21::simd::min(data), std::out_of_range);
+  EXPECT_THROW(s21::simd::max(data), std::out_of_range);
+}
+
+TEST(Simd, array_and_pointer_range) {
+  s21::array<int, 10> data{5, 1, 9, -3, 7, 2, 8, 0, 4, 6};
+  ASSERT_EQ(s21::simd::min(data), -3);
+  ASSERT_EQ(s21::simd::max(data), 9);
+  ASSERT_EQ(s21::simd::sum(data), 39);
+  ASSERT_EQ(*s21::simd::find(data, 8), 8);
+  ASSERT_EQ(s21::simd::count(data.data() + 2, data.data() + 5, 9), 1);
+  ASSERT_LE(s21::simd::active_isa(), s21::simd::supported_isa());
+}
@@ -0,0 +1,113 @@
+#include "s21_test.h"
+
+TEST(Constructor_small_vector, Default) {
+  s21::small_vector<int, 4> data;
+  ASSERT_EQ(data.size(), 0);
+  ASSERT_EQ(data.capacity(), 4);
+  ASSERT_TRUE(data.is_small());
+  ASSERT_EQ(data.data(), nullptr);
+}
+
+TEST(Constructor_small_vector, init_list_inline_and_heap) {
+  s21::small_vector<int, 4> small{1, 2, 3};
+  s21::small_vector<int, 4> big{1, 2, 3, 4, 5, 6};
+  ASSERT_TRUE(small.is_small());
+  ASSERT_FALSE(big.is_small());
+  ASSERT_EQ(small[2], 3);
+  ASSERT_EQ(big[5], 6);
+  ASSERT_EQ(big.capacity(), 6);
+}
+
+TEST(Constructor_small_vector, copy) {
+  s21::small_vector<std::string, 2> data{"a", "b", "c"};
+  s21::small_vector<std::string, 2> copy(data);
+  ASSERT_EQ(copy.size(), 3);
+  ASSERT_EQ(copy[2], "c");
+  ASSERT_EQ(data[2], "c");
+}
+
+TEST(Constructor_small_vector, move_inline) {
+  s21::small_vector<std::string, 4> data{"one", "two"};
+  s21::small_vector<std::string, 4> moved(std::move(data));
+  ASSERT_TRUE(moved.is_small());
+  ASSERT_EQ(moved.size(), 2);
+  ASSERT_EQ(moved[1], "two");
+  ASSERT_EQ(data.size(), 0);
+  data.push_back("again");
+  ASSERT_EQ(data[0], "again");
+}
+
+TEST(Constructor_small_vector, move_heap) {
+  s21::small_vector<int, 2> data{1, 2, 3, 4};
+  const int *buffer = data.data();
+  s21::small_vector<int, 2> moved(std::move(data));
+  ASSERT_EQ(moved.data(), buffer);
+  ASSERT_TRUE(data.is_small());
+  ASSERT_EQ(data.size(), 0);
+  ASSERT_EQ(data.capacity(), 2);
+}
+
+TEST(Operator_small_vector, move_assignment) {
+  s21::small_vector<std::string, 2> data{"a", "b", "c"};
+  s21::small_vector<std::string, 2> small{"x"};
+  data = std::move(small);
+  ASSERT_TRUE(data.is_small());
+  ASSERT_EQ(data.size(), 1);
+  ASSERT_EQ(data[0], "x");
+}
+
+TEST(Method_small_vector, spill_and_shrink) {
+  s21::small_vector<std::unique_ptr<int>, 4> data;
+  for (int i = 0; i < 4; i++) data.emplace_back(new int(i));
+  ASSERT_TRUE(data.is_small());
+  data.emplace(data.begin() + 1, new int(10));
+  ASSERT_FALSE(data.is_small());
+  ASSERT_EQ(*data[1], 10);
+  data.erase(data.begin());
+  data.pop_back();
+  data.shrink_to_fit();
+  ASSERT_TRUE(data.is_small());
+  ASSERT_EQ(data.size(), 3);
+  ASSERT_EQ(*data[0], 10);
+  ASSERT_EQ(*data[2], 2);
+}
+
+TEST(Method_small_vector, swap_mixed) {
+  s21::small_vector<int, 3> small{1, 2};
+  s21::small_vector<int, 3> big{5, 6, 7, 8};
+  small.swap(big);
+  ASSERT_EQ(small.size(), 4);
+  ASSERT_FALSE(small.is_small());
+  ASSERT_EQ(small[3], 8);
+  ASSERT_EQ(big.size(), 2);
+  ASSERT_TRUE(big.is_small());
+  ASSERT_EQ(big[1], 2);
+}
+
+TEST(Method_small_vector, insert_assign_resize) {
+  s21::small_vector<int, 8> data{1, 5};
+  std::vector<int> source{2, 3, 4};
+  data.insert(data.begin() + 1, source.begin(), source.end());
+  data.insert(data.end(), 2, 9);
+  data.insert_many_back(10, 11);
+  std::vector<int> expected{1, 2, 3, 4, 5, 9, 9, 10, 11};
+  ASSERT_EQ(data.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) ASSERT_EQ(data[i], expected[i]);
+  data.resize(3);
+  ASSERT_EQ(data.back(), 3);
+  data.assign(2, 7);
+  ASSERT_EQ(data.size(), 2);
+  ASSERT_EQ(data.front(), 7);
+  EXPECT_ANY_THROW(data.at(2));
+}
+
+TEST(Method_small_vector, over_aligned_elements) {
+  s21::small_vector<CacheLine, 2> data;
+  for (int i = 0; i < 9; i++) data.push_back(CacheLine{i});
+  ASSERT_FALSE(data.is_small());
+  for (const CacheLine &line : data) ASSERT_TRUE(is_aligned(&line));
+  data.resize(2);
+  data.shrink_to_fit();
+  ASSERT_TRUE(is_aligned(data.data()));
+  ASSERT_EQ(data[1].value, 1);
+}
@@ -0,0 +1,114 @@
+#include "s21_test.h"
+
+TEST(Method_spsc_queue, push_pop_until_full_and_empty) {
+  s21::spsc_queue<std::string, 4> queue;
+  ASSERT_EQ(queue.capacity(), 4);
+  ASSERT_TRUE(queue.empty());
+  std::string out;
+  ASSERT_FALSE(queue.try_pop(out));
+
+  std::string first = "first";
+  ASSERT_TRUE(queue.try_push(first));
+  ASSERT_TRUE(queue.try_push(std::string(40, 'x')));
+  ASSERT_TRUE(queue.emplace(3, 'y'));
+  ASSERT_TRUE(queue.emplace("last"));
+  ASSERT_FALSE(queue.try_push("overflow"));
+  ASSERT_EQ(queue.size(), 4);
+
+  ASSERT_TRUE(queue.try_pop(out));
+  ASSERT_EQ(out, "first");
+  ASSERT_TRUE(queue.try_push("wrapped"));
+  for (std::string expected :
+       {std::string(40, 'x'), std::string("yyy"), std::string("last"),
+        std::string("wrapped")}) {
+    ASSERT_TRUE(queue.try_pop(out));
+    ASSERT_EQ(out, expected);
+  }
+  ASSERT_FALSE(queue.try_pop(out));
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST(Method_spsc_queue, bulk_operations_wrap_around) {
+  s21::spsc_queue<int, 8> queue;
+  std::vector<int> in(20);
+  std::iota(in.begin(), in.end(), 0);
+  ASSERT_EQ(queue.push_bulk(in.begin(), 5), 5);
+  std::vector<int> out;
+  ASSERT_EQ(queue.pop_bulk(std::back_inserter(out), 3), 3);
+  // 2 left, so only 6 of the next 10 fit and the ring wraps
+  ASSERT_EQ(queue.push_bulk(in.begin() + 5, 10), 6);
+  ASSERT_EQ(queue.size(), 8);
+  ASSERT_EQ(queue.pop_bulk(std::back_inserter(out), 100), 8);
+  ASSERT_EQ(out, std::vector<int>(in.begin(), in.begin() + 11));
+  ASSERT_EQ(queue.pop_bulk(std::back_inserter(out), 100), 0);
+}
+
+// records whether every copy was built at an address aligned for it
+struct AlignedProbe : CacheLine {
+  static inline bool misaligned = false;
+  explicit AlignedProbe(int v) : CacheLine{v} { check(); }
+  AlignedProbe(const AlignedProbe &other) : CacheLine(other) { check(); }
+  AlignedProbe &operator=(const AlignedProbe &) = default;
+  void check() const { misaligned = misaligned || !is_aligned(this); }
+};
+
+TEST(Method_spsc_queue, over_aligned_elements) {
+  s21::spsc_queue<AlignedProbe, 16> queue;
+  for (int i = 0; i < 10; i++) ASSERT_TRUE(queue.try_push(AlignedProbe(i)));
+  AlignedProbe out(-1);
+  ASSERT_TRUE(queue.try_pop(out));
+  ASSERT_EQ(out.value, 0);
+  ASSERT_FALSE(AlignedProbe::misaligned);
+}
+
+TEST(Method_spsc_queue, move_only_and_leftovers) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::spsc_queue<std::shared_ptr<int>, 16> queue;
+    for (int i = 0; i < 10; i++) ASSERT_TRUE(queue.try_push(counter));
+    std::shared_ptr<int> out;
+    ASSERT_TRUE(queue.try_pop(out));
+    ASSERT_EQ(counter.use_count(), 11);
+  }
+  // the destructor released the nine elements still queued
+  ASSERT_EQ(counter.use_count(), 1);
+
+  s21::spsc_queue<std::unique_ptr<int>, 2> owners;
+  ASSERT_TRUE(owners.emplace(new int(7)));
+  std::unique_ptr<int> owner;
+  ASSERT_TRUE(owners.try_pop(owner));
+  ASSERT_EQ(*owner, 7);
+}
+
+TEST(Method_spsc_queue, two_threads_keep_order) {
+  const int kCount = 1000000;
+  s21::spsc_queue<int, 1024> queue;
+  std::thread producer([&] {
+    int batch[16];
+    for (int i = 0; i < kCount;) {
+      if (i % 3 == 0) {
+        int n = std::min(16, kCount - i);
+        for (int j = 0; j < n; j++) batch[j] = i + j;
+        i += static_cast<int>(queue.push_bulk(batch, n));
+      } else if (queue.try_push(i)) {
+        i++;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  int expected = 0;
+  std::vector<int> batch(32);
+  while (expected < kCount) {
+    size_t n = queue.pop_bulk(batch.begin(), batch.size());
+    for (size_t j = 0; j < n; j++) ASSERT_EQ(batch[j], expected++);
+    int value;
+    if (queue.try_pop(value)) {
+      ASSERT_EQ(value, expected++);
+    } else if (n == 0) {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  ASSERT_TRUE(queue.empty());
+}
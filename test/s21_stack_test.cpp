@@ -42,6 +42,21 @@ TEST(Constructor_stack, assignment_operator_for_moving_object) {
   ASSERT_EQ(stack.top(), 1);
 }
 
+TEST(Constructor_stack, move_assignment_takes_the_nodes) {
+  static_assert(std::is_nothrow_move_constructible<s21::stack<int>>::value);
+  static_assert(std::is_nothrow_move_assignable<s21::stack<int>>::value);
+  static_assert(s21::is_trivially_relocatable<s21::stack<int>>::value);
+  s21::stack<std::string> stack = {"a", "b"};
+  s21::stack<std::string> stack_2 = {"c"};
+  const std::string *top = &stack.top();
+
+  stack_2 = std::move(stack);
+
+  ASSERT_EQ(&stack_2.top(), top);
+  ASSERT_EQ(stack_2.size(), 2);
+  ASSERT_TRUE(stack.empty());
+}
+
 TEST(Stack_methods, push_) {
   s21::stack<int> stack;
 
@@ -129,4 +144,69 @@ TEST(Method_stack, insert_many_back2) {
   stack.insert_many_back(15, 123, 234);
 
   ASSERT_EQ(stack.top(), 15);
-}
\ No newline at end of file
+}
+TEST(Method_stack, ring_buffer_container) {
+  s21::stack<std::string, s21::ring_buffer<std::string>> stack;
+  for (int i = 0; i < 20; i++) stack.push(std::to_string(i));
+  ASSERT_EQ(stack.top(), "19");
+  for (int i = 19; i >= 0; i--) {
+    ASSERT_EQ(stack.top(), std::to_string(i));
+    stack.pop();
+  }
+  ASSERT_TRUE(stack.empty());
+}
+TEST(Method_stack, deque_container) {
+  s21::stack<int, s21::deque<int, 4>> stack;
+  for (int i = 0; i < 30; i++) stack.push(i);
+  for (int i = 29; i >= 10; i--) {
+    ASSERT_EQ(stack.top(), i);
+    stack.pop();
+  }
+  ASSERT_EQ(stack.size(), 10);
+}
+
+TEST(Method_stack, emplace_builds_in_place) {
+  Tracked::reset();
+  s21::stack<Tracked> stack;
+  stack.emplace(1, "one");
+  stack.push(Tracked(2, "two"));
+  ASSERT_EQ(Tracked::copies, 0);
+  ASSERT_EQ(Tracked::moves, 1);
+  ASSERT_EQ(stack.top().name, "two");
+  s21::stack<Tracked> copy(stack);
+  ASSERT_EQ(Tracked::copies, 2);
+  ASSERT_EQ(copy.top().value, 2);
+}
+
+TEST(Method_stack, push_move_only) {
+  s21::stack<std::unique_ptr<int>> stack;
+  stack.push(std::make_unique<int>(5));
+  stack.emplace(new int(7));
+  ASSERT_EQ(*stack.top(), 7);
+  stack.pop();
+  ASSERT_EQ(*stack.top(), 5);
+}
+
+TEST(Method_stack, emplace_on_other_containers) {
+  s21::stack<std::string, s21::deque<std::string>> stack;
+  stack.emplace(3, 'a');
+  stack.emplace("b");
+  ASSERT_EQ(stack.top(), "b");
+  stack.pop();
+  ASSERT_EQ(stack.top(), "aaa");
+  s21::stack<std::string, s21::list<std::string>> list_stack;
+  list_stack.emplace(2, 'c');
+  ASSERT_EQ(list_stack.top(), "cc");
+}
+
+TEST(Method_stack, allocator_extended_constructors) {
+  std::pmr::monotonic_buffer_resource arena;
+  using alloc = std::pmr::polymorphic_allocator<int>;
+  static_assert(std::uses_allocator<s21::pmr::stack<int>, alloc>::value);
+  s21::pmr::stack<int> stack({1, 2, 3}, &arena);
+  s21::pmr::stack<int> copy(stack, std::pmr::new_delete_resource());
+  stack.pop();
+  ASSERT_EQ(stack.top(), 2);
+  ASSERT_EQ(copy.top(), 1);
+  ASSERT_EQ(copy.size(), 3);
+}
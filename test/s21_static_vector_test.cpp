@@ -0,0 +1,196 @@
+#include "s21_test.h"
+
+namespace {
+
+// trivially copyable, but not trivial because of the member initializer
+struct Point {
+  int x = 0;
+  int y = 0;
+};
+
+using checked = s21::static_vector<int, 4>;
+using unchecked = s21::static_vector<int, 4, s21::overflow_assert>;
+
+constexpr s21::static_vector<int, 8> build() {
+  s21::static_vector<int, 8> data{4, 8};
+  data.push_back(15);
+  data.emplace_back(16);
+  data.insert(data.begin(), 1);
+  data.insert(data.begin() + 1, 2, 2);
+  data.erase(data.begin() + 2);
+  data.resize(7);
+  data.pop_back();
+  return data;
+}
+
+}  // namespace
+
+TEST(Constructor_static_vector, Default) {
+  checked data;
+  ASSERT_EQ(data.size(), 0);
+  ASSERT_EQ(data.capacity(), 4);
+  ASSERT_EQ(data.max_size(), 4);
+  ASSERT_TRUE(data.empty());
+  ASSERT_EQ(data.data(), nullptr);
+}
+
+TEST(Constructor_static_vector, size_and_init_list) {
+  s21::static_vector<std::string, 3> strings(2);
+  ASSERT_EQ(strings.size(), 2);
+  ASSERT_EQ(strings[1], "");
+  checked data{1, 2, 3};
+  ASSERT_EQ(data.size(), 3);
+  ASSERT_EQ(data.front(), 1);
+  ASSERT_EQ(data.back(), 3);
+  EXPECT_THROW((checked{1, 2, 3, 4, 5}), std::length_error);
+}
+
+TEST(Constructor_static_vector, copy_move_non_trivial) {
+  s21::static_vector<std::string, 4> data{"a", "b", "c"};
+  s21::static_vector<std::string, 4> copy(data);
+  s21::static_vector<std::string, 4> moved(std::move(data));
+  ASSERT_EQ(copy.size(), 3);
+  ASSERT_EQ(copy[2], "c");
+  ASSERT_EQ(moved[0], "a");
+  s21::static_vector<std::string, 4> other{"x"};
+  other = copy;
+  ASSERT_EQ(other.size(), 3);
+  ASSERT_EQ(other[1], "b");
+  other = s21::static_vector<std::string, 4>{"y"};
+  ASSERT_EQ(other.size(), 1);
+  ASSERT_EQ(other[0], "y");
+}
+
+TEST(Layout_static_vector, trivial_copies) {
+  static_assert(std::is_trivially_copyable<checked>::value);
+  static_assert(std::is_trivially_destructible<checked>::value);
+  static_assert(
+      std::is_trivially_copyable<s21::static_vector<Point, 4>>::value);
+  static_assert(!std::is_trivially_copyable<
+                s21::static_vector<std::string, 4>>::value);
+  static_assert(sizeof(s21::static_vector<char, 16>) ==
+                sizeof(size_t) + 16);
+  static_assert(s21::is_contiguous_container<checked>::value);
+  static_assert(s21::is_trivially_relocatable<
+                s21::static_vector<std::unique_ptr<int>, 2>>::value ==
+                s21::is_trivially_relocatable<std::unique_ptr<int>>::value);
+}
+
+TEST(Layout_static_vector, large_trivial_scratch_buffer) {
+  using scratch = s21::static_vector<std::byte, 9000>;
+  static_assert(!s21::static_vector_in_array_v<std::byte, 9000>);
+  static_assert(s21::static_vector_in_array_v<int, 16>);
+  static_assert(std::is_trivially_copyable<scratch>::value);
+  scratch data;
+  ASSERT_TRUE(data.empty());
+  data.resize(100);
+  ASSERT_EQ(data[99], std::byte{0});
+  data.push_back(std::byte{7});
+  data.insert(data.begin(), std::byte{1});
+  scratch copy(data);
+  ASSERT_EQ(copy.size(), 102);
+  ASSERT_EQ(copy.front(), std::byte{1});
+  ASSERT_EQ(copy.back(), std::byte{7});
+}
+
+TEST(Constexpr_static_vector, compile_time_use) {
+  constexpr s21::static_vector<int, 8> data = build();
+  static_assert(data.size() == 6);
+  static_assert(data[0] == 1 && data[1] == 2 && data[2] == 4);
+  static_assert(data[3] == 8 && data[4] == 15 && data[5] == 16);
+  static_assert(data.at(5) == 16 && data.back() == 16);
+  constexpr s21::static_vector<int, 4> filled = [] {
+    s21::static_vector<int, 4> a, b{7};
+    a.assign(3, 5);
+    a.swap(b);
+    return b;
+  }();
+  static_assert(filled.size() == 3 && filled[2] == 5);
+  ASSERT_EQ(std::accumulate(data.begin(), data.end(), 0), 46);
+}
+
+TEST(Method_static_vector, overflow_throws_and_keeps_contents) {
+  checked data{1, 2, 3, 4};
+  EXPECT_THROW(data.push_back(5), std::length_error);
+  EXPECT_THROW(data.insert(data.begin(), 0), std::length_error);
+  EXPECT_THROW(data.insert(data.begin(), 2, 0), std::length_error);
+  EXPECT_THROW(data.resize(5), std::length_error);
+  EXPECT_THROW(data.reserve(5), std::length_error);
+  EXPECT_THROW(data.insert_many_back(5, 6), std::length_error);
+  ASSERT_EQ(data.size(), 4);
+  ASSERT_EQ(data[0], 1);
+  ASSERT_EQ(data[3], 4);
+  EXPECT_THROW(data.at(4), std::out_of_range);
+}
+
+TEST(Method_static_vector, unchecked_policy) {
+  unchecked data;
+  for (int i = 0; i < 4; i++) data.push_back(i);
+  ASSERT_EQ(data.size(), 4);
+  ASSERT_EQ(data[3], 3);
+  static_assert(noexcept(s21::overflow_assert::check(5, 4)));
+#ifndef NDEBUG
+  ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+  EXPECT_DEATH(data.push_back(4), "");
+#endif
+}
+
+TEST(Method_static_vector, insert_erase_strings) {
+  s21::static_vector<std::string, 8> data{"b", "d"};
+  data.insert(data.begin(), "a");
+  data.emplace(data.begin() + 2, 1, 'c');
+  data.insert(data.end(), 2, data[0]);
+  ASSERT_EQ(data.size(), 6);
+  const char *expected[] = {"a", "b", "c", "d", "a", "a"};
+  for (size_t i = 0; i < data.size(); i++) ASSERT_EQ(data[i], expected[i]);
+  data.erase(data.begin() + 1);
+  data.erase(data.begin());
+  ASSERT_EQ(data.front(), "c");
+  std::vector<std::string> more{"x", "y"};
+  data.insert(data.begin() + 1, more.begin(), more.end());
+  ASSERT_EQ(data[1], "x");
+  ASSERT_EQ(data[2], "y");
+  ASSERT_EQ(data.size(), 6);
+  data.resize(2, "z");
+  ASSERT_EQ(data.size(), 2);
+  data.resize(4, "z");
+  ASSERT_EQ(data[3], "z");
+  data.clear();
+  ASSERT_TRUE(data.empty());
+}
+
+TEST(Method_static_vector, insert_many_and_assign) {
+  s21::static_vector<std::unique_ptr<int>, 6> data;
+  data.push_back(std::make_unique<int>(1));
+  data.insert_many_back(std::make_unique<int>(4));
+  auto it = data.insert_many(data.begin() + 1, std::make_unique<int>(2),
+                             std::make_unique<int>(3));
+  ASSERT_EQ(it - data.begin(), 3);
+  for (int i = 0; i < 4; i++) ASSERT_EQ(*data[i], i + 1);
+  checked numbers;
+  std::list<int> source{5, 6, 7};
+  numbers.assign(source.begin(), source.end());
+  ASSERT_EQ(numbers.size(), 3);
+  numbers.assign(2, 9);
+  ASSERT_EQ(numbers.size(), 2);
+  ASSERT_EQ(numbers[1], 9);
+  numbers.append_range(std::vector<int>{1, 2});
+  ASSERT_EQ(numbers.back(), 2);
+}
+
+TEST(Method_static_vector, swap_different_sizes) {
+  s21::static_vector<std::string, 4> a{"1", "2", "3"};
+  s21::static_vector<std::string, 4> b{"x"};
+  a.swap(b);
+  ASSERT_EQ(a.size(), 1);
+  ASSERT_EQ(a[0], "x");
+  ASSERT_EQ(b.size(), 3);
+  ASSERT_EQ(b[2], "3");
+  Tracked::reset();
+  s21::static_vector<Tracked, 2> c, d;
+  c.emplace_back(1, "one");
+  d.emplace_back(2, "two");
+  c.swap(d);
+  ASSERT_EQ(c[0].value, 2);
+  ASSERT_EQ(Tracked::copies, 0);
+}
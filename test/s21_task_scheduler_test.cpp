@@ -0,0 +1,193 @@
+#include <thread>
+
+#include "s21_test.h"
+
+namespace {
+
+s21::task_scheduler &test_scheduler() {
+  static s21::task_scheduler scheduler(4);
+  return scheduler;
+}
+
+long fib(s21::task_scheduler &scheduler, int n) {
+  if (n < 12) return n < 2 ? n : fib(scheduler, n - 1) + fib(scheduler, n - 2);
+  long a = 0, b = 0;
+  s21::task_group group(scheduler);
+  group.spawn([&] { a = fib(scheduler, n - 1); });
+  b = fib(scheduler, n - 2);
+  group.wait();
+  return a + b;
+}
+
+// sorts [first, last) by spawning the left part of every partition
+void quick_sort(s21::task_scheduler &scheduler, int *first, int *last) {
+  while (last - first > 256) {
+    int pivot = first[(last - first) / 2];
+    int *middle = std::partition(first, last, [pivot](int x) {
+      return x < pivot;
+    });
+    int *upper = std::partition(middle, last, [pivot](int x) {
+      return !(pivot < x);
+    });
+    s21::task_group group(scheduler);
+    group.spawn([&scheduler, first, middle] {
+      quick_sort(scheduler, first, middle);
+    });
+    quick_sort(scheduler, upper, last);
+    group.wait();
+    return;
+  }
+  std::sort(first, last);
+}
+
+s21::vector<int> make_data(size_t n) {
+  s21::vector<int> data;
+  unsigned x = 777;
+  for (size_t i = 0; i < n; i++) {
+    x = x * 1103515245 + 12345;
+    data.push_back(static_cast<int>((x >> 8) % 100000));
+  }
+  return data;
+}
+
+}  // namespace
+
+TEST(TaskScheduler, parallel_for_visits_every_index_once) {
+  s21::task_scheduler &scheduler = test_scheduler();
+  ASSERT_EQ(scheduler.size(), 4);
+  s21::vector<std::atomic<int>> hits(5000);
+  for (size_t grain : {size_t{0}, size_t{1}, size_t{7}, size_t{10000}}) {
+    scheduler.parallel_for(0, hits.size(), [&](size_t i) { hits[i]++; },
+                           grain);
+  }
+  for (auto &hit : hits) ASSERT_EQ(hit.load(), 4);
+}
+
+TEST(TaskScheduler, parallel_for_subrange) {
+  s21::vector<std::atomic<int>> hits(100);
+  test_scheduler().parallel_for(10, 90, [&](size_t i) { hits[i]++; }, 3);
+  for (size_t i = 0; i < hits.size(); i++) {
+    ASSERT_EQ(hits[i].load(), i >= 10 && i < 90 ? 1 : 0);
+  }
+  test_scheduler().parallel_for(5, 5, [&](size_t) { FAIL(); });
+}
+
+TEST(TaskScheduler, run_like_thread_pool) {
+  s21::vector<std::atomic<int>> hits(1000);
+  for (int round = 0; round < 20; round++) {
+    test_scheduler().run(hits.size(), [&](size_t i) { hits[i]++; });
+  }
+  for (auto &hit : hits) ASSERT_EQ(hit.load(), 20);
+}
+
+TEST(TaskScheduler, single_thread_runs_inline) {
+  s21::task_scheduler scheduler(1);
+  ASSERT_EQ(scheduler.size(), 1);
+  auto caller = std::this_thread::get_id();
+  scheduler.parallel_for(0, 64, [&](size_t) {
+    ASSERT_EQ(std::this_thread::get_id(), caller);
+  });
+  s21::task_group group(scheduler);
+  int done = 0;
+  for (int i = 0; i < 10; i++) group.spawn([&] { done++; });
+  group.wait();
+  ASSERT_EQ(done, 10);
+}
+
+TEST(TaskScheduler, fork_join_recursion) {
+  ASSERT_EQ(fib(test_scheduler(), 25), 75025);
+}
+
+TEST(TaskScheduler, nested_parallel_for) {
+  std::atomic<int> done{0};
+  test_scheduler().parallel_for(0, 16, [&](size_t) {
+    test_scheduler().parallel_for(0, 100, [&](size_t) { done++; }, 1);
+  });
+  ASSERT_EQ(done.load(), 1600);
+}
+
+TEST(TaskScheduler, wait_rethrows_and_group_is_reusable) {
+  s21::task_group group(test_scheduler());
+  for (int i = 0; i < 100; i++) {
+    group.spawn([i] {
+      if (i == 42) throw std::runtime_error("task failed");
+    });
+  }
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  std::atomic<int> done{0};
+  for (int i = 0; i < 10; i++) group.spawn([&] { done++; });
+  group.wait();
+  ASSERT_EQ(done.load(), 10);
+}
+
+TEST(TaskScheduler, parallel_for_rethrows) {
+  EXPECT_THROW(test_scheduler().parallel_for(0, 1000,
+                                             [](size_t i) {
+                                               if (i == 500) {
+                                                 throw std::out_of_range("x");
+                                               }
+                                             },
+                                             1),
+               std::out_of_range);
+}
+
+// more tasks than the initial ring holds, spawned without waiting
+TEST(TaskScheduler, deque_grows) {
+  std::atomic<int> done{0};
+  s21::task_group outer(test_scheduler());
+  outer.spawn([&] {
+    s21::task_group inner(test_scheduler());
+    for (int i = 0; i < 5000; i++) inner.spawn([&] { done++; });
+    inner.wait();
+  });
+  outer.wait();
+  ASSERT_EQ(done.load(), 5000);
+}
+
+TEST(TaskScheduler, spawn_from_many_outside_threads) {
+  std::atomic<int> done{0};
+  s21::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.push_back(std::thread([&] {
+      for (int round = 0; round < 20; round++) {
+        s21::task_group group(test_scheduler());
+        for (int i = 0; i < 50; i++) group.spawn([&] { done++; });
+        group.wait();
+      }
+    }));
+  }
+  for (auto &thread : threads) thread.join();
+  ASSERT_EQ(done.load(), 4 * 20 * 50);
+}
+
+// workers fall asleep between the rounds and must wake for new tasks
+TEST(TaskScheduler, workers_wake_after_sleeping) {
+  s21::task_scheduler scheduler(3);
+  for (int round = 0; round < 3; round++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    std::atomic<int> done{0};
+    scheduler.parallel_for(0, 300, [&](size_t) { done++; }, 1);
+    ASSERT_EQ(done.load(), 300);
+  }
+}
+
+TEST(TaskScheduler, parallel_quick_sort) {
+  s21::vector<int> data = make_data(100000);
+  std::vector<int> expected(data.begin(), data.end());
+  std::sort(expected.begin(), expected.end());
+  quick_sort(test_scheduler(), data.data(), data.data() + data.size());
+  for (size_t i = 0; i < data.size(); i++) ASSERT_EQ(data[i], expected[i]);
+}
+
+TEST(TaskScheduler, policy_runs_algorithms) {
+  s21::parallel::policy policy;
+  policy.scheduler = &test_scheduler();
+  policy.grain = 100;
+  s21::vector<int> data = make_data(20000);
+  std::vector<int> expected(data.begin(), data.end());
+  std::sort(expected.begin(), expected.end());
+  s21::parallel::sort(policy, data);
+  for (size_t i = 0; i < data.size(); i++) ASSERT_EQ(data[i], expected[i]);
+  long sum = s21::parallel::reduce(policy, data, 0L);
+  ASSERT_EQ(sum, std::accumulate(expected.begin(), expected.end(), 0L));
+}
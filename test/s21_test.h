@@ -4,10 +4,16 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cmath>
+#include <cstdint>
+#include <deque>
 #include <iostream>
 #include <list>
 #include <map>
+#include <memory>
+#include <numeric>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "../s21_containers.h"
@@ -16,4 +22,83 @@
 #define DEFUALT_V \
   s21::vector<int> data { 1, 2, 3, 4 }
 
+// counts the copies and moves of its instances, to check that containers
+// build elements in place; it has no default constructor on purpose
+struct Tracked {
+  static inline int copies = 0;
+  static inline int moves = 0;
+  static void reset() { copies = moves = 0; }
+
+  Tracked(int v, std::string n) : value(v), name(std::move(n)) {}
+  Tracked(const Tracked &other) : value(other.value), name(other.name) {
+    copies++;
+  }
+  Tracked(Tracked &&other) noexcept
+      : value(other.value), name(std::move(other.name)) {
+    moves++;
+  }
+  Tracked &operator=(const Tracked &other) {
+    value = other.value;
+    name = other.name;
+    copies++;
+    return *this;
+  }
+  Tracked &operator=(Tracked &&other) noexcept {
+    value = other.value;
+    name = std::move(other.name);
+    moves++;
+    return *this;
+  }
+
+  int value;
+  std::string name;
+};
+
+// element aligned above the default new alignment, like a payload padded to
+// a cache line against false sharing
+struct alignas(64) CacheLine {
+  int value;
+};
+
+// checks that p is aligned for its pointee
+template <typename T>
+bool is_aligned(const T *p) {
+  return reinterpret_cast<uintptr_t>(p) % alignof(T) == 0;
+}
+
+// counts live allocations across all its copies and rebinds, to check that
+// containers return every block they take; instances compare equal only when
+// they share an id, so moves between them go element by element
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  static inline int live = 0;
+
+  CountingAllocator() noexcept = default;
+  explicit CountingAllocator(int i) noexcept : id(i) {}
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &other) noexcept
+      : id(other.id) {}
+
+  T *allocate(size_t n) {
+    CountingAllocator<char>::live++;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) noexcept {
+    CountingAllocator<char>::live--;
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U> &other) const noexcept {
+    return id == other.id;
+  }
+  template <typename U>
+  bool operator!=(const CountingAllocator<U> &other) const noexcept {
+    return id != other.id;
+  }
+
+  int id = 0;
+};
+
 #endif
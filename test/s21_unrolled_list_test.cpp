@@ -0,0 +1,168 @@
+#include "s21_test.h"
+
+namespace {
+
+template <typename T, size_t N>
+bool same(const s21::unrolled_list<T, N> &list, const std::list<T> &expected) {
+  if (list.size() != expected.size()) return false;
+  if (!std::equal(expected.begin(), expected.end(), list.begin())) {
+    return false;
+  }
+  // walking back from end() checks the prev_ links
+  auto it = list.end();
+  for (auto std_it = expected.rbegin(); std_it != expected.rend(); ++std_it) {
+    if (*(--it) != *std_it) return false;
+  }
+  return it == list.begin();
+}
+
+}  // namespace
+
+TEST(Constructor_unrolled_list, default_and_init_list) {
+  s21::unrolled_list<int> empty;
+  ASSERT_TRUE(empty.empty());
+  ASSERT_TRUE(empty.begin() == empty.end());
+  ASSERT_EQ(s21::unrolled_list<int>::node_capacity, 16);
+  ASSERT_EQ((s21::unrolled_list<std::array<char, 100>>::node_capacity), 4);
+
+  s21::unrolled_list<int, 4> list{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  ASSERT_TRUE(same(list, {1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  ASSERT_EQ(list.front(), 1);
+  ASSERT_EQ(list.back(), 9);
+
+  s21::unrolled_list<std::string, 2> sized(5);
+  ASSERT_EQ(sized.size(), 5);
+  ASSERT_EQ(sized.back(), "");
+}
+
+TEST(Constructor_unrolled_list, copy_and_move) {
+  s21::unrolled_list<std::string, 3> list{"a", "b", "c", "d", "e"};
+  s21::unrolled_list<std::string, 3> copy(list);
+  ASSERT_TRUE(copy == list);
+
+  const std::string *first = &list.front();
+  s21::unrolled_list<std::string, 3> moved(std::move(list));
+  ASSERT_EQ(&moved.front(), first);
+  ASSERT_TRUE(list.empty());
+
+  list = moved;
+  ASSERT_TRUE(list == moved);
+  list.push_back("f");
+  ASSERT_TRUE(list != moved);
+  copy = std::move(list);
+  ASSERT_EQ(copy.size(), 6);
+  ASSERT_EQ(copy.back(), "f");
+}
+
+TEST(Method_unrolled_list, push_and_pop_both_ends) {
+  s21::unrolled_list<int, 4> list;
+  std::list<int> expected;
+  for (int i = 0; i < 50; i++) {
+    if (i % 3 == 0) {
+      list.push_front(i);
+      expected.push_front(i);
+    } else {
+      list.push_back(i);
+      expected.push_back(i);
+    }
+  }
+  ASSERT_TRUE(same(list, expected));
+  for (int i = 0; i < 20; i++) {
+    list.pop_front();
+    expected.pop_front();
+    list.pop_back();
+    expected.pop_back();
+    ASSERT_TRUE(same(list, expected));
+  }
+  while (!list.empty()) list.pop_back();
+  EXPECT_THROW(list.pop_back(), std::out_of_range);
+  EXPECT_THROW(list.pop_front(), std::out_of_range);
+  EXPECT_THROW(list.front(), std::out_of_range);
+}
+
+TEST(Method_unrolled_list, insert_and_erase_match_std_list) {
+  s21::unrolled_list<int, 5> list;
+  std::list<int> expected;
+  unsigned x = 7;
+  for (int step = 0; step < 3000; step++) {
+    x = x * 1103515245 + 12345;
+    size_t pos = expected.empty() ? 0 : (x >> 8) % (expected.size() + 1);
+    auto it = list.begin();
+    auto std_it = expected.begin();
+    std::advance(it, pos);
+    std::advance(std_it, pos);
+    if ((x >> 4) % 5 < 3 || std_it == expected.end()) {
+      auto inserted = list.insert(it, step);
+      expected.insert(std_it, step);
+      ASSERT_EQ(*inserted, step);
+    } else {
+      auto next = list.erase(it);
+      auto std_next = expected.erase(std_it);
+      if (std_next == expected.end()) {
+        ASSERT_TRUE(next == list.end());
+      } else {
+        ASSERT_EQ(*next, *std_next);
+      }
+    }
+    if (step % 100 == 0) {
+      ASSERT_TRUE(same(list, expected));
+    }
+  }
+  ASSERT_TRUE(same(list, expected));
+  while (!expected.empty()) {
+    list.erase(list.begin());
+    expected.erase(expected.begin());
+  }
+  ASSERT_TRUE(list.empty());
+  EXPECT_THROW(list.erase(list.end()), std::out_of_range);
+}
+
+TEST(Method_unrolled_list, move_only_elements) {
+  s21::unrolled_list<std::unique_ptr<int>, 3> list;
+  for (int i = 0; i < 10; i++) list.push_back(std::make_unique<int>(i));
+  list.emplace(++list.begin(), new int(100));
+  list.emplace_front(new int(-1));
+  list.erase(++(++list.begin()));
+  std::vector<int> values;
+  for (const auto &ptr : list) values.push_back(*ptr);
+  ASSERT_EQ(values, (std::vector<int>{-1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(Method_unrolled_list, splice) {
+  s21::unrolled_list<int, 4> list{1, 2, 3, 4, 5, 6};
+  s21::unrolled_list<int, 4> other{10, 20, 30, 40, 50};
+  int *element = &*(++other.begin());
+
+  // pos in the middle of a node splits it
+  list.splice(++(++list.begin()), other);
+  ASSERT_TRUE(same(list, {1, 2, 10, 20, 30, 40, 50, 3, 4, 5, 6}));
+  ASSERT_TRUE(other.empty());
+  ASSERT_EQ(*element, 20);
+  ASSERT_EQ(&*(++(++(++list.begin()))), element);
+
+  s21::unrolled_list<int, 4> front{-2, -1};
+  s21::unrolled_list<int, 4> back{7, 8};
+  list.splice(list.begin(), front);
+  list.splice(list.end(), back);
+  list.splice(list.end(), list);
+  ASSERT_TRUE(same(list, {-2, -1, 1, 2, 10, 20, 30, 40, 50, 3, 4, 5, 6, 7, 8}));
+
+  s21::unrolled_list<int, 4> empty;
+  empty.splice(empty.begin(), list);
+  ASSERT_EQ(empty.size(), 15);
+  ASSERT_TRUE(list.empty());
+}
+
+TEST(Method_unrolled_list, std_algorithms) {
+  s21::unrolled_list<int> list;
+  for (int i = 0; i < 1000; i++) list.push_back(i % 37);
+  const auto &view = list;
+  ASSERT_EQ(std::accumulate(view.begin(), view.end(), 0L),
+            std::accumulate(list.begin(), list.end(), 0L));
+  ASSERT_EQ(std::count(list.begin(), list.end(), 36), 27);
+  std::replace(list.begin(), list.end(), 36, -1);
+  ASSERT_EQ(*std::min_element(view.begin(), view.end()), -1);
+  s21::unrolled_list<int>::const_iterator it = list.begin();
+  ASSERT_TRUE(it == view.begin());
+  ASSERT_EQ(std::distance(view.begin(), view.end()), 1000);
+}
@@ -223,4 +223,292 @@ TEST(Method, insert_many) {
   ASSERT_EQ(v[1], 4);
   ASSERT_EQ(v[2], 5);
   ASSERT_EQ(v[3], 6);
-}
\ No newline at end of file
+}
+TEST(Method, push_back_rvalue) {
+  s21::vector<std::string> data;
+  std::string value(100, 'a');
+  data.push_back(std::move(value));
+  ASSERT_EQ(data.size(), 1);
+  ASSERT_EQ(data[0], std::string(100, 'a'));
+  ASSERT_TRUE(value.empty());
+}
+
+TEST(Method, emplace_back) {
+  s21::vector<std::pair<int, std::string>> data;
+  data.emplace_back(1, "one");
+  auto &last = data.emplace_back(2, "two");
+  ASSERT_EQ(data.size(), 2);
+  ASSERT_EQ(last.first, 2);
+  ASSERT_EQ(data[0].second, "one");
+  ASSERT_EQ(data[1].second, "two");
+}
+
+TEST(Method, emplace_move_only) {
+  s21::vector<std::unique_ptr<int>> data;
+  for (int i = 0; i < 10; i++) data.emplace_back(new int(i));
+  data.emplace(data.begin() + 3, new int(100));
+  data.erase(data.begin());
+  ASSERT_EQ(data.size(), 10);
+  ASSERT_EQ(*data[2], 100);
+  ASSERT_EQ(*data[3], 3);
+  ASSERT_EQ(*data[9], 9);
+}
+
+TEST(Method, emplace_aliasing_element) {
+  s21::vector<std::string> data{"first", "second"};
+  data.push_back(data[0]);
+  data.insert(data.begin(), data[2]);
+  ASSERT_EQ(data.size(), 4);
+  ASSERT_EQ(data[0], "first");
+  ASSERT_EQ(data[3], "first");
+}
+
+TEST(Method, insert_many_back_forwarding) {
+  s21::vector<std::string> data;
+  std::string moved(50, 'x');
+  data.insert_many_back(std::move(moved), "literal", std::string("temp"));
+  ASSERT_EQ(data.size(), 3);
+  ASSERT_EQ(data[0], std::string(50, 'x'));
+  ASSERT_EQ(data[1], "literal");
+  ASSERT_EQ(data[2], "temp");
+  ASSERT_TRUE(moved.empty());
+}
+
+TEST(Method, clear_keeps_storage) {
+  DEFUALT_V;
+  data.clear();
+  data.push_back(7);
+  ASSERT_EQ(data.size(), 1);
+  ASSERT_EQ(data.capacity(), 4);
+  ASSERT_EQ(data[0], 7);
+}
+
+struct RelocatablePtr {
+  std::unique_ptr<int> ptr;
+};
+
+namespace s21 {
+template <>
+struct is_trivially_relocatable<RelocatablePtr> : std::true_type {};
+}  // namespace s21
+
+TEST(Relocation, traits) {
+  ASSERT_TRUE(s21::is_trivially_relocatable_v<int>);
+  ASSERT_TRUE((s21::is_trivially_relocatable_v<std::pair<int, double>>));
+  ASSERT_TRUE(s21::is_trivially_relocatable_v<RelocatablePtr>);
+  ASSERT_FALSE(s21::is_trivially_relocatable_v<std::string>);
+  ASSERT_FALSE((s21::is_trivially_relocatable_v<std::pair<int, std::string>>));
+}
+
+TEST(Relocation, user_declared_type) {
+  s21::vector<RelocatablePtr> data;
+  for (int i = 0; i < 20; i++) data.push_back({std::make_unique<int>(i)});
+  data.insert(data.begin() + 5, {std::make_unique<int>(100)});
+  data.erase(data.begin());
+  data.shrink_to_fit();
+  ASSERT_EQ(data.size(), 20);
+  ASSERT_EQ(data.capacity(), 20);
+  ASSERT_EQ(*data[3].ptr, 4);
+  ASSERT_EQ(*data[4].ptr, 100);
+  ASSERT_EQ(*data[5].ptr, 5);
+  ASSERT_EQ(*data[19].ptr, 19);
+}
+
+TEST(Relocation, pairs) {
+  s21::vector<std::pair<int, int>> data;
+  std::vector<std::pair<int, int>> data_std;
+  for (int i = 0; i < 100; i++) {
+    data.emplace(data.begin() + i / 2, i, -i);
+    data_std.emplace(data_std.begin() + i / 2, i, -i);
+  }
+  data.erase(data.begin() + 10);
+  data_std.erase(data_std.begin() + 10);
+  s21::vector<std::pair<int, int>> copy(data);
+  ASSERT_EQ(copy.size(), data_std.size());
+  for (size_t i = 0; i < data_std.size(); i++) {
+    ASSERT_EQ(copy[i], data_std[i]);
+  }
+}
+
+TEST(Method, insert_count) {
+  DEFUALT_V;
+  std::vector<int> data_std{1, 2, 3, 4};
+  auto it = data.insert(data.begin() + 1, 5, 9);
+  data_std.insert(data_std.begin() + 1, 5, 9);
+  ASSERT_EQ(it, data.begin() + 1);
+  ASSERT_EQ(data.size(), data_std.size());
+  for (size_t i = 0; i < data_std.size(); i++) ASSERT_EQ(data[i], data_std[i]);
+}
+
+TEST(Method, insert_count_aliasing_element) {
+  s21::vector<std::string> data{"a", "b", "c"};
+  data.reserve(10);
+  data.insert(data.begin(), 3, data[2]);
+  ASSERT_EQ(data.size(), 6);
+  ASSERT_EQ(data[0], "c");
+  ASSERT_EQ(data[2], "c");
+  ASSERT_EQ(data[3], "a");
+  ASSERT_EQ(data[5], "c");
+}
+
+TEST(Method, insert_range) {
+  s21::vector<std::string> data{"a", "e"};
+  std::vector<std::string> source{"b", "c", "d"};
+  auto it = data.insert(data.begin() + 1, source.begin(), source.end());
+  ASSERT_EQ(*it, "b");
+  ASSERT_EQ(data.size(), 5);
+  ASSERT_EQ(data.capacity(), 5);
+  for (size_t i = 0; i < data.size(); i++) {
+    ASSERT_EQ(data[i], std::string(1, static_cast<char>('a' + i)));
+  }
+}
+
+TEST(Method, insert_range_single_pass) {
+  DEFUALT_V;
+  s21::list<int> source{10, 20, 30};
+  data.insert(data.begin() + 2, source.begin(), source.end());
+  std::vector<int> expected{1, 2, 10, 20, 30, 3, 4};
+  ASSERT_EQ(data.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); i++) ASSERT_EQ(data[i], expected[i]);
+}
+
+TEST(Method, append_range) {
+  DEFUALT_V;
+  std::array<int, 3> source{5, 6, 7};
+  data.append_range(source);
+  ASSERT_EQ(data.size(), 7);
+  ASSERT_EQ(data[4], 5);
+  ASSERT_EQ(data[6], 7);
+}
+
+TEST(Method, assign) {
+  DEFUALT_V;
+  data.assign(2, 8);
+  ASSERT_EQ(data.size(), 2);
+  ASSERT_EQ(data.capacity(), 4);
+  ASSERT_EQ(data[1], 8);
+  data.assign(6, 3);
+  ASSERT_EQ(data.size(), 6);
+  ASSERT_EQ(data[5], 3);
+
+  std::vector<int> source{7, 6, 5, 4, 3, 2, 1, 0};
+  data.assign(source.begin() + 3, source.end());
+  ASSERT_EQ(data.size(), 5);
+  ASSERT_EQ(data[0], 4);
+  data.assign(source.begin(), source.end());
+  ASSERT_EQ(data.size(), 8);
+  ASSERT_EQ(data[7], 0);
+}
+
+TEST(Method, resize) {
+  s21::vector<std::string> data{"a", "b"};
+  data.resize(4);
+  ASSERT_EQ(data.size(), 4);
+  ASSERT_TRUE(data[3].empty());
+  data.resize(6, "z");
+  ASSERT_EQ(data.size(), 6);
+  ASSERT_EQ(data[5], "z");
+  data.resize(1);
+  ASSERT_EQ(data.size(), 1);
+  ASSERT_EQ(data[0], "a");
+}
+
+TEST(Method, insert_many_single_reallocation) {
+  s21::vector<std::string> data{"x", "y"};
+  auto it = data.insert_many(data.begin() + 1, "a", data[1], std::string("b"));
+  ASSERT_EQ(data.size(), 5);
+  ASSERT_EQ(data.capacity(), 5);
+  ASSERT_EQ(it, data.begin() + 4);
+  std::vector<std::string> expected{"x", "a", "y", "b", "y"};
+  for (size_t i = 0; i < expected.size(); i++) ASSERT_EQ(data[i], expected[i]);
+}
+
+TEST(Growth, policies) {
+  s21::vector<int, s21::growth_one_and_half> half;
+  s21::vector<int, s21::growth_fixed<10>> fixed;
+  std::vector<size_t> half_capacities, fixed_capacities;
+  for (int i = 0; i < 30; i++) {
+    if (half.size() == half.capacity()) half_capacities.push_back(i);
+    if (fixed.size() == fixed.capacity()) fixed_capacities.push_back(i);
+    half.push_back(i);
+    fixed.push_back(i);
+  }
+  ASSERT_EQ(half.capacity(), 42);
+  ASSERT_EQ(half_capacities, (std::vector<size_t>{0, 1, 2, 3, 4, 6, 9, 13,
+                                                  19, 28}));
+  ASSERT_EQ(fixed.capacity(), 30);
+  ASSERT_EQ(fixed_capacities, (std::vector<size_t>{0, 10, 20}));
+  ASSERT_EQ(half[29], 29);
+  ASSERT_EQ(fixed[29], 29);
+}
+
+TEST(Growth, stats) {
+  ASSERT_EQ(sizeof(s21::vector<int>), 3 * sizeof(void *));
+  s21::vector<int, s21::growth_with_stats<>> data;
+  for (int i = 0; i < 5; i++) data.push_back(i);
+  auto stats = data.stats();
+  ASSERT_EQ(stats.reallocations, 3);
+  ASSERT_EQ(stats.bytes_copied, (1 + 2 + 4) * sizeof(int));
+  ASSERT_EQ(stats.remaps, 0);
+  ASSERT_EQ(s21::vector<int>().stats().reallocations, 0);
+}
+
+TEST(Growth, large_buffers) {
+  using growth = s21::growth_with_stats<
+      s21::growth_large_buffers<s21::growth_double, 4096>>;
+  s21::vector<int, growth> data;
+  const int count = 1 << 18;
+  for (int i = 0; i < count; i++) data.push_back(i);
+  data.insert(data.begin() + 1, 3, -1);
+  data.erase(data.begin() + 1);
+  ASSERT_EQ(data.size(), static_cast<size_t>(count + 2));
+  ASSERT_EQ(data[0], 0);
+  ASSERT_EQ(data[2], -1);
+  ASSERT_EQ(data[3], 1);
+  ASSERT_EQ(data[count + 1], count - 1);
+  auto stats = data.stats();
+  ASSERT_GT(stats.reallocations + stats.remaps, 0);
+  ASSERT_LT(stats.bytes_copied, 4096);
+#if S21_HAS_MREMAP
+  ASSERT_GT(stats.remaps, 0);
+#endif
+  data.resize(10);
+  data.shrink_to_fit();
+  ASSERT_EQ(data.capacity(), 10);
+  ASSERT_EQ(data[9], 7);
+  s21::vector<int, growth> moved(std::move(data));
+  ASSERT_EQ(moved.size(), 10);
+}
+
+TEST(Method_vector, allocator_balances) {
+  {
+    using alloc = CountingAllocator<int>;
+    s21::vector<int, s21::growth_double, alloc> data(alloc(1));
+    for (int i = 0; i < 100; i++) data.push_back(i);
+    auto copy = data;
+    ASSERT_EQ(copy.get_allocator().id, 1);
+    s21::vector<int, s21::growth_double, alloc> other(std::move(data),
+                                                      alloc(2));
+    ASSERT_EQ(other.size(), 100);
+    ASSERT_EQ(other[99], 99);
+    copy = std::move(other);
+    ASSERT_EQ(copy.size(), 100);
+    ASSERT_GT(CountingAllocator<char>::live, 0);
+  }
+  ASSERT_EQ(CountingAllocator<char>::live, 0);
+}
+
+TEST(Method_vector, pmr_resource) {
+  char buffer[1024];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+                                            std::pmr::null_memory_resource());
+  s21::pmr::vector<int> data(&arena);
+  data.insert_many_back(1, 2, 3);
+  ASSERT_EQ(data.get_allocator().resource(), &arena);
+  ASSERT_EQ(data[2], 3);
+  s21::pmr::vector<int> heap(std::move(data),
+                             std::pmr::new_delete_resource());
+  ASSERT_EQ(heap.get_allocator().resource(), std::pmr::new_delete_resource());
+  ASSERT_EQ(heap.size(), 3);
+  ASSERT_EQ(heap[0], 1);
+}